@@ -85,6 +85,16 @@ class camun::simulator::SimBall
 
     bool isInvalid() const;
 
+    /**
+     * Seeds the random number generator used for the detection noise of the ball
+     *
+     * @param seed the seed
+     */
+    void seedRng(uint32_t seed)
+    {
+        m_rng.seed(seed);
+    }
+
     // can be used to add ball mis-detections
     bool addDetection(SSLProto::SSL_DetectionBall &ball, btVector3 pos, float stddev,
                       float stddevArea, const btVector3 &cameraPosition,
@@ -210,6 +210,13 @@ void SimRobot::setDribbleMode(bool perfectDribbler)
     m_perfectDribbler = perfectDribbler;
 }
 
+bool SimRobot::canBeginConcurrently(const SimBall &ball) const
+{
+    // the ball is only kicked and the hold ball constraint is only added if the robot
+    // can kick the ball, and the hold ball constraint is only removed if it exists
+    return !m_holdBallConstraint && !canKickBall(ball);
+}
+
 void SimRobot::begin(SimBall &ball, double time)
 {
     m_commandTime += time;
@@ -774,6 +781,25 @@ bool SimRobot::isFlipped()
     return ((t * btVector3(0, 0, 1)).z() < 0) || isNan;
 }
 
+void SimRobot::update(SimRobotKinematics &kinematics) const
+{
+    btTransform transform;
+    m_motionState->getWorldTransform(transform);
+    kinematics.id = m_specs.id();
+
+    // Get robot orientation relative to the Z axis
+    float x = 0;
+    float y = 0;
+    float z = 0;
+    transform.getRotation().getEulerZYX(z, y, x);
+    kinematics.angle = z;
+
+    const btVector3 velocity = m_body->getLinearVelocity() / SIMULATOR_SCALE;
+    kinematics.v_x           = velocity.x();
+    kinematics.v_y           = velocity.y();
+    kinematics.r_z           = m_body->getAngularVelocity().z();
+}
+
 btVector3 SimRobot::position() const
 {
     const btTransform transform = m_body->getWorldTransform();
@@ -36,6 +36,21 @@ namespace camun
 namespace simulator
 {
 class SimRobot;
+
+/**
+ * The position, orientation and velocity of a robot, using the same fields as
+ * world::SimRobot without building a proto
+ */
+struct SimRobotKinematics
+{
+    unsigned int id;
+    float p_x;
+    float p_y;
+    float angle;
+    float v_x;
+    float v_y;
+    float r_z;
+};
 }  // namespace simulator
 }  // namespace camun
 
@@ -49,6 +64,16 @@ class camun::simulator::SimRobot
    public:
     void begin(SimBall &ball, double time);
 
+    /**
+     * Determines whether begin only changes the bodies and constraints of this robot,
+     * so that begin can be called for several robots at the same time. Otherwise,
+     * begin may kick the ball or add and remove constraints in the world
+     *
+     * @param ball the ball in play
+     * @return true if begin can run concurrently with begin of other robots
+     */
+    bool canBeginConcurrently(const SimBall &ball) const;
+
     bool canKickBall(const SimBall &ball) const;
 
     void tryKick(const SimBall &ball, float power, double time);
@@ -62,6 +87,15 @@ class camun::simulator::SimRobot
 
     void update(world::SimRobot &robot, const SimBall &ball) const;
 
+    /**
+     * Writes the orientation and velocity of the robot in the same way as
+     * update(world::SimRobot&, const SimBall&), without checking for ball contacts.
+     * The position is not written
+     *
+     * @param kinematics the kinematics to write to
+     */
+    void update(SimRobotKinematics &kinematics) const;
+
     void restoreState(const world::SimRobot &robot);
 
     void move(const sslsim::TeleportRobot &robot);
@@ -79,6 +113,16 @@ class camun::simulator::SimRobot
 
     void setDribbleMode(bool perfectDribbler);
 
+    /**
+     * Seeds the random number generator used for the detection noise of the robot
+     *
+     * @param seed the seed
+     */
+    void seedRng(uint32_t seed)
+    {
+        m_rng.seed(seed);
+    }
+
     void stopDribbling();
 
     const robot::Specs &specs() const
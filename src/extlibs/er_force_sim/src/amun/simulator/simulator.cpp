@@ -20,15 +20,64 @@
 
 #include "simulator.h"
 
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+
 #include <algorithm>
 #include <functional>
+#include <mutex>
 
 #include "extlibs/er_force_sim/src/core/coordinates.h"
 #include "extlibs/er_force_sim/src/protobuf/geometry.h"
 
 using namespace camun::simulator;
 
-Simulator::Simulator(const amun::SimulatorSetup &setup)
+namespace
+{
+// The task scheduler is global in Bullet, so only one multithreaded simulator can use
+// it at a time
+std::mutex taskSchedulerMutex;
+
+void setUpTaskScheduler()
+{
+    static std::once_flag taskSchedulerSetUp;
+    std::call_once(taskSchedulerSetUp,
+                   []()
+                   {
+                       // keep the default sequential task scheduler if Bullet is built
+                       // without multithreading support
+                       btITaskScheduler *taskScheduler = btCreateDefaultTaskScheduler();
+                       if (taskScheduler)
+                       {
+                           btSetTaskScheduler(taskScheduler);
+                       }
+                   });
+}
+
+class BeginRobotsLoop : public btIParallelForBody
+{
+   public:
+    BeginRobotsLoop(const std::vector<SimRobot *> &robots, SimBall &ball, double time_s)
+        : m_robots(robots), m_ball(ball), m_time_s(time_s)
+    {
+    }
+
+    void forLoop(int iBegin, int iEnd) const override
+    {
+        for (int i = iBegin; i < iEnd; ++i)
+        {
+            m_robots[i]->begin(m_ball, m_time_s);
+        }
+    }
+
+   private:
+    const std::vector<SimRobot *> &m_robots;
+    SimBall &m_ball;
+    double m_time_s;
+};
+}  // namespace
+
+Simulator::Simulator(const amun::SimulatorSetup &setup, bool multithreaded)
     : m_data(std::make_unique<SimulatorData>()),
       m_enabled(false),
       m_charge(true),
@@ -36,13 +85,31 @@ Simulator::Simulator(const amun::SimulatorSetup &setup)
       m_visionDelay(35 * 1000 * 1000),
       m_visionProcessingTime(5 * 1000 * 1000)
 {
-    m_data->collision  = std::make_unique<btDefaultCollisionConfiguration>();
-    m_data->dispatcher = std::make_unique<btCollisionDispatcher>(m_data->collision.get());
+    m_data->multithreaded        = multithreaded;
+    m_data->seeded               = false;
+    m_data->collision            = std::make_unique<btDefaultCollisionConfiguration>();
     m_data->overlappingPairCache = std::make_unique<btDbvtBroadphase>();
-    m_data->solver        = std::make_unique<btSequentialImpulseConstraintSolver>();
-    m_data->dynamicsWorld = std::make_shared<btDiscreteDynamicsWorld>(
-        m_data->dispatcher.get(), m_data->overlappingPairCache.get(),
-        m_data->solver.get(), m_data->collision.get());
+    if (multithreaded)
+    {
+        setUpTaskScheduler();
+        m_data->dispatcher =
+            std::make_unique<btCollisionDispatcherMt>(m_data->collision.get());
+        m_data->solver = std::make_unique<btSequentialImpulseConstraintSolverMt>();
+        m_data->solverPool = std::make_unique<btConstraintSolverPoolMt>(
+            btGetTaskScheduler()->getMaxNumThreads());
+        m_data->dynamicsWorld = std::make_shared<btDiscreteDynamicsWorldMt>(
+            m_data->dispatcher.get(), m_data->overlappingPairCache.get(),
+            m_data->solverPool.get(), m_data->solver.get(), m_data->collision.get());
+    }
+    else
+    {
+        m_data->dispatcher =
+            std::make_unique<btCollisionDispatcher>(m_data->collision.get());
+        m_data->solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+        m_data->dynamicsWorld = std::make_shared<btDiscreteDynamicsWorld>(
+            m_data->dispatcher.get(), m_data->overlappingPairCache.get(),
+            m_data->solver.get(), m_data->collision.get());
+    }
     m_data->dynamicsWorld->setGravity(btVector3(0.0f, 0.0f, -9.81f * SIMULATOR_SCALE));
     m_data->dynamicsWorld->setInternalTickCallback(
         [](btDynamicsWorld *world, btScalar timeStep)
@@ -147,6 +214,7 @@ void Simulator::resetFlipped(Simulator::RobotMap &robots, float side)
             robot = std::make_unique<SimRobot>(robot->specs(), m_data->dynamicsWorld,
                                                btVector3(x, side * y, 0), 0.0f);
             robot->setDribbleMode(m_data->dribblePerfect);
+            seedNewObject(*robot);
         }
         y -= 0.3;
     }
@@ -154,7 +222,15 @@ void Simulator::resetFlipped(Simulator::RobotMap &robots, float side)
 
 void Simulator::stepSimulation(double time_s)
 {
-    m_data->dynamicsWorld->stepSimulation(time_s, 10, SUB_TIMESTEP);
+    if (m_data->multithreaded)
+    {
+        std::scoped_lock lock(taskSchedulerMutex);
+        m_data->dynamicsWorld->stepSimulation(time_s, 10, SUB_TIMESTEP);
+    }
+    else
+    {
+        m_data->dynamicsWorld->stepSimulation(time_s, 10, SUB_TIMESTEP);
+    }
     m_time += time_s * 1E9;
 }
 
@@ -168,6 +244,7 @@ void Simulator::handleSimulatorTick(double time_s)
     if (m_data->ball->isInvalid())
     {
         m_data->ball = std::make_shared<SimBall>(m_data->dynamicsWorld);
+        seedNewObject(*m_data->ball);
     }
 
     // find out if ball and any robot collide
@@ -183,18 +260,55 @@ void Simulator::handleSimulatorTick(double time_s)
 
     // apply commands and forces to ball and robots
     m_data->ball->begin(ball_collision);
-    for (auto &[robotId, robot] : m_data->robotsBlue)
+    beginRobots(time_s);
+
+    // add gravity to all ACTIVE objects
+    // thus has to be done after applying commands
+    m_data->dynamicsWorld->applyGravity();
+}
+
+void Simulator::beginRobots(double time_s)
+{
+    if (!m_data->multithreaded)
     {
-        robot->begin(*m_data->ball, time_s);
+        for (auto &[robotId, robot] : m_data->robotsBlue)
+        {
+            robot->begin(*m_data->ball, time_s);
+        }
+        for (auto &[robotId, robot] : m_data->robotsYellow)
+        {
+            robot->begin(*m_data->ball, time_s);
+        }
+        return;
     }
-    for (auto &[robotId, robot] : m_data->robotsYellow)
+
+    // Robots that only change their own bodies are begun in parallel. They don't
+    // depend on the ball velocity or the world constraints, so the robots that
+    // interact with the ball can be begun afterwards in their usual order, with the
+    // same result as beginning all robots in order
+    std::vector<SimRobot *> concurrentRobots;
+    std::vector<SimRobot *> exclusiveRobots;
+    for (const RobotMap *robotMap : {&m_data->robotsBlue, &m_data->robotsYellow})
     {
-        robot->begin(*m_data->ball, time_s);
+        for (const auto &[robotId, robot] : *robotMap)
+        {
+            if (robot->canBeginConcurrently(*m_data->ball))
+            {
+                concurrentRobots.push_back(robot.get());
+            }
+            else
+            {
+                exclusiveRobots.push_back(robot.get());
+            }
+        }
     }
 
-    // add gravity to all ACTIVE objects
-    // thus has to be done after applying commands
-    m_data->dynamicsWorld->applyGravity();
+    btParallelFor(0, static_cast<int>(concurrentRobots.size()), 1,
+                  BeginRobotsLoop(concurrentRobots, *m_data->ball, time_s));
+    for (SimRobot *robot : exclusiveRobots)
+    {
+        robot->begin(*m_data->ball, time_s);
+    }
 }
 
 static bool checkCameraID(const int cameraId, const btVector3 &p,
@@ -244,13 +358,31 @@ static btVector3 positionOffsetForCamera(float offsetStrength, btVector3 cameraP
 }
 
 std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
+{
+    return getWrapperPackets(std::vector<bool>(getNumCameras(), true), true);
+}
+
+std::size_t Simulator::getNumCameras() const
+{
+    return m_data->reportedCameraSetup.size();
+}
+
+std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets(
+    const std::vector<bool> &cameras, bool includeGeometry)
 {
     const std::size_t numCameras = m_data->reportedCameraSetup.size();
 
+    // only cameras that capture a frame are checked for detections
+    auto isCameraSelected = [&cameras](std::size_t cameraId)
+    { return cameraId < cameras.size() && cameras[cameraId]; };
+
     std::vector<SSLProto::SSL_DetectionFrame> detections(numCameras);
     for (std::size_t i = 0; i < numCameras; i++)
     {
-        initializeDetection(detections[i], i);
+        if (isCameraSelected(i))
+        {
+            initializeDetection(detections[i], i);
+        }
     }
 
     bool missingBall = m_data->missingBallDetections > 0 &&
@@ -263,7 +395,8 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
         for (std::size_t cameraId = 0; cameraId < numCameras; ++cameraId)
         {
             // at least one id is always valid
-            if (!checkCameraID(cameraId, ballPosition, m_data->cameraPositions,
+            if (!isCameraSelected(cameraId) ||
+                !checkCameraID(cameraId, ballPosition, m_data->cameraPositions,
                                m_data->cameraOverlap))
             {
                 continue;
@@ -298,7 +431,8 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
 
                 for (std::size_t cameraId = 0; cameraId < numCameras; ++cameraId)
                 {
-                    if (!checkCameraID(cameraId, robotPos, m_data->cameraPositions,
+                    if (!isCameraSelected(cameraId) ||
+                        !checkCameraID(cameraId, robotPos, m_data->cameraPositions,
                                        m_data->cameraOverlap))
                     {
                         continue;
@@ -348,8 +482,14 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
     // add a wrapper packet for all detections (also for empty ones).
     // The reason is that other teams might rely on the fact that these detections
     // are in regular intervals.
-    for (auto &frame : detections)
+    for (std::size_t cameraId = 0; cameraId < numCameras; ++cameraId)
     {
+        if (!isCameraSelected(cameraId))
+        {
+            continue;
+        }
+
+        auto &frame = detections[cameraId];
         // if multiple balls are reported, shuffle them randomly (the tracking might
         // have systematic errors depending on the ball order)
         if (frame.balls_size() > 1)
@@ -364,12 +504,21 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
     }
 
     // add field geometry
-    if (packets.size() == 0)
+    if (includeGeometry)
     {
-        packets.push_back(SSLProto::SSL_WrapperPacket());
+        if (packets.size() == 0)
+        {
+            packets.push_back(SSLProto::SSL_WrapperPacket());
+        }
+        addGeometry(*packets[0].mutable_geometry());
     }
-    SSLProto::SSL_GeometryData *geometry   = packets[0].mutable_geometry();
-    SSLProto::SSL_GeometryFieldSize *field = geometry->mutable_field();
+
+    return packets;
+}
+
+void Simulator::addGeometry(SSLProto::SSL_GeometryData &geometry)
+{
+    SSLProto::SSL_GeometryFieldSize *field = geometry.mutable_field();
     convertToSSlGeometry(m_data->geometry, field);
 
     const btVector3 positionErrorSimScale =
@@ -378,7 +527,7 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
     coordinates::toVision(positionErrorSimScale, positionErrorVisionScale);
     for (const auto &calibration : m_data->reportedCameraSetup)
     {
-        auto calib = geometry->add_calib();
+        auto calib = geometry.add_calib();
         calib->CopyFrom(calibration);
         calib->set_derived_camera_world_tx(calib->derived_camera_world_tx() +
                                            positionErrorVisionScale.x());
@@ -389,15 +538,13 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
     }
 
     // add ball model to geometry data
-    geometry->mutable_models()->mutable_straight_two_phase()->set_acc_roll(-0.35);
-    geometry->mutable_models()->mutable_straight_two_phase()->set_acc_slide(-4.5);
-    geometry->mutable_models()->mutable_straight_two_phase()->set_k_switch(0.69);
-    geometry->mutable_models()->mutable_chip_fixed_loss()->set_damping_z(0.566);
-    geometry->mutable_models()->mutable_chip_fixed_loss()->set_damping_xy_first_hop(
+    geometry.mutable_models()->mutable_straight_two_phase()->set_acc_roll(-0.35);
+    geometry.mutable_models()->mutable_straight_two_phase()->set_acc_slide(-4.5);
+    geometry.mutable_models()->mutable_straight_two_phase()->set_k_switch(0.69);
+    geometry.mutable_models()->mutable_chip_fixed_loss()->set_damping_z(0.566);
+    geometry.mutable_models()->mutable_chip_fixed_loss()->set_damping_xy_first_hop(
         0.715);
-    geometry->mutable_models()->mutable_chip_fixed_loss()->set_damping_xy_other_hops(1);
-
-    return packets;
+    geometry.mutable_models()->mutable_chip_fixed_loss()->set_damping_xy_other_hops(1);
 }
 
 world::SimulatorState Simulator::getSimulatorState()
@@ -439,6 +586,33 @@ world::SimulatorState Simulator::getSimulatorState()
     return simState;
 }
 
+std::vector<SimRobotKinematics> Simulator::getRobotKinematics(bool isBlue) const
+{
+    const RobotMap &team = isBlue ? m_data->robotsBlue : m_data->robotsYellow;
+
+    std::vector<SimRobotKinematics> robotKinematics;
+    robotKinematics.reserve(team.size());
+    for (const auto &[robotId, robot] : team)
+    {
+        SimRobotKinematics &kinematics = robotKinematics.emplace_back();
+        robot->update(kinematics);
+
+        // convert coordinates from ER Force, in the same way as getSimulatorState
+        btVector3 robotPos = robot->position() / SIMULATOR_SCALE;
+        btVector3 newRobotPos;
+        coordinates::toVision(robotPos, newRobotPos);
+        kinematics.p_x = newRobotPos.x() / 1000;
+        kinematics.p_y = newRobotPos.y() / 1000;
+
+        std::pair<float, float> velocity(kinematics.v_x, kinematics.v_y);
+        coordinates::toVisionVelocity(velocity, velocity);
+        kinematics.v_x = velocity.first / 1000;
+        kinematics.v_y = velocity.second / 1000;
+    }
+
+    return robotKinematics;
+}
+
 void Simulator::setTeam(Simulator::RobotMap &robotMap, float side,
                         const robot::Team &team,
                         std::map<uint32_t, robot::Specs> &teamSpecs)
@@ -466,6 +640,7 @@ void Simulator::setTeam(Simulator::RobotMap &robotMap, float side,
         robotMap[id] = std::make_unique<SimRobot>(teamSpecs[id], m_data->dynamicsWorld,
                                                   btVector3(x, side * y, 0), 0.f);
         robotMap[id]->setDribbleMode(m_data->dribblePerfect);
+        seedNewObject(*robotMap[id]);
 
         y -= 0.3;
     }
@@ -551,6 +726,7 @@ void Simulator::moveRobot(const sslsim::TeleportRobot &robot)
                     teamSpecs[robot.id().id()], m_data->dynamicsWorld,
                     btVector3(targetPos.x, targetPos.y, 0), 0.f);
                 robotMap[robot.id().id()]->setDribbleMode(m_data->dribblePerfect);
+                seedNewObject(*robotMap[robot.id().id()]);
             }
         }
         else if (!robot.present() && isPresent)
@@ -690,6 +866,11 @@ void Simulator::handleSimulatorSetupCommand(const std::unique_ptr<amun::Command>
                 m_data->dribblePerfect      = !realism.simulate_dribbling();
                 teamOrPerfectDribbleChanged = true;
             }
+
+            if (realism.seed() != 0)
+            {
+                seedRandomNumberGenerators(realism.seed());
+            }
         }
 
         if (sim.has_ssl_control())
@@ -774,3 +955,31 @@ void Simulator::handleSimulatorSetupCommand(const std::unique_ptr<amun::Command>
         }
     }
 }
+
+void Simulator::seedRandomNumberGenerators(uint32_t seed)
+{
+    m_data->seeded = true;
+    m_data->rng.seed(seed);
+    rand_shuffle_src.seed(seed);
+
+    // Derive the seeds of the ball and robots from the simulator's generator, in
+    // robot id order, so that they do not produce the same noise
+    seedNewObject(*m_data->ball);
+    for (auto &[robotId, robot] : m_data->robotsBlue)
+    {
+        seedNewObject(*robot);
+    }
+    for (auto &[robotId, robot] : m_data->robotsYellow)
+    {
+        seedNewObject(*robot);
+    }
+}
+
+template <typename SimObject>
+void Simulator::seedNewObject(SimObject &object)
+{
+    if (m_data->seeded)
+    {
+        object.seedRng(m_data->rng.uniformInt());
+    }
+}
@@ -21,6 +21,8 @@
 #ifndef SIMULATOR_H
 #define SIMULATOR_H
 
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+
 #include <memory>
 #include <random>
 #include <utility>
@@ -55,9 +57,23 @@ class camun::simulator::Simulator
     /**
      * Creates a simulator with the given set up
      *
+     * If multithreaded, the physics are stepped with Bullet's multithreaded dynamics
+     * world, which solves each simulation island (group of touching bodies) on the
+     * threads of a task scheduler shared by all simulators, and the robot commands
+     * are applied in parallel. Multithreaded simulators therefore step one at a time,
+     * so many simulators running in parallel should be single threaded instead.
+     *
+     * Multithreaded stepping is not deterministic. Bullet may create and solve the
+     * contacts of each simulation island in a different order on every run, so
+     * multithreaded runs differ from each other and from the single threaded simulator
+     * by small rounding errors. These errors stay small while bodies don't collide, but
+     * a collision can turn them into a different outcome. Runs which must be reproduced
+     * exactly should be single threaded.
+     *
      * @param setup the simulator set up
+     * @param multithreaded whether to step the physics on multiple threads
      */
-    explicit Simulator(const amun::SimulatorSetup &setup);
+    explicit Simulator(const amun::SimulatorSetup &setup, bool multithreaded = false);
 
    public:
     /**
@@ -94,6 +110,27 @@ class camun::simulator::Simulator
      */
     std::vector<SSLProto::SSL_WrapperPacket> getWrapperPackets();
 
+    /**
+     * Generates wrapper packets from the current state of the simulator for the
+     * given cameras
+     *
+     * @param cameras whether to generate a detection frame for each camera, indexed
+     * by camera id
+     * @param includeGeometry whether to add the field geometry to the packets
+     *
+     * @return list of wrapper packets, with one packet for each selected camera. If
+     * no camera is selected, the geometry is sent in a packet without a detection
+     */
+    std::vector<SSLProto::SSL_WrapperPacket> getWrapperPackets(
+        const std::vector<bool> &cameras, bool includeGeometry);
+
+    /**
+     * Gets the number of cameras in the simulator set up
+     *
+     * @return number of cameras
+     */
+    std::size_t getNumCameras() const;
+
     /**
      * Gets the current simulator state of the simulator
      *
@@ -101,6 +138,17 @@ class camun::simulator::Simulator
      */
     world::SimulatorState getSimulatorState();
 
+    /**
+     * Gets the kinematics of the robots on a team, with the same values as the robots
+     * in getSimulatorState. This is much cheaper than getSimulatorState, since no protos
+     * are built and ball contacts are not checked
+     *
+     * @param isBlue whether to get the blue or the yellow robots
+     *
+     * @return the kinematics of each robot on the team
+     */
+    std::vector<SimRobotKinematics> getRobotKinematics(bool isBlue) const;
+
     /**
      * Handles a simulator set up command and configure the simulator accordingly
      *
@@ -120,12 +168,37 @@ class camun::simulator::Simulator
     std::vector<robot::RadioResponse> acceptRobotControlCommand(
         const SSLSimulationProto::RobotControl &control, bool isBlue);
 
+    /**
+     * Applies the commands of all robots for a tick of the simulator
+     *
+     * @param time_s time in seconds
+     */
+    void beginRobots(double time_s);
+
     void resetFlipped(RobotMap &robots, float side);
     void setTeam(RobotMap &list, float side, const robot::Team &team,
                  std::map<uint32_t, robot::Specs> &specs);
     void moveBall(const sslsim::TeleportBall &ball);
     void moveRobot(const sslsim::TeleportRobot &robot);
     void initializeDetection(SSLProto::SSL_DetectionFrame &detection, size_t cameraId);
+    void addGeometry(SSLProto::SSL_GeometryData &geometry);
+
+    /**
+     * Seeds all random number generators of the simulator, including those of the
+     * ball and robots that already exist
+     *
+     * @param seed the seed, must not be 0
+     */
+    void seedRandomNumberGenerators(uint32_t seed);
+
+    /**
+     * Seeds the random number generator of a newly created ball or robot from the
+     * random number generator of the simulator, if the simulator has been seeded
+     *
+     * @param object the new ball or robot
+     */
+    template <typename SimObject>
+    void seedNewObject(SimObject &object);
 
    private:
     std::unique_ptr<SimulatorData> m_data;
@@ -178,8 +251,13 @@ struct camun::simulator::SimulatorData
     std::unique_ptr<btDefaultCollisionConfiguration> collision;
     std::unique_ptr<btCollisionDispatcher> dispatcher;
     std::unique_ptr<btBroadphaseInterface> overlappingPairCache;
-    std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
+    std::unique_ptr<btConstraintSolver> solver;
+    // solvers for the simulation islands of the multithreaded dynamics world
+    std::unique_ptr<btConstraintSolverPoolMt> solverPool;
     std::shared_ptr<btDiscreteDynamicsWorld> dynamicsWorld;
+    bool multithreaded;
+    // whether the random number generators were seeded with a fixed seed
+    bool seeded;
     world::Geometry geometry;
     std::vector<SSLProto::SSL_GeometryCameraCalibration> reportedCameraSetup;
     std::vector<btVector3> cameraPositions;
@@ -14,6 +14,7 @@ std::unique_ptr<TbotsProto::World> createWorld(const World& world)
     *(world_msg->mutable_enemy_team())    = *createTeam(world.enemyTeam());
     *(world_msg->mutable_ball())          = *createBall(world.ball());
     *(world_msg->mutable_game_state())    = *createGameState(world.gameState());
+    world_msg->set_field_version(world.getFieldVersion());
     if (world.getDribbleDisplacement().has_value())
     {
         *(world_msg->mutable_dribble_displacement()) =
@@ -34,6 +35,7 @@ std::unique_ptr<TbotsProto::World> createWorldWithSequenceNumber(
     *(world_msg->mutable_ball())          = *createBall(world.ball());
     *(world_msg->mutable_game_state())    = *createGameState(world.gameState());
     world_msg->set_sequence_number(sequence_number);
+    world_msg->set_field_version(world.getFieldVersion());
     if (world.getDribbleDisplacement().has_value())
     {
         *(world_msg->mutable_dribble_displacement()) =
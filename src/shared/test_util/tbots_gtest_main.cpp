@@ -7,12 +7,16 @@
 #include "proto/parameters.pb.h"
 #include "software/logger/logger.h"
 
-bool TbotsGtestMain::help                = false;
-bool TbotsGtestMain::enable_visualizer   = false;
-bool TbotsGtestMain::run_sim_in_realtime = false;
-bool TbotsGtestMain::stop_ai_on_start    = false;
-std::string TbotsGtestMain::runtime_dir  = "/tmp/tbots/yellow_test";
-double TbotsGtestMain::test_speed        = 1.0;
+bool TbotsGtestMain::help                             = false;
+bool TbotsGtestMain::enable_visualizer                = false;
+bool TbotsGtestMain::run_sim_in_realtime              = false;
+bool TbotsGtestMain::stop_ai_on_start                 = false;
+std::string TbotsGtestMain::runtime_dir               = "/tmp/tbots/yellow_test";
+double TbotsGtestMain::test_speed                     = 1.0;
+uint32_t TbotsGtestMain::simulation_seed              = 1;
+bool TbotsGtestMain::use_ground_truth_world           = false;
+std::string TbotsGtestMain::scenario_result_cache_dir = "";
+std::string TbotsGtestMain::code_version              = "";
 
 
 int main(int argc, char **argv)
@@ -50,6 +54,27 @@ int main(int argc, char **argv)
         "test slower than realtime, and values in the range (1, 10] will play the"
         "test faster than realtime i.e. 0.1 would be 10X slower than realtime, "
         "and 10 would be 10X faster than realtime. Default value is 1.");
+    desc.add_options()(
+        "simulation_seed",
+        boost::program_options::value<uint32_t>(&TbotsGtestMain::simulation_seed),
+        "The seed of the simulated noise and packet loss in simulated tests. 0 seeds "
+        "the simulation from the current time, which makes the tests not reproducible");
+    desc.add_options()(
+        "use_ground_truth_world",
+        boost::program_options::bool_switch(&TbotsGtestMain::use_ground_truth_world),
+        "Builds the World in simulated tests from the exact state of the simulation "
+        "instead of filtering simulated vision");
+    desc.add_options()("scenario_result_cache_dir",
+                       boost::program_options::value<std::string>(
+                           &TbotsGtestMain::scenario_result_cache_dir),
+                       "The directory to cache passed simulated test scenarios in. "
+                       "Requires code_version to be set");
+    desc.add_options()(
+        "code_version",
+        boost::program_options::value<std::string>(&TbotsGtestMain::code_version),
+        "The version of the code being tested, e.g. the git commit hash. Passed "
+        "simulated test scenarios are skipped if they were cached with the same "
+        "version");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
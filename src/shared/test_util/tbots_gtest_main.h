@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <string>
+
 struct TbotsGtestMain
 {
     // Controls whether the visualizer will be enabled during the tests (if implemented)
@@ -24,5 +27,22 @@ struct TbotsGtestMain
     // down factor i.e 0.1 test_speed will play test 10X slower. Values in the range (1,
     // 10] will play test faster. Default value is 1.
     static double test_speed;
+
+    // Seed of the simulated noise and packet loss in simulated tests. Simulated tests
+    // with the same seed are reproducible, unless the seed is 0, which seeds the
+    // simulation from the current time
+    static uint32_t simulation_seed;
+
+    // Controls whether simulated tests build the World from the exact state of the
+    // simulation instead of filtering simulated vision, which is faster and removes
+    // the noise of vision from the tests
+    static bool use_ground_truth_world;
+
+    // Directory to cache the passed simulated test scenarios in, and the version of
+    // the code being tested (e.g. the git commit hash). Passed scenarios are skipped
+    // when they are run again with the same code version, if both are set
+    static std::string scenario_result_cache_dir;
+    static std::string code_version;
+
     static bool help;
 };
@@ -2,16 +2,20 @@
 
 #include <Tracy.hpp>
 
-#include "software/ai/hl/stp/play/halt_play/halt_play.h"
+#include "proto/message_translation/tbots_protobuf.h"
 #include "software/ai/hl/stp/play/play_factory.h"
+#include "software/logger/logger.h"
 #include "software/tracy/tracy_constants.h"
 
 
 Ai::Ai(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr)
     : ai_config_ptr(ai_config_ptr),
-      fsm(std::make_unique<FSM<PlaySelectionFSM>>(PlaySelectionFSM{ai_config_ptr})),
+      play_pool(
+          std::make_shared<PlayPool>(ai_config_ptr, PlaySelectionFSM::SELECTABLE_PLAYS)),
+      fsm(std::make_unique<FSM<PlaySelectionFSM>>(
+          PlaySelectionFSM{ai_config_ptr, play_pool})),
       override_play(nullptr),
-      current_play(std::make_unique<HaltPlay>(ai_config_ptr)),
+      current_play(play_pool->acquire(TbotsProto::PlayName::HaltPlay)),
       ai_config_changed(false)
 {
     auto current_override = ai_config_ptr->ai_control_config().override_ai_play();
@@ -40,13 +44,22 @@ void Ai::updateAiConfig()
     ai_config_changed = true;
 }
 
+void Ai::refillPlayPool()
+{
+    play_pool->refill();
+}
+
 void Ai::checkAiConfig()
 {
     if (ai_config_changed)
     {
         ai_config_changed = false;
 
-        fsm = std::make_unique<FSM<PlaySelectionFSM>>(PlaySelectionFSM{ai_config_ptr});
+        fsm = std::make_unique<FSM<PlaySelectionFSM>>(
+            PlaySelectionFSM{ai_config_ptr, play_pool});
+
+        // The pooled plays copied parts of the old config when they were built
+        play_pool->invalidate();
 
         auto current_override = ai_config_ptr->ai_control_config().override_ai_play();
         if (current_override != TbotsProto::PlayName::UseAiSelection)
@@ -70,9 +83,13 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Ai::getPrimitives(const WorldPtr& worl
 
     checkAiConfig();
 
-    fsm->process_event(PlaySelectionFSM::Update([this](std::unique_ptr<Play> play)
-                                                { current_play = std::move(play); },
-                                                world_ptr->gameState(), *ai_config_ptr));
+    fsm->process_event(PlaySelectionFSM::Update(
+        [this](std::unique_ptr<Play> play)
+        {
+            play_pool->release(std::move(current_play));
+            current_play = std::move(play);
+        },
+        world_ptr->gameState(), *ai_config_ptr));
 
     std::unique_ptr<TbotsProto::PrimitiveSet> primitive_set;
     if (static_cast<bool>(override_play))
@@ -90,6 +107,19 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Ai::getPrimitives(const WorldPtr& worl
                                           });
     }
 
+    // Plot how many of the evaluations run by the play this tick were shared through
+    // the World's evaluation cache
+    std::map<std::string, double> evaluation_cache_stats;
+    for (const auto& [function_name, stats] : world_ptr->evaluationCache().getStats())
+    {
+        evaluation_cache_stats[function_name + "_cache_hits"]   = stats.hits;
+        evaluation_cache_stats[function_name + "_cache_misses"] = stats.misses;
+    }
+    if (!evaluation_cache_stats.empty())
+    {
+        LOG(PLOTJUGGLER) << *createPlotJugglerValue(evaluation_cache_stats);
+    }
+
     FrameMarkEnd(TracyConstants::AI_FRAME_MARKER);
 
     return primitive_set;
@@ -4,6 +4,7 @@
 
 #include "proto/play_info_msg.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/play/play_pool.h"
 #include "software/ai/play_selection_fsm.h"
 #include "software/time/timestamp.h"
 #include "software/world/world.h"
@@ -62,10 +63,18 @@ class Ai final
      */
     void updateAiConfig();
 
+    /**
+     * Rebuilds the plays in the play pool that were used or invalidated since the last
+     * refill. This should be called after the primitives of a tick were sent, so that
+     * building plays does not delay them.
+     */
+    void refillPlayPool();
+
    private:
     void checkAiConfig();
 
     std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr;
+    std::shared_ptr<PlayPool> play_pool;
     std::unique_ptr<FSM<PlaySelectionFSM>> fsm;
     std::unique_ptr<Play> override_play;
     std::unique_ptr<Play> current_play;
@@ -1,5 +1,7 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
+#include <sstream>
+
 std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &shot_origin,
                                        const std::vector<Robot> &robot_obstacles,
                                        TeamType goal, double radius)
@@ -154,3 +156,30 @@ std::optional<Shot> calcBestShotOnGoal(const Field &field, const Team &friendly_
             obstacles, goal, radius);
     }
 }
+
+std::optional<Shot> calcBestShotOnGoal(const World &world, const Point &shot_origin,
+                                       TeamType goal,
+                                       const std::vector<Robot> &robots_to_ignore,
+                                       double radius)
+{
+    // Robots are only ignored if they're equal to a robot in the World, so the key
+    // has to include everything Robot::operator== compares
+    std::ostringstream robots_to_ignore_key;
+    for (const Robot &robot : robots_to_ignore)
+    {
+        robots_to_ignore_key << WorldEvaluationCache::makeKey(
+            robot.id(), robot.position(), robot.velocity(), robot.orientation(),
+            robot.angularVelocity());
+    }
+
+    return world.evaluationCache().getOrCompute(
+        "calcBestShotOnGoal",
+        WorldEvaluationCache::makeKey(shot_origin, static_cast<int>(goal),
+                                      robots_to_ignore_key.str(), radius),
+        [&]()
+        {
+            return calcBestShotOnGoal(world.field(), world.friendlyTeam(),
+                                      world.enemyTeam(), shot_origin, goal,
+                                      robots_to_ignore, radius);
+        });
+}
@@ -58,3 +58,23 @@ std::optional<Shot> calcBestShotOnGoal(const Field &field, const Team &friendly_
                                        TeamType goal,
                                        const std::vector<Robot> &robots_to_ignore = {},
                                        double radius = ROBOT_MAX_RADIUS_METERS);
+
+/**
+ * Finds the best shot on the specified goal from the given World. This is the same as
+ * calling calcBestShotOnGoal with the field and teams of the World, but the result is
+ * cached in the World's evaluation cache so repeated calls with the same World and
+ * arguments are only computed once
+ *
+ * @param world The world
+ * @param shot_origin The point that the shot will be taken from
+ * @param goal The goal to shoot at
+ * @param robots_to_ignore The robots to ignore
+ * @param radius The radius for the robot obstacles
+ *
+ * @return the best target to shoot at and the largest open angle interval for the
+ * shot. If no shot can be found, returns std::nullopt
+ */
+std::optional<Shot> calcBestShotOnGoal(const World &world, const Point &shot_origin,
+                                       TeamType goal,
+                                       const std::vector<Robot> &robots_to_ignore = {},
+                                       double radius = ROBOT_MAX_RADIUS_METERS);
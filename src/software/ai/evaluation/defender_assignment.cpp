@@ -118,6 +118,20 @@ std::vector<DefenderAssignment> getAllDefenderAssignments(
     return assignments;
 }
 
+std::vector<DefenderAssignment> getAllDefenderAssignments(
+    const World &world, bool include_goalie,
+    const TbotsProto::DefensePlayConfig::DefenderAssignmentConfig &config)
+{
+    return world.evaluationCache().getOrCompute(
+        "getAllDefenderAssignments",
+        WorldEvaluationCache::makeKey(include_goalie, config.SerializeAsString()),
+        [&]()
+        {
+            return getAllDefenderAssignments(getAllEnemyThreats(world, include_goalie),
+                                             world.field(), world.ball(), config);
+        });
+}
+
 std::vector<EnemyThreat> filterOutSimilarThreats(const std::vector<EnemyThreat> &threats,
                                                  double min_distance,
                                                  const Angle &min_angle)
@@ -5,6 +5,7 @@
 #include "software/geom/point.h"
 #include "software/geom/segment.h"
 #include "software/world/field.h"
+#include "software/world/world.h"
 
 // Indicates the type of defender for a DefenderAssignment
 enum DefenderAssignmentType
@@ -90,6 +91,23 @@ std::vector<DefenderAssignment> getAllDefenderAssignments(
     const std::vector<EnemyThreat> &threats, const Field &field, const Ball &ball,
     const TbotsProto::DefensePlayConfig::DefenderAssignmentConfig &config);
 
+/**
+ * Determines all possible defender assignments against the enemy threats in the
+ * World. This is the same as calling getAllDefenderAssignments with the enemy threats
+ * from getAllEnemyThreats and the field and ball of the World, but the result is
+ * cached in the World's evaluation cache
+ *
+ * @param world the World
+ * @param include_goalie whether to include the enemy goalie in the enemy threats
+ * @param config the DefenderAssignmentConfig used for tuning assignments
+ *
+ * @return a list of all possible defender assignments in order of decreasing
+ * coverage rating
+ */
+std::vector<DefenderAssignment> getAllDefenderAssignments(
+    const World &world, bool include_goalie,
+    const TbotsProto::DefensePlayConfig::DefenderAssignmentConfig &config);
+
 /**
  * Filters out enemy threats with similar positioning/angle to the primary threat
  * (i.e. the first threat in the list). Of the similar threats, only the closest
@@ -117,3 +117,16 @@ void sortThreatsInDecreasingOrder(std::vector<EnemyThreat> &threats);
 std::vector<EnemyThreat> getAllEnemyThreats(const Field &field, const Team &friendly_team,
                                             Team enemy_team, const Ball &ball,
                                             bool include_goalie);
+
+/**
+ * Calculates the threat of each enemy robot in the World, and returns them in order
+ * of decreasing threat. This is the same as calling getAllEnemyThreats with the field,
+ * teams and ball of the World, but the result is cached in the World's evaluation
+ * cache
+ *
+ * @param world The World
+ * @param include_goalie Whether or not to include the enemy goalie in the evaluation
+ * and resultant threats
+ * @return A list of EnemyThreats in order of decreasing threat
+ */
+std::vector<EnemyThreat> getAllEnemyThreats(const World &world, bool include_goalie);
@@ -152,6 +152,40 @@ TEST(GetNumPassesToRobotTest, one_simple_pass_to_robot_with_no_obstacles)
     EXPECT_EQ(passer.value(), friendly_robot_0);
 }
 
+TEST(GetNumPassesToRobotTest, initial_passer_not_on_passing_team_does_not_block_passes)
+{
+    Robot initial_passer   = Robot(4, Point(0, 0.06), Vector(0, 0), Angle::zero(),
+                                   AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot friendly_robot_0 = Robot(0, Point(3, 0), Vector(0, 0), Angle::zero(),
+                                   AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot friendly_robot_1 = Robot(1, Point(-0.3, 0.12), Vector(0, 0), Angle::zero(),
+                                   AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot friendly_robot_2 = Robot(2, Point(-3, 0), Vector(0, 0), Angle::zero(),
+                                   AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot friendly_robot_3 = Robot(3, Point(-1.5, 0.14), Vector(0, 0), Angle::zero(),
+                                   AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Team friendly_team     = Team(Duration::fromSeconds(1));
+    friendly_team.updateRobots(
+        {friendly_robot_0, friendly_robot_1, friendly_robot_2, friendly_robot_3});
+
+    Team enemy_team = Team(Duration::fromSeconds(1));
+
+    // The direct pass to robot 2 is blocked by robot 1. The pass from robot 0 to
+    // robot 2 goes right past the initial passer, which has already passed the ball
+    auto result = getNumPassesToRobot(initial_passer, friendly_robot_2, friendly_team,
+                                      enemy_team);
+
+    // A valid result should have been found
+    ASSERT_TRUE(result);
+
+    int num_passes              = result.value().first;
+    std::optional<Robot> passer = result.value().second;
+
+    EXPECT_EQ(2, num_passes);
+    ASSERT_TRUE(passer);
+    EXPECT_EQ(passer.value(), friendly_robot_0);
+}
+
 // TODO: Re-enable as part of https://github.com/UBC-Thunderbots/Software/issues/642
 // TEST(GetNumPassesToRobotTest, two_passes_around_a_single_obstacle)
 //{
@@ -554,3 +588,28 @@ TEST(EnemyThreatTest, three_enemies_vs_one_friendly)
     ASSERT_TRUE(threat_2.passer);
     EXPECT_EQ(threat_2.passer, enemy_robot_1);
 }
+
+TEST(EnemyThreatTest, cached_threats_match_uncached_threats)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    world->updateEnemyTeamState(Team(
+        {Robot(1, Point(-2, 1.5), Vector(0, 0), Angle::half(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0)),
+         Robot(2, Point(-1.5, -1), Vector(0, 0), Angle::half(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0))},
+        Duration::fromSeconds(1)));
+    world->updateFriendlyTeamState(
+        Team({Robot(0, Point(-3, 0.5), Vector(0, 0), Angle::zero(),
+                    AngularVelocity::zero(), Timestamp::fromSeconds(0))},
+             Duration::fromSeconds(1)));
+
+    auto expected_threats = getAllEnemyThreats(world->field(), world->friendlyTeam(),
+                                               world->enemyTeam(), world->ball(), false);
+
+    EXPECT_EQ(expected_threats, getAllEnemyThreats(*world, false));
+    EXPECT_EQ(expected_threats, getAllEnemyThreats(*world, false));
+
+    auto stats = world->evaluationCache().getStats().at("getAllEnemyThreats");
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(1, stats.misses);
+}
@@ -5,13 +5,20 @@
 
 std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area)
 {
-    std::vector<Point> enemy_locations;
-    for (Robot robot : world.enemyTeam().getAllRobots())
-    {
-        enemy_locations.emplace_back(robot.position());
-    }
+    return world.evaluationCache().getOrCompute(
+        "findGoodChipTargets",
+        WorldEvaluationCache::makeKey(target_area.negXNegYCorner(),
+                                      target_area.posXPosYCorner()),
+        [&]()
+        {
+            std::vector<Point> enemy_locations;
+            for (Robot robot : world.enemyTeam().getAllRobots())
+            {
+                enemy_locations.emplace_back(robot.position());
+            }
 
-    return findOpenCircles(target_area, enemy_locations);
+            return findOpenCircles(target_area, enemy_locations);
+        });
 }
 
 std::vector<Circle> findGoodChipTargets(const World& world)
@@ -11,7 +11,8 @@
  * @param target_area the area on the field that chip targets should be restrained to
  *
  * @return a vector of circles where the center is a good point to chip to, and the
- *         radius is the distance to the nearest enemy
+ *         radius is the distance to the nearest enemy. The result is cached in the
+ *         world's evaluation cache
  */
 std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area);
 
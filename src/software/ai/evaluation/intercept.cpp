@@ -3,6 +3,7 @@
 #include "shared/constants.h"
 #include "software/ai/evaluation/time_to_travel.h"
 #include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
 #include "software/optimization/gradient_descent_optimizer.hpp"
 
 std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
@@ -88,6 +89,235 @@ std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &b
     return std::make_pair(best_ball_intercept_pos, time_to_ball_pos);
 }
 
+namespace
+{
+// The time between ball trajectory samples, and how far into the future we sample the
+// trajectory if the ball stays in the field
+constexpr double SAMPLE_PERIOD_S = 0.05;
+constexpr double MAX_HORIZON_S   = 10.0;
+// The intervals between samples are split until they are this short, then the
+// intercept time is found precisely by bisecting
+constexpr double MIN_INTERVAL_S       = SAMPLE_PERIOD_S / 16;
+constexpr unsigned int NUM_BISECTIONS = 6;
+
+/**
+ * Checks whether the robot can intercept the ball at the given ball time, which it can
+ * if the ball is in the field and the robot can get to where the ball is by then
+ *
+ * @param robot The robot intercepting the ball
+ * @param field The field on which the intercept has to occur
+ * @param robot_time_offset_s The ball time at which the robot timestamp occurs
+ * @param ball_time_s The ball time of the intercept
+ * @param ball_position The position of the ball at that time
+ *
+ * @return whether the robot can intercept the ball
+ */
+bool canInterceptBall(const Robot &robot, const Field &field, double robot_time_offset_s,
+                      double ball_time_s, const Point &ball_position)
+{
+    return contains(field.fieldLines(), ball_position) &&
+           robot.getTimeToPosition(ball_position).toSeconds() <=
+               ball_time_s - robot_time_offset_s;
+}
+
+/**
+ * Gets the farthest distance the robot could travel in the given time, accelerating as
+ * hard as it can from its current speed up to its max speed. The robot can't reach any
+ * point farther away than this in that time
+ *
+ * @param robot The robot
+ * @param time_s The time the robot has to travel, from the robot timestamp
+ *
+ * @return the farthest distance the robot could travel
+ */
+double getMaxTravelDistance(const Robot &robot, double time_s)
+{
+    const double max_speed        = robot.robotConstants().robot_max_speed_m_per_s;
+    const double max_acceleration =
+        robot.robotConstants().robot_max_acceleration_m_per_s_2;
+    const double initial_speed    = std::min(robot.velocity().length(), max_speed);
+
+    const double time_to_max_speed_s =
+        std::min(time_s, (max_speed - initial_speed) / max_acceleration);
+    return initial_speed * time_to_max_speed_s +
+           0.5 * max_acceleration * std::pow(time_to_max_speed_s, 2) +
+           max_speed * (time_s - time_to_max_speed_s);
+}
+
+/**
+ * Finds the earliest time in the interval between the given ball times, excluding the
+ * start of the interval, at which the robot can intercept the ball
+ *
+ * The interval is split in half until it is MIN_INTERVAL_S long, searching the earlier
+ * half first. Halves in which the ball is too far away for the robot to possibly get to
+ * it are skipped. Unlike bisecting, this can't skip over an earlier intercept, since
+ * whether the robot can intercept the ball isn't monotonic in time. Once the first
+ * short interval with an intercept at its end is found, the intercept time is refined
+ * by bisecting
+ *
+ * @param robot The robot intercepting the ball
+ * @param ball The ball to intercept
+ * @param field The field on which the intercept has to occur
+ * @param robot_time_offset_s The ball time at which the robot timestamp occurs
+ * @param start The ball time and state at the start of the interval
+ * @param end The ball time and state at the end of the interval
+ *
+ * @return The earliest ball time and ball position at which the robot can intercept
+ * the ball in the interval, or std::nullopt if there is none
+ */
+std::optional<std::pair<double, Point>> findEarliestInterceptInInterval(
+    const Robot &robot, const Ball &ball, const Field &field, double robot_time_offset_s,
+    const std::pair<double, BallState> &start, const std::pair<double, BallState> &end)
+{
+    const auto &[start_time_s, start_state] = start;
+    const auto &[end_time_s, end_state]     = end;
+
+    // The ball has a constant acceleration, so it is fastest at one of the ends of the
+    // interval. This bounds how close the ball can get to the robot in the interval
+    const double max_ball_speed =
+        std::max(start_state.velocity().length(), end_state.velocity().length());
+    const double min_ball_distance =
+        (distance(robot.position(), start_state.position()) +
+         distance(robot.position(), end_state.position()) -
+         max_ball_speed * (end_time_s - start_time_s)) /
+        2;
+    if (min_ball_distance > getMaxTravelDistance(robot, end_time_s - robot_time_offset_s))
+    {
+        return std::nullopt;
+    }
+
+    if (end_time_s - start_time_s <= MIN_INTERVAL_S)
+    {
+        if (!canInterceptBall(robot, field, robot_time_offset_s, end_time_s,
+                              end_state.position()))
+        {
+            return std::nullopt;
+        }
+
+        double lo_s       = start_time_s;
+        double hi_s       = end_time_s;
+        Point hi_position = end_state.position();
+        for (unsigned int iter = 0; iter < NUM_BISECTIONS; iter++)
+        {
+            double mid_s = (lo_s + hi_s) / 2;
+            Point mid_position =
+                ball.estimateFutureState(Duration::fromSeconds(mid_s)).position();
+            if (canInterceptBall(robot, field, robot_time_offset_s, mid_s, mid_position))
+            {
+                hi_s        = mid_s;
+                hi_position = mid_position;
+            }
+            else
+            {
+                lo_s = mid_s;
+            }
+        }
+        return std::make_pair(hi_s, hi_position);
+    }
+
+    const double mid_time_s = (start_time_s + end_time_s) / 2;
+    const std::pair<double, BallState> mid(
+        mid_time_s, ball.estimateFutureState(Duration::fromSeconds(mid_time_s)));
+    std::optional<std::pair<double, Point>> intercept = findEarliestInterceptInInterval(
+        robot, ball, field, robot_time_offset_s, start, mid);
+    if (intercept)
+    {
+        return intercept;
+    }
+    return findEarliestInterceptInInterval(robot, ball, field, robot_time_offset_s, mid,
+                                           end);
+}
+}  // namespace
+
+std::vector<std::optional<std::pair<Point, Duration>>> findEarliestInterceptsForBall(
+    const Ball &ball, const Field &field, const std::vector<Robot> &robots)
+{
+    std::vector<std::optional<std::pair<Point, Duration>>> intercepts(robots.size(),
+                                                                      std::nullopt);
+
+    // If the ball is not moving, the only way to intercept it is to move to where it is
+    if (ball.velocity().length() == 0 && ball.acceleration().length() == 0)
+    {
+        if (!contains(field.fieldLines(), ball.position()))
+        {
+            return intercepts;
+        }
+        for (size_t i = 0; i < robots.size(); i++)
+        {
+            intercepts[i] = std::make_pair(ball.position(),
+                                           robots[i].getTimeToPosition(ball.position()));
+        }
+        return intercepts;
+    }
+
+    // Sample the ball trajectory once for all robots. The ball may start outside the
+    // field and roll into it, but once it has left the field we can't intercept it
+    // anymore so we stop sampling. Times are relative to the ball timestamp
+    std::vector<std::pair<double, BallState>> ball_samples;
+    ball_samples.reserve(static_cast<size_t>(MAX_HORIZON_S / SAMPLE_PERIOD_S) + 1);
+    bool ball_entered_field = false;
+    for (double t = 0; t <= MAX_HORIZON_S; t += SAMPLE_PERIOD_S)
+    {
+        BallState state = ball.estimateFutureState(Duration::fromSeconds(t));
+        if (contains(field.fieldLines(), state.position()))
+        {
+            ball_entered_field = true;
+        }
+        else if (ball_entered_field)
+        {
+            break;
+        }
+        ball_samples.emplace_back(t, state);
+    }
+
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        const Robot &robot = robots[i];
+
+        // The ball time at which the robot timestamp occurs. We can't intercept the
+        // ball before either of the timestamps
+        const double robot_time_offset_s =
+            (robot.timestamp() - ball.timestamp()).toSeconds();
+        const double start_time_s = std::max(0.0, robot_time_offset_s);
+
+        std::pair<double, BallState> interval_start(
+            start_time_s, ball.estimateFutureState(Duration::fromSeconds(start_time_s)));
+        const Point &start_position = interval_start.second.position();
+        std::optional<std::pair<double, Point>> intercept;
+        if (canInterceptBall(robot, field, robot_time_offset_s, start_time_s,
+                             start_position))
+        {
+            intercept = std::make_pair(start_time_s, start_position);
+        }
+
+        // Search the intervals between the samples in order, so the first intercept
+        // found is the earliest one
+        for (const std::pair<double, BallState> &sample : ball_samples)
+        {
+            if (intercept)
+            {
+                break;
+            }
+            if (sample.first <= start_time_s)
+            {
+                continue;
+            }
+            intercept = findEarliestInterceptInInterval(
+                robot, ball, field, robot_time_offset_s, interval_start, sample);
+            interval_start = sample;
+        }
+
+        if (intercept)
+        {
+            intercepts[i] = std::make_pair(
+                intercept->second,
+                Duration::fromSeconds(intercept->first - robot_time_offset_s));
+        }
+    }
+
+    return intercepts;
+}
+
 Point findOvershootInterceptPosition(const Robot &robot, const Point intercept_position,
                                      const Field &field, Duration ball_intercept_time,
                                      double step_speed, bool restrict_to_defense_area)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "software/geom/point.h"
 #include "software/world/ball.h"
@@ -24,6 +25,32 @@ std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &b
                                                                    const Robot &robot);
 
 
+/**
+ * Finds the earliest place for each of the given robots to intercept the given ball.
+ *
+ * The ball trajectory is sampled once and shared by all the robots, so this is much
+ * cheaper than calling findBestInterceptForBall for each robot. For each robot, the
+ * intervals between the samples are searched in order, splitting each one in half until
+ * the first few milliseconds long interval with an intercept is found, and then
+ * bisecting it. Intervals in which the ball is too far away for the robot to possibly
+ * reach it are skipped without being split. Since the earlier half is always searched
+ * first, an intercept is only missed if the robot can only reach the ball for less than
+ * a few milliseconds at a time.
+ *
+ * @param ball The ball to intercept
+ * @param field The field on which we want the intercept to occur
+ * @param robots The robots that will hopefully intercept the ball
+ *
+ * @return For each robot, in the same order as the given robots, a pair holding the
+ * earliest place that the robot can move to in order to intercept the ball, and the
+ * duration into the future at which the intercept would occur, relative to the
+ * timestamp of the robot. If a robot can't intercept the ball before it leaves the
+ * field, its entry is std::nullopt
+ */
+std::vector<std::optional<std::pair<Point, Duration>>> findEarliestInterceptsForBall(
+    const Ball &ball, const Field &field, const std::vector<Robot> &robots);
+
+
 /**
  * Attempts to find a reachable overshoot destination for intercepting the ball,
  * adjusting final speed in steps up to the robot's max speed.
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "software/geom/algorithms/contains.h"
 #include "software/test_util/test_util.h"
 
 TEST(InterceptEvaluationTest, findBestInterceptForBall_robot_on_ball_path_ball_3_m_per_s)
@@ -256,3 +257,165 @@ TEST(InterceptEvaluationTest, findBestInterceptForBall_ball_moving_too_fast_to_i
     auto best_intercept = findBestInterceptForBall(ball, field, robot);
     ASSERT_FALSE(best_intercept);
 }
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_no_robots)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({0, 0}, {3, 0}, Timestamp::fromSeconds(0));
+
+    EXPECT_TRUE(findEarliestInterceptsForBall(ball, field, {}).empty());
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_robot_on_ball_path)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({0, 0}, {3, 0}, Timestamp::fromSeconds(0));
+    Robot robot(0, {2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_EQ(1, intercepts.size());
+    ASSERT_TRUE(intercepts[0]);
+
+    // The robot moves towards the ball, so it meets the ball before the ball reaches
+    // the robot's initial position 2/3 seconds from now
+    auto [intercept_pos, time_to_intercept] = *intercepts[0];
+    EXPECT_DOUBLE_EQ(0, intercept_pos.y());
+    EXPECT_LT(0, intercept_pos.x());
+    EXPECT_GE(2, intercept_pos.x());
+    EXPECT_LT(0, time_to_intercept.toSeconds());
+    EXPECT_GE(2.0 / 3.0, time_to_intercept.toSeconds());
+
+    // The robot can only just get to the intercept position in time
+    EXPECT_NEAR(robot.getTimeToPosition(intercept_pos).toSeconds(),
+                time_to_intercept.toSeconds(), 0.01);
+    EXPECT_NEAR(ball.estimateFutureState(time_to_intercept).position().x(),
+                intercept_pos.x(), 0.01);
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_robot_already_at_ball)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({1, 1}, {2, 0}, Timestamp::fromSeconds(0));
+    Robot robot(0, {1, 1}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_TRUE(intercepts[0]);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(1, 1), intercepts[0]->first, 1e-9));
+    EXPECT_DOUBLE_EQ(0, intercepts[0]->second.toSeconds());
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_ball_not_moving)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({-2, -1}, {0, 0}, Timestamp::fromSeconds(0));
+    Robot robot(0, {2, 2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_TRUE(intercepts[0]);
+    EXPECT_EQ(Point(-2, -1), intercepts[0]->first);
+    EXPECT_EQ(robot.getTimeToPosition(Point(-2, -1)), intercepts[0]->second);
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_robot_timestamp_ahead_of_ball)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({0, 0}, {1, 0}, Timestamp::fromSeconds(0));
+    Robot robot(0, {0, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(1));
+
+    // By the time of the robot timestamp, the ball has already moved past the robot
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_TRUE(intercepts[0]);
+    auto [intercept_pos, time_to_intercept] = *intercepts[0];
+    EXPECT_LT(1, intercept_pos.x());
+    EXPECT_NEAR(robot.getTimeToPosition(intercept_pos).toSeconds(),
+                time_to_intercept.toSeconds(), 0.01);
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_ball_rolling_into_field)
+{
+    // The ball starts outside the field lines, so we can only intercept it once it
+    // has rolled into the field
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({-2, 4}, {0, -2}, Timestamp::fromSeconds(0));
+    Robot robot(0, {-2, 2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_TRUE(intercepts[0]);
+    EXPECT_TRUE(contains(field.fieldLines(), intercepts[0]->first));
+    EXPECT_NEAR(-2, intercepts[0]->first.x(), 1e-9);
+}
+
+TEST(InterceptEvaluationTest,
+     findEarliestInterceptsForBall_ball_moving_too_fast_to_intercept)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({3, 3}, {1, 1}, Timestamp::fromSeconds(0));
+    Robot robot(0, {2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_EQ(1, intercepts.size());
+    EXPECT_FALSE(intercepts[0]);
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_fast_ball_passing_robot)
+{
+    // The ball passes the robot so quickly that the robot can only intercept it for a
+    // moment, which is shorter than the time between the ball trajectory samples
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({-3, 0}, {6, 0}, Timestamp::fromSeconds(0));
+    Robot robot(0, {-1, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, {robot});
+    ASSERT_TRUE(intercepts[0]);
+    auto [intercept_pos, time_to_intercept] = *intercepts[0];
+    EXPECT_LE(robot.getTimeToPosition(intercept_pos), time_to_intercept);
+
+    // The robot can't get to the ball any earlier
+    for (double t = 0; t < time_to_intercept.toSeconds() - 0.005; t += 0.001)
+    {
+        Point ball_position = ball.estimateFutureState(Duration::fromSeconds(t)).position();
+        EXPECT_LT(t, robot.getTimeToPosition(ball_position).toSeconds());
+    }
+}
+
+TEST(InterceptEvaluationTest, findEarliestInterceptsForBall_multiple_robots)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({-3, 0}, {2, 0}, Timestamp::fromSeconds(0));
+    std::vector<Robot> robots = {
+        Robot(0, {2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(1, {-1, 0.5}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(2, {-4, -2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    };
+
+    auto intercepts = findEarliestInterceptsForBall(ball, field, robots);
+    ASSERT_EQ(robots.size(), intercepts.size());
+
+    // Each result should be the same as solving for that robot on its own
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        auto single_intercept = findEarliestInterceptsForBall(ball, field, {robots[i]});
+        ASSERT_EQ(single_intercept[0].has_value(), intercepts[i].has_value());
+        if (intercepts[i])
+        {
+            EXPECT_EQ(single_intercept[0]->first, intercepts[i]->first);
+            EXPECT_EQ(single_intercept[0]->second, intercepts[i]->second);
+        }
+    }
+
+    // The robot right beside the ball path gets to the ball first
+    ASSERT_TRUE(intercepts[0]);
+    ASSERT_TRUE(intercepts[1]);
+    EXPECT_LT(intercepts[1]->second, intercepts[0]->second);
+    EXPECT_LT(intercepts[1]->first.x(), intercepts[0]->first.x());
+}
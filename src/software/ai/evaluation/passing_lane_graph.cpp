@@ -0,0 +1,204 @@
+#include "software/ai/evaluation/passing_lane_graph.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+#include "software/geom/circle.h"
+#include "software/geom/segment.h"
+
+PassingLaneGraph::PassingLaneGraph(const std::vector<Robot> &robots,
+                                   const std::vector<Robot> &non_blocking_robots)
+    : robots_(robots)
+{
+    robots_.insert(robots_.end(), non_blocking_robots.begin(), non_blocking_robots.end());
+    std::sort(robots_.begin(), robots_.end(), Robot::cmpRobotByID());
+
+    for (const Robot &robot : robots_)
+    {
+        positions_.emplace_back(robot.position());
+        blocks_lanes_.emplace_back(
+            std::none_of(non_blocking_robots.begin(), non_blocking_robots.end(),
+                         [&robot](const Robot &non_blocking_robot)
+                         { return non_blocking_robot.id() == robot.id(); }));
+    }
+
+    build();
+}
+
+const std::vector<Robot> &PassingLaneGraph::getRobots() const
+{
+    return robots_;
+}
+
+bool PassingLaneGraph::isLaneOpen(RobotId passer_id, RobotId receiver_id) const
+{
+    auto passer   = indexOf(passer_id);
+    auto receiver = indexOf(receiver_id);
+    if (!passer || !receiver)
+    {
+        return false;
+    }
+    return lane_open_[*passer * robots_.size() + *receiver];
+}
+
+std::vector<Robot> PassingLaneGraph::getReceivers(RobotId robot_id) const
+{
+    std::vector<Robot> receivers;
+    auto passer = indexOf(robot_id);
+    if (!passer)
+    {
+        return receivers;
+    }
+
+    for (size_t i = 0; i < robots_.size(); i++)
+    {
+        if (lane_open_[*passer * robots_.size() + i])
+        {
+            receivers.emplace_back(robots_[i]);
+        }
+    }
+    return receivers;
+}
+
+std::optional<std::pair<int, std::optional<Robot>>> PassingLaneGraph::getNumPassesToRobot(
+    RobotId initial_passer_id, RobotId final_receiver_id) const
+{
+    if (initial_passer_id == final_receiver_id)
+    {
+        return std::make_pair(0, std::nullopt);
+    }
+
+    auto passer   = indexOf(initial_passer_id);
+    auto receiver = indexOf(final_receiver_id);
+    if (!passer || !receiver)
+    {
+        return std::nullopt;
+    }
+
+    const std::vector<int> &pass_counts = getPassCounts(*passer);
+    int num_passes                      = pass_counts[*receiver];
+    if (num_passes < 0)
+    {
+        return std::nullopt;
+    }
+
+    // If there are multiple robots that can pass to the receiver with the fewest
+    // passes, we assume it will receive the ball from the closest one since this is
+    // more likely
+    const size_t n            = robots_.size();
+    const Point &receiver_pos = robots_[*receiver].position();
+    std::optional<size_t> closest_passer;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (pass_counts[i] == num_passes - 1 && lane_open_[i * n + *receiver] &&
+            (!closest_passer ||
+             distance(robots_[i].position(), receiver_pos) <
+                 distance(robots_[*closest_passer].position(), receiver_pos)))
+        {
+            closest_passer = i;
+        }
+    }
+
+    return std::make_pair(num_passes, robots_[closest_passer.value()]);
+}
+
+void PassingLaneGraph::build()
+{
+    const size_t n = robots_.size();
+    sortByX();
+    pass_counts_.assign(n, {});
+
+    lane_open_.assign(n * n, false);
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t j = i + 1; j < n; j++)
+        {
+            bool open             = computeLaneOpen(i, j);
+            lane_open_[i * n + j] = open;
+            lane_open_[j * n + i] = open;
+        }
+    }
+}
+
+void PassingLaneGraph::sortByX()
+{
+    x_order_.resize(robots_.size());
+    std::iota(x_order_.begin(), x_order_.end(), 0);
+    std::sort(x_order_.begin(), x_order_.end(), [this](size_t a, size_t b)
+              { return positions_[a].x() < positions_[b].x(); });
+
+    sorted_x_.clear();
+    for (size_t i : x_order_)
+    {
+        sorted_x_.emplace_back(positions_[i].x());
+    }
+}
+
+bool PassingLaneGraph::computeLaneOpen(size_t i, size_t j) const
+{
+    Segment lane(positions_[i], positions_[j]);
+
+    // Only robots within a robot radius of the lane along the x axis can block it
+    double min_x =
+        std::min(positions_[i].x(), positions_[j].x()) - ROBOT_MAX_RADIUS_METERS;
+    double max_x =
+        std::max(positions_[i].x(), positions_[j].x()) + ROBOT_MAX_RADIUS_METERS;
+    auto begin = std::lower_bound(sorted_x_.begin(), sorted_x_.end(), min_x);
+    auto end   = std::upper_bound(begin, sorted_x_.end(), max_x);
+
+    for (auto it = begin; it != end; it++)
+    {
+        size_t k = x_order_[static_cast<size_t>(it - sorted_x_.begin())];
+        if (k != i && k != j && blocks_lanes_[k] &&
+            intersects(Circle(positions_[k], ROBOT_MAX_RADIUS_METERS), lane))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<size_t> PassingLaneGraph::indexOf(RobotId robot_id) const
+{
+    auto it = std::lower_bound(robots_.begin(), robots_.end(), robot_id,
+                               [](const Robot &robot, RobotId id)
+                               { return robot.id() < id; });
+    if (it == robots_.end() || it->id() != robot_id)
+    {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(it - robots_.begin());
+}
+
+const std::vector<int> &PassingLaneGraph::getPassCounts(size_t source) const
+{
+    std::vector<int> &pass_counts = pass_counts_[source];
+    if (!pass_counts.empty())
+    {
+        return pass_counts;
+    }
+
+    // Breadth first search from the source, since every pass has the same cost
+    const size_t n = robots_.size();
+    pass_counts.assign(n, -1);
+    pass_counts[source] = 0;
+    std::deque<size_t> frontier{source};
+    while (!frontier.empty())
+    {
+        size_t current = frontier.front();
+        frontier.pop_front();
+        for (size_t next = 0; next < n; next++)
+        {
+            if (pass_counts[next] < 0 && lane_open_[current * n + next])
+            {
+                pass_counts[next] = pass_counts[current] + 1;
+                frontier.emplace_back(next);
+            }
+        }
+    }
+    return pass_counts;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "software/geom/point.h"
+#include "software/world/robot.h"
+
+/**
+ * A graph of the open passing lanes between a group of robots.
+ *
+ * Every robot is a node, and two robots are connected if a pass between them would not
+ * be blocked by any of the other robots in the group. This is the same criteria used by
+ * findAllReceiverPasserPairs, but the lanes are computed once and can then be queried
+ * repeatedly, e.g. to find how many passes it takes to get the ball to every robot.
+ *
+ * To avoid testing every robot against every lane, the robots are kept sorted by x
+ * coordinate and each lane is only tested against the robots whose x coordinate is
+ * within a robot radius of the lane.
+ */
+class PassingLaneGraph
+{
+   public:
+    /**
+     * Creates a passing lane graph for the given robots
+     *
+     * @param robots The robots that can pass to each other. Each robot is also an
+     * obstacle for passes between the other robots
+     * @param non_blocking_robots Robots that can pass to and receive from the other
+     * robots, but are not obstacles for passes between them. Their IDs must not be the
+     * IDs of any of the robots
+     */
+    explicit PassingLaneGraph(const std::vector<Robot> &robots,
+                              const std::vector<Robot> &non_blocking_robots = {});
+
+    /**
+     * Gets the robots in the graph, ordered by robot ID
+     *
+     * @return the robots in the graph
+     */
+    const std::vector<Robot> &getRobots() const;
+
+    /**
+     * Whether the passing lane between the given robots is open
+     *
+     * @param passer_id The ID of the passing robot
+     * @param receiver_id The ID of the receiving robot
+     *
+     * @return true if the robots are different, both are in the graph and a pass
+     * between them would not be blocked by any other robot in the graph
+     */
+    bool isLaneOpen(RobotId passer_id, RobotId receiver_id) const;
+
+    /**
+     * Gets the robots that the given robot has an open passing lane to
+     *
+     * @param robot_id The ID of the robot
+     *
+     * @return the robots that can be passed to from the given robot, ordered by robot ID
+     */
+    std::vector<Robot> getReceivers(RobotId robot_id) const;
+
+    /**
+     * Returns how many passes it would take for the given passer to pass the ball to the
+     * receiver, and the intermediate passer the receiver is most likely to receive the
+     * ball from. This gives the same result as getNumPassesToRobot.
+     *
+     * The number of passes from each passer to every other robot is cached, so querying
+     * every receiver for the same passer only searches the graph once.
+     *
+     * @param initial_passer_id The ID of the robot the passes start from
+     * @param final_receiver_id The ID of the robot trying to be passed to
+     *
+     * @return a pair containing the number of passes and the intermediate passer, where
+     * the passer is std::nullopt if the passer and receiver are the same robot. If the
+     * receiver can't be passed to at all, returns std::nullopt
+     */
+    std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
+        RobotId initial_passer_id, RobotId final_receiver_id) const;
+
+   private:
+    /**
+     * Computes every passing lane
+     */
+    void build();
+
+    /**
+     * Sorts the robot indices by the x coordinate of the robots
+     */
+    void sortByX();
+
+    /**
+     * Computes whether the passing lane between the given robots is open
+     *
+     * @param i, j The indices of the robots
+     *
+     * @return true if no other robot blocks a pass between the robots
+     */
+    bool computeLaneOpen(size_t i, size_t j) const;
+
+    /**
+     * Gets the index of the robot with the given ID
+     *
+     * @param robot_id The robot ID
+     *
+     * @return the index of the robot, or std::nullopt if it isn't in the graph
+     */
+    std::optional<size_t> indexOf(RobotId robot_id) const;
+
+    /**
+     * Gets the number of passes from the given robot to every robot in the graph,
+     * searching the graph if it isn't cached
+     *
+     * @param source The index of the initial passer
+     *
+     * @return the number of passes to each robot, or -1 if a robot can't be passed to
+     */
+    const std::vector<int> &getPassCounts(size_t source) const;
+
+    // The robots in the graph ordered by ID, their positions, and whether they are
+    // obstacles for the passes between the other robots
+    std::vector<Robot> robots_;
+    std::vector<Point> positions_;
+    std::vector<bool> blocks_lanes_;
+
+    // Robot indices sorted by the x coordinate of their position, and those x
+    // coordinates
+    std::vector<size_t> x_order_;
+    std::vector<double> sorted_x_;
+
+    // Symmetric adjacency matrix, lane_open_[i * n + j] is true if robots i and j can
+    // pass to each other
+    std::vector<bool> lane_open_;
+
+    // The number of passes from each robot to every other robot, computed on demand
+    mutable std::vector<std::vector<int>> pass_counts_;
+};
@@ -0,0 +1,193 @@
+#include "software/ai/evaluation/passing_lane_graph.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/evaluation/enemy_threat.h"
+#include "software/test_util/test_util.h"
+
+class PassingLaneGraphTest : public testing::Test
+{
+   protected:
+    static Robot makeRobot(RobotId id, const Point &position)
+    {
+        return Robot(id, position, Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+
+    static std::vector<Robot> makeRandomRobots(std::mt19937 &random_engine,
+                                               unsigned int num_robots)
+    {
+        std::uniform_real_distribution<double> x_distribution(-4.5, 4.5);
+        std::uniform_real_distribution<double> y_distribution(-3, 3);
+        std::vector<Robot> robots;
+        for (RobotId id = 0; id < num_robots; id++)
+        {
+            robots.emplace_back(makeRobot(
+                id, Point(x_distribution(random_engine), y_distribution(random_engine))));
+        }
+        return robots;
+    }
+
+    // Checks that every lane in the graph matches findAllReceiverPasserPairs
+    static void expectLanesMatchReceiverPasserPairs(const PassingLaneGraph &graph,
+                                                    const std::vector<Robot> &robots)
+    {
+        for (const Robot &passer : robots)
+        {
+            auto receiver_passer_pairs =
+                findAllReceiverPasserPairs({passer}, robots, robots);
+            for (const Robot &receiver : robots)
+            {
+                bool expected_open = passer.id() != receiver.id() &&
+                                     receiver_passer_pairs.count(receiver) > 0;
+                EXPECT_EQ(expected_open, graph.isLaneOpen(passer.id(), receiver.id()))
+                    << "passer " << passer.id() << ", receiver " << receiver.id();
+            }
+        }
+    }
+};
+
+TEST_F(PassingLaneGraphTest, empty_graph)
+{
+    PassingLaneGraph graph({});
+
+    EXPECT_TRUE(graph.getRobots().empty());
+    EXPECT_FALSE(graph.isLaneOpen(0, 1));
+    EXPECT_FALSE(graph.getNumPassesToRobot(0, 1));
+}
+
+TEST_F(PassingLaneGraphTest, lane_blocked_by_robot_in_between)
+{
+    PassingLaneGraph graph({makeRobot(0, Point(0, 0)), makeRobot(1, Point(2, 0)),
+                            makeRobot(2, Point(4, 0))});
+
+    EXPECT_TRUE(graph.isLaneOpen(0, 1));
+    EXPECT_TRUE(graph.isLaneOpen(1, 2));
+    EXPECT_FALSE(graph.isLaneOpen(0, 2));
+    EXPECT_FALSE(graph.isLaneOpen(2, 0));
+    EXPECT_FALSE(graph.isLaneOpen(1, 1));
+
+    auto num_passes = graph.getNumPassesToRobot(0, 2);
+    ASSERT_TRUE(num_passes);
+    EXPECT_EQ(2, num_passes->first);
+    ASSERT_TRUE(num_passes->second);
+    EXPECT_EQ(1, num_passes->second->id());
+}
+
+TEST_F(PassingLaneGraphTest, passing_to_itself_takes_no_passes)
+{
+    PassingLaneGraph graph({makeRobot(0, Point(0, 0)), makeRobot(1, Point(2, 0))});
+
+    auto num_passes = graph.getNumPassesToRobot(1, 1);
+    ASSERT_TRUE(num_passes);
+    EXPECT_EQ(0, num_passes->first);
+    EXPECT_FALSE(num_passes->second);
+}
+
+TEST_F(PassingLaneGraphTest, receiver_gets_ball_from_closest_passer)
+{
+    // Robot 4 blocks the pass from robot 0 to robot 3. Robots 1, 2 and 4 can all pass
+    // to robot 3 after 1 pass from robot 0, but robot 4 is the closest to robot 3
+    PassingLaneGraph graph({makeRobot(0, Point(0, 0)), makeRobot(1, Point(1, 2)),
+                            makeRobot(2, Point(1, -1)), makeRobot(3, Point(2, 0)),
+                            makeRobot(4, Point(1, 0))});
+
+    EXPECT_FALSE(graph.isLaneOpen(0, 3));
+    EXPECT_TRUE(graph.isLaneOpen(1, 3));
+    EXPECT_TRUE(graph.isLaneOpen(2, 3));
+
+    auto num_passes = graph.getNumPassesToRobot(0, 3);
+    ASSERT_TRUE(num_passes);
+    EXPECT_EQ(2, num_passes->first);
+    ASSERT_TRUE(num_passes->second);
+    EXPECT_EQ(4, num_passes->second->id());
+}
+
+TEST_F(PassingLaneGraphTest, lanes_match_find_all_receiver_passer_pairs)
+{
+    std::mt19937 random_engine(0);
+    for (unsigned int i = 0; i < 20; i++)
+    {
+        std::vector<Robot> robots = makeRandomRobots(random_engine, 11);
+        PassingLaneGraph graph(robots);
+        expectLanesMatchReceiverPasserPairs(graph, robots);
+    }
+}
+
+TEST_F(PassingLaneGraphTest, num_passes_matches_search_over_receiver_passer_pairs)
+{
+    std::mt19937 random_engine(1);
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        std::vector<Robot> robots = makeRandomRobots(random_engine, 11);
+        PassingLaneGraph graph(robots);
+        for (const Robot &passer : robots)
+        {
+            // Expand the robots that can be passed to one pass at a time
+            std::map<RobotId, int> expected_num_passes = {{passer.id(), 0}};
+            std::vector<Robot> current_passers         = {passer};
+            for (int num_passes = 1; !current_passers.empty(); num_passes++)
+            {
+                std::vector<Robot> unvisited_robots;
+                for (const Robot &robot : robots)
+                {
+                    if (expected_num_passes.count(robot.id()) == 0)
+                    {
+                        unvisited_robots.emplace_back(robot);
+                    }
+                }
+
+                auto receiver_passer_pairs =
+                    findAllReceiverPasserPairs(current_passers, unvisited_robots, robots);
+                current_passers.clear();
+                for (const auto &[receiver, passers] : receiver_passer_pairs)
+                {
+                    expected_num_passes[receiver.id()] = num_passes;
+                    current_passers.emplace_back(receiver);
+                }
+            }
+
+            for (const Robot &receiver : robots)
+            {
+                auto num_passes = graph.getNumPassesToRobot(passer.id(), receiver.id());
+                if (expected_num_passes.count(receiver.id()) > 0)
+                {
+                    ASSERT_TRUE(num_passes);
+                    EXPECT_EQ(expected_num_passes.at(receiver.id()), num_passes->first);
+                }
+                else
+                {
+                    EXPECT_FALSE(num_passes);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(PassingLaneGraphTest, non_blocking_robot_does_not_block_lanes)
+{
+    PassingLaneGraph graph({makeRobot(0, Point(0, 0)), makeRobot(1, Point(2, 0))},
+                           {makeRobot(2, Point(1, 0))});
+
+    EXPECT_EQ(3, graph.getRobots().size());
+    EXPECT_TRUE(graph.isLaneOpen(0, 1));
+    EXPECT_TRUE(graph.isLaneOpen(2, 0));
+    EXPECT_TRUE(graph.isLaneOpen(2, 1));
+}
+
+TEST_F(PassingLaneGraphTest, lanes_of_non_blocking_robot_are_blocked_by_other_robots)
+{
+    PassingLaneGraph graph({makeRobot(0, Point(1, 0)), makeRobot(1, Point(2, 0))},
+                           {makeRobot(2, Point(0, 0))});
+
+    EXPECT_TRUE(graph.isLaneOpen(2, 0));
+    EXPECT_FALSE(graph.isLaneOpen(2, 1));
+
+    auto num_passes = graph.getNumPassesToRobot(2, 1);
+    ASSERT_TRUE(num_passes);
+    EXPECT_EQ(2, num_passes->first);
+    ASSERT_TRUE(num_passes->second);
+    EXPECT_EQ(0, num_passes->second->id());
+}
@@ -13,18 +13,19 @@ std::optional<Robot> getRobotWithEffectiveBallPossession(const Team &team,
         return std::nullopt;
     }
 
-    auto best_intercept =
-        findBestInterceptForBall(ball, field, team.getAllRobots().at(0));
-    auto baller_robot = team.getAllRobots().at(0);
+    const std::vector<Robot> &robots = team.getAllRobots();
+    auto intercepts                  = findEarliestInterceptsForBall(ball, field, robots);
 
     // Find the robot that can intercept the ball the quickest
-    for (const auto &robot : team.getAllRobots())
+    std::optional<std::pair<Point, Duration>> best_intercept;
+    auto baller_robot = robots.at(0);
+    for (size_t i = 0; i < robots.size(); i++)
     {
-        auto intercept = findBestInterceptForBall(ball, field, robot);
-        if (!best_intercept || (intercept && intercept->second < best_intercept->second))
+        if (intercepts[i] &&
+            (!best_intercept || intercepts[i]->second < best_intercept->second))
         {
-            best_intercept = intercept;
-            baller_robot   = robot;
+            best_intercept = intercepts[i];
+            baller_robot   = robots[i];
         }
     }
 
@@ -40,3 +41,18 @@ std::optional<Robot> getRobotWithEffectiveBallPossession(const Team &team,
         return team.getNearestRobot(ball.position());
     }
 }
+
+std::optional<Robot> getRobotWithEffectiveBallPossession(const World &world,
+                                                         TeamType team_type)
+{
+    return world.evaluationCache().getOrCompute(
+        "getRobotWithEffectiveBallPossession",
+        WorldEvaluationCache::makeKey(static_cast<int>(team_type)),
+        [&]()
+        {
+            const Team &team = team_type == TeamType::FRIENDLY ? world.friendlyTeam()
+                                                               : world.enemyTeam();
+            return getRobotWithEffectiveBallPossession(team, world.ball(),
+                                                       world.field());
+        });
+}
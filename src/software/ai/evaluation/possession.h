@@ -18,3 +18,15 @@
 std::optional<Robot> getRobotWithEffectiveBallPossession(const Team &team,
                                                          const Ball &ball,
                                                          const Field &field);
+
+/**
+ * Returns the robot on the given team of the World that either has the ball, or is the
+ * closest to having it. The result is cached in the World's evaluation cache
+ *
+ * @param world The World
+ * @param team_type Which team of the World to check for possession
+ * @return the robot that either has the ball, or is the closest to having it. If the
+ * team has no robots, std::nullopt is returned
+ */
+std::optional<Robot> getRobotWithEffectiveBallPossession(const World &world,
+                                                         TeamType team_type);
@@ -32,9 +32,7 @@ bool DefensePlayFSM::shouldDefendAggressively(const Update& event)
 
 void DefensePlayFSM::blockShots(const Update& event)
 {
-    auto enemy_threats = getAllEnemyThreats(
-        event.common.world_ptr->field(), event.common.world_ptr->friendlyTeam(),
-        event.common.world_ptr->enemyTeam(), event.common.world_ptr->ball(), false);
+    auto enemy_threats = getAllEnemyThreats(*event.common.world_ptr, false);
 
     updateCreaseAndPassDefenders(event, enemy_threats);
     updateShadowers(event, {});
@@ -44,9 +42,7 @@ void DefensePlayFSM::blockShots(const Update& event)
 
 void DefensePlayFSM::shadowAndBlockShots(const Update& event)
 {
-    auto enemy_threats = getAllEnemyThreats(
-        event.common.world_ptr->field(), event.common.world_ptr->friendlyTeam(),
-        event.common.world_ptr->enemyTeam(), event.common.world_ptr->ball(), false);
+    auto enemy_threats = getAllEnemyThreats(*event.common.world_ptr, false);
 
     updateCreaseAndPassDefenders(event, enemy_threats);
 
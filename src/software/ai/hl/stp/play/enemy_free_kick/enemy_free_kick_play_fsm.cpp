@@ -38,12 +38,10 @@ void EnemyFreeKickPlayFSM::setTactics(const Update& event, unsigned int num_tact
     PriorityTacticVector tactics_to_return = {{}, {}, {}};
     Point block_kick_point;
 
-    auto enemy_threats = getAllEnemyThreats(
-        event.common.world_ptr->field(), event.common.world_ptr->friendlyTeam(),
-        event.common.world_ptr->enemyTeam(), event.common.world_ptr->ball(), false);
+    auto enemy_threats = getAllEnemyThreats(*event.common.world_ptr, false);
 
     auto assignments = getAllDefenderAssignments(
-        enemy_threats, event.common.world_ptr->field(), event.common.world_ptr->ball(),
+        *event.common.world_ptr, false,
         ai_config_ptr->defense_play_config().defender_assignment_config());
 
     if (assignments.size() == 0)
@@ -131,9 +131,7 @@ void FreeKickPlayFSM::updateAlignToBallTactic(const WorldPtr &world_ptr)
 
 bool FreeKickPlayFSM::shotFound(const Update &event)
 {
-    shot = calcBestShotOnGoal(event.common.world_ptr->field(),
-                              event.common.world_ptr->friendlyTeam(),
-                              event.common.world_ptr->enemyTeam(),
+    shot = calcBestShotOnGoal(*event.common.world_ptr,
                               event.common.world_ptr->ball().position(), TeamType::ENEMY);
     return shot.has_value() &&
            shot->getOpenAngle() >
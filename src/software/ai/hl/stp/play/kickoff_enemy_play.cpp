@@ -93,9 +93,7 @@ void KickoffEnemyPlay::getNextTactics(TacticCoroutine::push_type &yield,
             LOG(WARNING) << "No Robot on the Field!";
         }
 
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+        auto enemy_threats = getAllEnemyThreats(*world_ptr, false);
 
         PriorityTacticVector result = {{}};
 
@@ -83,9 +83,7 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
     // Part 1: setup state (move to key positions)
     while (world_ptr->gameState().isSetupState())
     {
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+        auto enemy_threats = getAllEnemyThreats(*world_ptr, false);
 
         PriorityTacticVector result = {{}};
 
@@ -108,9 +106,7 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
     // Part 2: not normal play, currently ready state (chip the ball)
     while (!world_ptr->gameState().isPlaying())
     {
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+        auto enemy_threats = getAllEnemyThreats(*world_ptr, false);
 
         PriorityTacticVector result = {{}};
 
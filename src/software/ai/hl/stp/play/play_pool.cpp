@@ -0,0 +1,78 @@
+#include "software/ai/hl/stp/play/play_pool.h"
+
+#include "software/ai/hl/stp/play/play_factory.h"
+#include "software/metrics/scoped_metrics_timer.h"
+
+PlayPool::PlayPool(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr,
+                   const std::vector<TbotsProto::PlayName>& play_names,
+                   MetricsRegistry& registry)
+    : ai_config_ptr(ai_config_ptr),
+      construction_duration(
+          registry.getHistogram("ai.play_pool.construction_duration_ns")),
+      reset_duration(registry.getHistogram("ai.play_pool.reset_duration_ns")),
+      acquire_duration(registry.getHistogram("ai.play_pool.acquire_duration_ns")),
+      misses(registry.getCounter("ai.play_pool.misses"))
+{
+    for (TbotsProto::PlayName play_name : play_names)
+    {
+        ScopedMetricsTimer timer(construction_duration);
+        ready_plays[play_name] = createPooledPlay(play_name);
+    }
+}
+
+std::unique_ptr<Play> PlayPool::acquire(TbotsProto::PlayName play_name)
+{
+    ScopedMetricsTimer timer(acquire_duration);
+
+    auto ready_play_iter = ready_plays.find(play_name);
+    if (ready_play_iter != ready_plays.end() && ready_play_iter->second)
+    {
+        return std::move(ready_play_iter->second);
+    }
+
+    misses.increment();
+    return createPooledPlay(play_name);
+}
+
+void PlayPool::release(std::unique_ptr<Play> play)
+{
+    if (play)
+    {
+        retired_plays.emplace_back(std::move(play));
+    }
+}
+
+void PlayPool::invalidate()
+{
+    for (auto& [play_name, play] : ready_plays)
+    {
+        release(std::move(play));
+    }
+}
+
+void PlayPool::refill()
+{
+    retired_plays.clear();
+
+    for (auto& [play_name, play] : ready_plays)
+    {
+        if (!play)
+        {
+            ScopedMetricsTimer timer(reset_duration);
+            play = createPooledPlay(play_name);
+        }
+    }
+}
+
+bool PlayPool::isReady(TbotsProto::PlayName play_name) const
+{
+    auto ready_play_iter = ready_plays.find(play_name);
+    return ready_play_iter != ready_plays.end() && ready_play_iter->second != nullptr;
+}
+
+std::unique_ptr<Play> PlayPool::createPooledPlay(TbotsProto::PlayName play_name) const
+{
+    TbotsProto::Play play_proto;
+    play_proto.set_name(play_name);
+    return createPlay(play_proto, ai_config_ptr);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "proto/play.pb.h"
+#include "software/ai/hl/stp/play/play.h"
+#include "software/metrics/metrics_registry.h"
+
+/**
+ * A pool of plays that are built before they are needed, so switching plays does not
+ * have to build the new play on the AI tick that switches to it.
+ *
+ * The pool holds one ready to run instance of each of its play types. Acquiring a play
+ * hands out that instance, and releasing a play retires it. A retired play still has
+ * the state of its last run, so it is reset by replacing it with a new instance of the
+ * same type when the pool is refilled. Refilling should happen after the primitives of
+ * a tick were sent, so neither building nor destroying plays delays them.
+ *
+ * The time it takes to build the plays is recorded into the
+ * "ai.play_pool.construction_duration_ns" (the first time) and
+ * "ai.play_pool.reset_duration_ns" (when a retired play is replaced) histograms, and
+ * the time it takes to acquire a play into "ai.play_pool.acquire_duration_ns". Plays
+ * that had to be built on acquisition because they were not in the pool are counted
+ * in "ai.play_pool.misses".
+ */
+class PlayPool
+{
+   public:
+    /**
+     * Creates a PlayPool and builds an instance of each of the given play types
+     *
+     * @param ai_config_ptr shared pointer to ai_config, used to build the plays
+     * @param play_names The types of plays to keep in the pool
+     * @param registry The registry to record the cost of building plays into
+     */
+    explicit PlayPool(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr,
+                      const std::vector<TbotsProto::PlayName>& play_names,
+                      MetricsRegistry& registry = MetricsRegistry::global());
+
+    PlayPool()                           = delete;
+    PlayPool(const PlayPool&)            = delete;
+    PlayPool& operator=(const PlayPool&) = delete;
+
+    /**
+     * Takes a play of the given type out of the pool, building it if the pool does not
+     * have one ready
+     *
+     * @param play_name The type of play to acquire
+     *
+     * @return a play of the given type that has not been run yet
+     */
+    std::unique_ptr<Play> acquire(TbotsProto::PlayName play_name);
+
+    /**
+     * Gives a play that is no longer run back to the pool. The play is destroyed, and
+     * replaced if its type is pooled, the next time the pool is refilled.
+     *
+     * @param play The play to retire, may be null
+     */
+    void release(std::unique_ptr<Play> play);
+
+    /**
+     * Retires every play in the pool so they are rebuilt the next time the pool is
+     * refilled, e.g. because the AI config they copied when they were built changed
+     */
+    void invalidate();
+
+    /**
+     * Destroys the retired plays and builds a new instance of each pooled play type
+     * that is not ready
+     */
+    void refill();
+
+    /**
+     * Returns whether a play of the given type is ready to be acquired
+     *
+     * @param play_name The type of play
+     *
+     * @return true if the pool has a play of the given type ready, false otherwise
+     */
+    bool isReady(TbotsProto::PlayName play_name) const;
+
+   private:
+    /**
+     * Builds a new play of the given type
+     *
+     * @param play_name The type of play
+     *
+     * @return the new play
+     */
+    std::unique_ptr<Play> createPooledPlay(TbotsProto::PlayName play_name) const;
+
+    std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr;
+
+    // The play ready to be acquired for each pooled play type, or null if it has been
+    // acquired and not rebuilt yet
+    std::map<TbotsProto::PlayName, std::unique_ptr<Play>> ready_plays;
+
+    // Plays that were released or invalidated and have yet to be destroyed
+    std::vector<std::unique_ptr<Play>> retired_plays;
+
+    MetricsHistogram& construction_duration;
+    MetricsHistogram& reset_duration;
+    MetricsHistogram& acquire_duration;
+    MetricsCounter& misses;
+};
@@ -0,0 +1,81 @@
+#include "software/ai/hl/stp/play/play_pool.h"
+
+#include <gtest/gtest.h>
+
+#include "software/util/typename/typename.h"
+
+class PlayPoolTest : public testing::Test
+{
+   protected:
+    std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr =
+        std::make_shared<TbotsProto::AiConfig>();
+    MetricsRegistry registry;
+    PlayPool play_pool{ai_config_ptr,
+                       {TbotsProto::PlayName::HaltPlay, TbotsProto::PlayName::StopPlay},
+                       registry};
+};
+
+TEST_F(PlayPoolTest, builds_each_play_type_on_construction)
+{
+    EXPECT_TRUE(play_pool.isReady(TbotsProto::PlayName::HaltPlay));
+    EXPECT_TRUE(play_pool.isReady(TbotsProto::PlayName::StopPlay));
+    EXPECT_FALSE(play_pool.isReady(TbotsProto::PlayName::OffensePlay));
+    EXPECT_EQ(2, registry.getHistogram("ai.play_pool.construction_duration_ns")
+                     .getNumSamples());
+}
+
+TEST_F(PlayPoolTest, acquire_hands_out_the_pooled_play)
+{
+    std::unique_ptr<Play> play = play_pool.acquire(TbotsProto::PlayName::StopPlay);
+
+    ASSERT_NE(nullptr, play);
+    EXPECT_EQ("StopPlay", objectTypeName(*play));
+    EXPECT_FALSE(play_pool.isReady(TbotsProto::PlayName::StopPlay));
+    EXPECT_EQ(0, registry.getCounter("ai.play_pool.misses").getValue());
+}
+
+TEST_F(PlayPoolTest, acquire_builds_play_that_is_not_ready)
+{
+    std::unique_ptr<Play> first_play =
+        play_pool.acquire(TbotsProto::PlayName::HaltPlay);
+    std::unique_ptr<Play> second_play =
+        play_pool.acquire(TbotsProto::PlayName::HaltPlay);
+    std::unique_ptr<Play> unpooled_play =
+        play_pool.acquire(TbotsProto::PlayName::ExamplePlay);
+
+    ASSERT_NE(nullptr, second_play);
+    EXPECT_NE(first_play, second_play);
+    EXPECT_EQ("HaltPlay", objectTypeName(*second_play));
+    ASSERT_NE(nullptr, unpooled_play);
+    EXPECT_EQ("ExamplePlay", objectTypeName(*unpooled_play));
+    EXPECT_EQ(2, registry.getCounter("ai.play_pool.misses").getValue());
+}
+
+TEST_F(PlayPoolTest, refill_replaces_acquired_plays_with_new_ones)
+{
+    play_pool.release(play_pool.acquire(TbotsProto::PlayName::HaltPlay));
+
+    EXPECT_FALSE(play_pool.isReady(TbotsProto::PlayName::HaltPlay));
+
+    play_pool.refill();
+
+    EXPECT_TRUE(play_pool.isReady(TbotsProto::PlayName::HaltPlay));
+    EXPECT_EQ(1, registry.getHistogram("ai.play_pool.reset_duration_ns")
+                     .getNumSamples());
+    EXPECT_EQ(0, registry.getCounter("ai.play_pool.misses").getValue());
+}
+
+TEST_F(PlayPoolTest, invalidate_rebuilds_all_plays_on_refill)
+{
+    play_pool.invalidate();
+
+    EXPECT_FALSE(play_pool.isReady(TbotsProto::PlayName::HaltPlay));
+    EXPECT_FALSE(play_pool.isReady(TbotsProto::PlayName::StopPlay));
+
+    play_pool.refill();
+
+    EXPECT_TRUE(play_pool.isReady(TbotsProto::PlayName::HaltPlay));
+    EXPECT_TRUE(play_pool.isReady(TbotsProto::PlayName::StopPlay));
+    EXPECT_EQ(2, registry.getHistogram("ai.play_pool.reset_duration_ns")
+                     .getNumSamples());
+}
@@ -38,10 +38,9 @@ void AttackerTactic::updatePrimitive(const TacticUpdate& tactic_update, bool res
         fsm_map[tactic_update.robot.id()] = fsmInit();
     }
 
-    control_params.shot = calcBestShotOnGoal(
-        tactic_update.world_ptr->field(), tactic_update.world_ptr->friendlyTeam(),
-        tactic_update.world_ptr->enemyTeam(), tactic_update.world_ptr->ball().position(),
-        TeamType::ENEMY, {tactic_update.robot});
+    control_params.shot = calcBestShotOnGoal(*tactic_update.world_ptr,
+                                             tactic_update.world_ptr->ball().position(),
+                                             TeamType::ENEMY, {tactic_update.robot});
     if (control_params.shot &&
         control_params.shot->getOpenAngle() <
             Angle::fromDegrees(
@@ -80,40 +80,46 @@ def test_crease_positioning(
             AssignedTacticPlayControlParams, params
         )
 
+    field = tbots_cpp.Field.createSSLDivisionBField()
+    validation_spec_set = ValidationSpecSet()
+
     # Always Validation
+    # The crease defender should never enter the defense area or the enemy half
+    robot_in_regions = (
+        validation_spec_set.always_validation_sequences.add()
+        .validations.add(negate=True)
+        .predicate.friendly_robots_in_regions
+    )
+    robot_in_regions.regions.extend(
+        [
+            tbots_cpp.createPolygonProto(field.friendlyDefenseArea()),
+            tbots_cpp.createPolygonProto(field.enemyHalf()),
+        ]
+    )
+
     always_validation_sequence_set = [
         [
-            RobotNeverEntersRegion(
-                regions=[
-                    tbots_cpp.Field.createSSLDivisionBField().friendlyDefenseArea(),
-                    tbots_cpp.Field.createSSLDivisionBField().enemyHalf(),
-                    tbots_cpp.Circle(ball_initial_pos, 1),
-                ]
-            ),
+            RobotNeverEntersRegion(regions=[tbots_cpp.Circle(ball_initial_pos, 1)]),
             NeverExcessivelyDribbles(),
         ]
     ]
 
     # Eventually Validation
-    eventually_validation_sequence_set = [
-        [
-            # Crease defender should be near the defense area
-            RobotEventuallyEntersRegion(
-                regions=[
-                    tbots_cpp.Field.createSSLDivisionBField()
-                    .friendlyDefenseArea()
-                    .expand(0.25)
-                ]
-            ),
-        ]
-    ]
+    # Crease defender should be near the defense area
+    robot_near_defense_area = (
+        validation_spec_set.eventually_validation_sequences.add()
+        .validations.add()
+        .predicate.friendly_robots_in_regions
+    )
+    robot_near_defense_area.regions.append(
+        tbots_cpp.createPolygonProto(field.friendlyDefenseArea().expand(0.25))
+    )
 
     simulated_test_runner.run_test(
         setup=setup,
-        inv_eventually_validation_sequence_set=eventually_validation_sequence_set,
         inv_always_validation_sequence_set=always_validation_sequence_set,
-        ag_eventually_validation_sequence_set=eventually_validation_sequence_set,
         ag_always_validation_sequence_set=always_validation_sequence_set,
+        validation_spec_set=validation_spec_set,
         test_timeout_s=4,
     )
 
@@ -40,20 +40,20 @@ INSTANTIATE_TEST_CASE_P(
             {Point(2, 2.5), Point(2, 2), Point(2, 1.5), Point(2, 1), Point(2, 0.5),
              Point(2, 0), Point(2, -0.5), Point(2, -1), Point(2, -1.5), Point(2, -2),
              Point(2, -2.5)},
-            Field::createSSLDivisionBField().enemyHalf()),
+            Rectangle(Field::createSSLDivisionBField().enemyHalf())),
         // Wall of enemies in friendly half
         std::make_tuple<std::vector<Point>, Rectangle>(
             {Point(-2, 2.5), Point(-2, 2), Point(-2, 1.5), Point(-2, 1), Point(-2, 0.5),
              Point(-2, 0), Point(-2, -0.5), Point(-2, -1), Point(-2, -1.5), Point(-2, -2),
              Point(-2, -2.5)},
-            Field::createSSLDivisionBField().friendlyHalf()),
+            Rectangle(Field::createSSLDivisionBField().friendlyHalf())),
         // Wall of enemies in friendlyPositiveYQuadrant
         std::make_tuple<std::vector<Point>, Rectangle>(
             {Point(2, 2.5), Point(2, 2), Point(2, 1.5), Point(2, 1), Point(2, 0.5),
              Point(2, 0)},
-            Field::createSSLDivisionBField().friendlyPositiveYQuadrant()),
+            Rectangle(Field::createSSLDivisionBField().friendlyPositiveYQuadrant())),
         // Wall of enemies in friendlyNegativeYQuadrant
         std::make_tuple<std::vector<Point>, Rectangle>(
             {Point(2, -2.5), Point(2, -2), Point(2, -1.5), Point(2, -1), Point(2, -0.5),
              Point(2, 0)},
-            Field::createSSLDivisionBField().friendlyNegativeYQuadrant())));
+            Rectangle(Field::createSSLDivisionBField().friendlyNegativeYQuadrant()))));
@@ -4,6 +4,7 @@
 
 #include <utility>
 
+#include "proto/message_translation/tbots_geometry.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/simulated_tests/simulated_er_force_sim_play_test_fixture.h"
 #include "software/simulated_tests/terminating_validation_functions/ball_kicked_validation.h"
@@ -80,28 +81,27 @@ TEST_F(MoveTacticTest, test_autochip_move)
                                 TbotsProto::ObstacleAvoidanceMode::SAFE);
     setTactic(1, tactic);
 
-    std::vector<ValidationFunction> terminating_validation_functions = {
-        [destination, tactic](std::shared_ptr<World> world_ptr,
-                              ValidationCoroutine::push_type& yield)
-        {
-            while (!tactic->done())
-            {
-                yield("Tactic not done");
-            }
-            robotAtPosition(1, world_ptr, destination, 0.05, yield);
-            ballKicked(Angle::zero(), world_ptr, yield);
-            // Check that conditions hold for 1000 ticks
-            unsigned num_ticks = 1000;
-            for (unsigned i = 0; i < num_ticks; i++)
-            {
-                robotAtPosition(1, world_ptr, destination, 0.05, yield);
-            }
-        }};
-
-    std::vector<ValidationFunction> non_terminating_validation_functions = {};
-
-    runTest(field_type, ball_state, friendly_robots, enemy_robots,
-            terminating_validation_functions, non_terminating_validation_functions,
+    // Robot 1 has to reach the destination, then chip the ball forward
+    TbotsProto::ValidationSpecSet validation_spec_set;
+    TbotsProto::ValidationSpecSequence* sequence =
+        validation_spec_set.add_eventually_validation_sequences();
+    TbotsProto::FriendlyRobotsInRegionsPredicate* robot_at_destination =
+        sequence->add_validations()
+            ->mutable_predicate()
+            ->mutable_friendly_robots_in_regions();
+    robot_at_destination->set_robot_id(1);
+    *robot_at_destination->add_regions() = *createPolygonProto(
+        Rectangle(destination - Vector(0.05, 0.05), destination + Vector(0.05, 0.05)));
+    sequence->add_validations()
+        ->mutable_predicate()
+        ->mutable_ball_speed_at_or_above()
+        ->set_speed_threshold_m_per_s(0.5);
+    TbotsProto::BallInRegionsPredicate* ball_chipped_forward =
+        sequence->add_validations()->mutable_predicate()->mutable_ball_in_regions();
+    *ball_chipped_forward->add_regions() = *createPolygonProto(
+        Rectangle(destination + Vector(0.5, -0.5), destination + Vector(4.5, 0.5)));
+
+    runTest(field_type, ball_state, friendly_robots, enemy_robots, validation_spec_set,
             Duration::fromSeconds(10));
 }
 
@@ -4,8 +4,51 @@
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/primitive/primitive_msg_factory.h"
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_1d_angular.h"
+#include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/end_in_obstacle_sample.h"
 
+namespace
+{
+/**
+ * Finds a point near the given point that is outside of the field obstacles. The
+ * nearest point outside of the static obstacles is looked up in their distance field in
+ * constant time, and points around the given point are only sampled if there is no
+ * distance field or the point it finds is in another obstacle
+ *
+ * @param field_obstacle_set The field obstacles
+ * @param static_obstacle_distance_field The distance field of the static field
+ * obstacles, or nullptr if it has not been created yet
+ * @param point The point to move out of the field obstacles
+ * @param navigable_area The area the returned point must be inside of
+ *
+ * @return the given point if it is not in an obstacle, otherwise a nearby point outside
+ * of the field obstacles, or std::nullopt if no such point was found
+ */
+std::optional<Point> findPointOutsideFieldObstacles(
+    const ObstacleSet &field_obstacle_set,
+    const std::shared_ptr<const ObstacleDistanceField> &static_obstacle_distance_field,
+    const Point &point, const Rectangle &navigable_area)
+{
+    if (contains(navigable_area, point) && !field_obstacle_set.contains(point))
+    {
+        return point;
+    }
+
+    if (static_obstacle_distance_field)
+    {
+        std::optional<Point> free_point =
+            static_obstacle_distance_field->nearestFreePoint(point);
+        if (free_point.has_value() && contains(navigable_area, free_point.value()) &&
+            !field_obstacle_set.contains(free_point.value()))
+        {
+            return free_point;
+        }
+    }
+
+    return endInObstacleSample(field_obstacle_set, point, navigable_area);
+}
+}  // namespace
+
 MovePrimitive::MovePrimitive(
     const Robot &robot, const Point &destination, const Angle &final_angle,
     const TbotsProto::MaxAllowedSpeedMode &max_allowed_speed_mode,
@@ -67,10 +110,18 @@ MovePrimitive::generatePrimitiveProtoMessage(
     //  passed to the planner.
     Rectangle navigable_area = world.field().fieldBoundary();
 
+    // The field obstacles that only depend on the field geometry are checked with a
+    // cached distance field once it has been created, so points far from them are
+    // checked, and points in them are moved out, in constant time
+    std::shared_ptr<const ObstacleDistanceField> static_obstacle_distance_field =
+        obstacle_factory.getStaticObstacleDistanceField(motion_constraints, world);
+
     // If the robot is in a static obstacle, then we should first move to the nearest
     // point out
-    std::optional<Point> updated_start_position =
-        endInObstacleSample(field_obstacles, robot.position(), navigable_area);
+    ObstacleSet field_obstacle_set(field_obstacles, static_obstacle_distance_field);
+    std::optional<Point> updated_start_position = findPointOutsideFieldObstacles(
+        field_obstacle_set, static_obstacle_distance_field, robot.position(),
+        navigable_area);
     if (updated_start_position.has_value() &&
         updated_start_position.value() != robot.position())
     {
@@ -78,8 +129,9 @@ MovePrimitive::generatePrimitiveProtoMessage(
     }
     else
     {
-        std::optional<Point> updated_destination =
-            endInObstacleSample(field_obstacles, destination, navigable_area);
+        std::optional<Point> updated_destination = findPointOutsideFieldObstacles(
+            field_obstacle_set, static_obstacle_distance_field, destination,
+            navigable_area);
         if (updated_destination.has_value())
         {
             // Update the destination. Note that this may be the same as the original
@@ -107,9 +159,10 @@ MovePrimitive::generatePrimitiveProtoMessage(
         }
     }
 
-    traj_path = planner.findTrajectory(robot.position(), destination, robot.velocity(),
-                                       constraints, obstacles, navigable_area,
-                                       prev_sub_destination);
+    traj_path = planner.findTrajectory(
+        robot.position(), destination, robot.velocity(), constraints,
+        ObstacleSet(obstacles, static_obstacle_distance_field), navigable_area,
+        prev_sub_destination);
 
     if (!traj_path.has_value())
     {
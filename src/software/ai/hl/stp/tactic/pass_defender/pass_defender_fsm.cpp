@@ -77,27 +77,21 @@ void PassDefenderFSM::interceptBall(const Update& event)
             intercept_position = closestPoint(
                 robot_position, Line(ball.position(), ball.position() + ball.velocity()));
 
-            // Here we are using v_f^2=v_0^2+2*a*d to calculate the final
-            // speed and after that the average speed
-            double ball_vel = (event.common.world_ptr->ball().velocity().length());
-            double ball_dis =
-                (event.common.world_ptr->ball().position() - intercept_position).length();
-            double final_vel =
-                sqrt(ball_vel * ball_vel +
-                     2 * ball_dis *
-                         BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED);
-            double avg_vel               = (final_vel + ball_vel) / 2.0;
-            Duration ball_intercept_time = Duration::fromSeconds(
-                ball_dis / (std::max(std::numeric_limits<double>::epsilon(), avg_vel)));
+            // Find when the ball reaches the position along its predicted trajectory,
+            // if it does not stop before then
+            std::optional<Duration> ball_intercept_time =
+                event.common.world_ptr->ballTrajectory()->estimateTimeToTravelDistance(
+                    (ball.position() - intercept_position).length());
 
             // Here we check if we can make it in time to the position and stop in time
             // otherwise we will attempt to overshoot the position and intercept it
-            if (event.common.robot.getTimeToPosition(intercept_position) >
-                ball_intercept_time)
+            if (ball_intercept_time.has_value() &&
+                event.common.robot.getTimeToPosition(intercept_position) >
+                    ball_intercept_time.value())
             {
                 intercept_position = findOvershootInterceptPosition(
                     event.common.robot, intercept_position,
-                    event.common.world_ptr->field(), ball_intercept_time,
+                    event.common.world_ptr->field(), ball_intercept_time.value(),
                     DEFENDER_STEP_SPEED_M_PER_S, false);
             }
         }
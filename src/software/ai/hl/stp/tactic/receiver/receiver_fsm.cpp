@@ -72,9 +72,8 @@ std::optional<Shot> ReceiverFSM::findFeasibleShot(const World& world,
                                                   const Robot& assigned_robot)
 {
     // Check if we can shoot on the enemy goal from the receiver position
-    std::optional<Shot> best_shot_opt =
-        calcBestShotOnGoal(world.field(), world.friendlyTeam(), world.enemyTeam(),
-                           assigned_robot.position(), TeamType::ENEMY, {assigned_robot});
+    std::optional<Shot> best_shot_opt = calcBestShotOnGoal(
+        world, assigned_robot.position(), TeamType::ENEMY, {assigned_robot});
 
     // The percentage of open net the robot would shoot on
     if (best_shot_opt)
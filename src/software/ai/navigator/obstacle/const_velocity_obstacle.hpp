@@ -29,6 +29,21 @@ class ConstVelocityObstacle : public GeomObstacle<GEOM_TYPE>
     double signedDistance(const Point& p, const double t_sec = 0) const override;
     bool intersects(const Segment& segment, const double t_sec = 0) const override;
 
+    /**
+     * Gets the velocity of the obstacle
+     *
+     * @return the velocity
+     */
+    const Vector& getVelocity() const;
+
+    /**
+     * Gets the maximum time into the future the position of the obstacle is predicted
+     * for
+     *
+     * @return the maximum time horizon in seconds
+     */
+    double getMaxTimeHorizonSec() const;
+
    private:
     const Vector velocity_;
     const double max_time_horizon_sec_;
@@ -80,3 +95,15 @@ bool ConstVelocityObstacle<GEOM_TYPE>::intersects(const Segment& segment,
     return ::intersects(this->geom_,
                         segment - velocity_ * std::min(t_sec, max_time_horizon_sec_));
 }
+
+template <typename GEOM_TYPE>
+const Vector& ConstVelocityObstacle<GEOM_TYPE>::getVelocity() const
+{
+    return velocity_;
+}
+
+template <typename GEOM_TYPE>
+double ConstVelocityObstacle<GEOM_TYPE>::getMaxTimeHorizonSec() const
+{
+    return max_time_horizon_sec_;
+}
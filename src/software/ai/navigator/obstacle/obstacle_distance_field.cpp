@@ -0,0 +1,244 @@
+#include "software/ai/navigator/obstacle/obstacle_distance_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// Gets the number of samples needed to cover the given length, including both ends
+size_t numSamples(double length, double resolution)
+{
+    return static_cast<size_t>(std::max(std::ceil(length / resolution), 1.0)) + 1;
+}
+}  // namespace
+
+ObstacleDistanceField::ObstacleDistanceField(const std::vector<ObstaclePtr> &obstacles,
+                                             const Rectangle &area,
+                                             double resolution_meters)
+    : obstacles_(obstacles),
+      area_(area),
+      resolution_meters_(resolution_meters),
+      num_x_samples_(numSamples(area.xLength(), resolution_meters)),
+      num_y_samples_(numSamples(area.yLength(), resolution_meters)),
+      distances_(num_x_samples_ * num_y_samples_,
+                 static_cast<float>(MAX_DISTANCE_METERS))
+{
+    // Converts a coordinate to the index of a sample in the grid
+    auto to_x_index = [&](double x)
+    {
+        return std::clamp((x - area_.xMin()) / resolution_meters_, 0.0,
+                          static_cast<double>(num_x_samples_ - 1));
+    };
+    auto to_y_index = [&](double y)
+    {
+        return std::clamp((y - area_.yMin()) / resolution_meters_, 0.0,
+                          static_cast<double>(num_y_samples_ - 1));
+    };
+
+    // Samples outside the bounding box of an obstacle expanded by the max distance are
+    // further than the max distance from it, so they don't need to be computed
+    for (const ObstaclePtr &obstacle : obstacles_)
+    {
+        Rectangle bounding_box = obstacle->axisAlignedBoundingBox(MAX_DISTANCE_METERS);
+        auto min_x = static_cast<size_t>(std::floor(to_x_index(bounding_box.xMin())));
+        auto max_x = static_cast<size_t>(std::ceil(to_x_index(bounding_box.xMax())));
+        auto min_y = static_cast<size_t>(std::floor(to_y_index(bounding_box.yMin())));
+        auto max_y = static_cast<size_t>(std::ceil(to_y_index(bounding_box.yMax())));
+
+        for (size_t y = min_y; y <= max_y; y++)
+        {
+            for (size_t x = min_x; x <= max_x; x++)
+            {
+                size_t index    = y * num_x_samples_ + x;
+                Point sample    = samplePosition(index);
+                float &distance = distances_[index];
+                distance        = std::min(
+                    distance,
+                    static_cast<float>(std::clamp(obstacle->signedDistance(sample),
+                                                  -MAX_DISTANCE_METERS,
+                                                  MAX_DISTANCE_METERS)));
+            }
+        }
+    }
+
+    computeNearestFreeSamples();
+}
+
+double ObstacleDistanceField::signedDistance(const Point &p) const
+{
+    if (obstacles_.empty())
+    {
+        return std::numeric_limits<double>::max();
+    }
+
+    double x = (p.x() - area_.xMin()) / resolution_meters_;
+    double y = (p.y() - area_.yMin()) / resolution_meters_;
+    if (x < 0 || y < 0 || x > static_cast<double>(num_x_samples_ - 1) ||
+        y > static_cast<double>(num_y_samples_ - 1))
+    {
+        return exactSignedDistance(p);
+    }
+
+    // Bilinearly interpolate between the 4 samples surrounding the point
+    size_t x_index = std::min(static_cast<size_t>(x), num_x_samples_ - 2);
+    size_t y_index = std::min(static_cast<size_t>(y), num_y_samples_ - 2);
+    double x_frac  = x - static_cast<double>(x_index);
+    double y_frac  = y - static_cast<double>(y_index);
+
+    const float *row      = &distances_[y_index * num_x_samples_ + x_index];
+    const float *next_row = row + num_x_samples_;
+    double bottom         = row[0] + (row[1] - row[0]) * x_frac;
+    double top            = next_row[0] + (next_row[1] - next_row[0]) * x_frac;
+    return bottom + (top - bottom) * y_frac;
+}
+
+std::optional<Point> ObstacleDistanceField::nearestFreePoint(const Point &p) const
+{
+    double x = (p.x() - area_.xMin()) / resolution_meters_;
+    double y = (p.y() - area_.yMin()) / resolution_meters_;
+    if (x < 0 || y < 0 || x > static_cast<double>(num_x_samples_ - 1) ||
+        y > static_cast<double>(num_y_samples_ - 1))
+    {
+        return std::nullopt;
+    }
+
+    auto x_index = static_cast<size_t>(std::round(x));
+    auto y_index = static_cast<size_t>(std::round(y));
+    int32_t nearest_free_sample =
+        nearest_free_samples_[y_index * num_x_samples_ + x_index];
+    if (nearest_free_sample == NO_FREE_SAMPLE)
+    {
+        return std::nullopt;
+    }
+    return samplePosition(static_cast<size_t>(nearest_free_sample));
+}
+
+double ObstacleDistanceField::getMaxError() const
+{
+    // Every sample used for interpolation is within a diagonal of a grid cell of the
+    // point, and the float samples add a small rounding error
+    return resolution_meters_ * std::sqrt(2.0) +
+           MAX_DISTANCE_METERS * std::numeric_limits<float>::epsilon();
+}
+
+const std::vector<ObstaclePtr> &ObstacleDistanceField::getObstacles() const
+{
+    return obstacles_;
+}
+
+void ObstacleDistanceField::computeNearestFreeSamples()
+{
+    nearest_free_samples_.assign(distances_.size(), NO_FREE_SAMPLE);
+    for (size_t i = 0; i < distances_.size(); i++)
+    {
+        if (distances_[i] > 0)
+        {
+            nearest_free_samples_[i] = static_cast<int32_t>(i);
+        }
+    }
+
+    // Gets the squared distance in samples from the sample at (x, y) to the given sample
+    auto squared_sample_distance = [&](size_t x, size_t y, int32_t sample)
+    {
+        auto dx = static_cast<int64_t>(x) -
+                  static_cast<int64_t>(static_cast<size_t>(sample) % num_x_samples_);
+        auto dy = static_cast<int64_t>(y) -
+                  static_cast<int64_t>(static_cast<size_t>(sample) / num_x_samples_);
+        return dx * dx + dy * dy;
+    };
+
+    // Takes the nearest free sample of the neighbour at (neighbour_x, neighbour_y) if
+    // it is nearer to the sample at (x, y) than its own nearest free sample
+    auto update_from_neighbour =
+        [&](size_t x, size_t y, size_t neighbour_x, size_t neighbour_y)
+    {
+        int32_t candidate =
+            nearest_free_samples_[neighbour_y * num_x_samples_ + neighbour_x];
+        int32_t &nearest = nearest_free_samples_[y * num_x_samples_ + x];
+        if (candidate != NO_FREE_SAMPLE &&
+            (nearest == NO_FREE_SAMPLE || squared_sample_distance(x, y, candidate) <
+                                              squared_sample_distance(x, y, nearest)))
+        {
+            nearest = candidate;
+        }
+    };
+
+    // Sweep from the bottom row to the top row, taking the nearest free samples from
+    // the row below and from both sides within the row
+    for (size_t y = 0; y < num_y_samples_; y++)
+    {
+        for (size_t x = 0; x < num_x_samples_; x++)
+        {
+            if (y > 0)
+            {
+                if (x > 0)
+                {
+                    update_from_neighbour(x, y, x - 1, y - 1);
+                }
+                update_from_neighbour(x, y, x, y - 1);
+                if (x + 1 < num_x_samples_)
+                {
+                    update_from_neighbour(x, y, x + 1, y - 1);
+                }
+            }
+            if (x > 0)
+            {
+                update_from_neighbour(x, y, x - 1, y);
+            }
+        }
+        for (size_t i = 1; i < num_x_samples_; i++)
+        {
+            size_t x = num_x_samples_ - 1 - i;
+            update_from_neighbour(x, y, x + 1, y);
+        }
+    }
+
+    // Sweep back from the top row to the bottom row, taking the nearest free samples
+    // from the row above and from both sides within the row
+    for (size_t i = 0; i < num_y_samples_; i++)
+    {
+        size_t y = num_y_samples_ - 1 - i;
+        for (size_t j = 0; j < num_x_samples_; j++)
+        {
+            size_t x = num_x_samples_ - 1 - j;
+            if (y + 1 < num_y_samples_)
+            {
+                if (x + 1 < num_x_samples_)
+                {
+                    update_from_neighbour(x, y, x + 1, y + 1);
+                }
+                update_from_neighbour(x, y, x, y + 1);
+                if (x > 0)
+                {
+                    update_from_neighbour(x, y, x - 1, y + 1);
+                }
+            }
+            if (x + 1 < num_x_samples_)
+            {
+                update_from_neighbour(x, y, x + 1, y);
+            }
+        }
+        for (size_t x = 1; x < num_x_samples_; x++)
+        {
+            update_from_neighbour(x, y, x - 1, y);
+        }
+    }
+}
+
+Point ObstacleDistanceField::samplePosition(size_t index) const
+{
+    return Point(
+        area_.xMin() + static_cast<double>(index % num_x_samples_) * resolution_meters_,
+        area_.yMin() + static_cast<double>(index / num_x_samples_) * resolution_meters_);
+}
+
+double ObstacleDistanceField::exactSignedDistance(const Point &p) const
+{
+    double min_signed_distance = std::numeric_limits<double>::max();
+    for (const ObstaclePtr &obstacle : obstacles_)
+    {
+        min_signed_distance = std::min(min_signed_distance, obstacle->signedDistance(p));
+    }
+    return min_signed_distance;
+}
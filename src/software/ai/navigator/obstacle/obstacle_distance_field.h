@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+
+/**
+ * An ObstacleDistanceField is a grid of the signed distance to a list of static
+ * obstacles, sampled over a rectangular area. The signed distance anywhere in the area
+ * is found in constant time by bilinearly interpolating the grid.
+ *
+ * Since the signed distance changes by at most the distance moved, the interpolated
+ * distance is within getMaxError() of the exact signed distance. Distances are only
+ * stored up to MAX_DISTANCE_METERS from the perimeter of the obstacles, so the grid
+ * only needs to be computed near the obstacles.
+ *
+ * The grid also stores the nearest sample outside of the obstacles to each sample, so
+ * the nearest point outside of the obstacles can be found in constant time.
+ *
+ * NOTE: The obstacles must not move over time, since the grid is only computed once
+ */
+class ObstacleDistanceField
+{
+   public:
+    /**
+     * Creates an ObstacleDistanceField for the given obstacles
+     *
+     * @param obstacles The static obstacles to compute the signed distance to
+     * @param area The area to sample the signed distance over
+     * @param resolution_meters The distance between samples of the grid
+     */
+    explicit ObstacleDistanceField(const std::vector<ObstaclePtr> &obstacles,
+                                   const Rectangle &area, double resolution_meters);
+
+    ObstacleDistanceField() = delete;
+
+    /**
+     * Gets the signed distance from the perimeter of the nearest obstacle to the point.
+     * The distance is interpolated from the grid if the point is within the area, and
+     * is computed exactly otherwise
+     *
+     * @param p Point to get distance to
+     *
+     * @return the signed distance, negative if the point is inside an obstacle. The
+     * distance is clamped to [-MAX_DISTANCE_METERS, MAX_DISTANCE_METERS] within the area,
+     * and is the max double if there are no obstacles
+     */
+    double signedDistance(const Point &p) const;
+
+    /**
+     * Gets the nearest sample of the grid to the point that is outside of every
+     * obstacle. The point is rounded to the nearest sample first, so the returned sample
+     * is within about a diagonal of a grid cell of the nearest point outside of the
+     * obstacles
+     *
+     * @param p Point to find the nearest point outside of the obstacles to
+     *
+     * @return the nearest sample outside of every obstacle, or std::nullopt if the point
+     * is outside the area or every sample is inside an obstacle
+     */
+    std::optional<Point> nearestFreePoint(const Point &p) const;
+
+    /**
+     * Gets the maximum difference between signedDistance and the exact signed distance,
+     * within MAX_DISTANCE_METERS of the perimeter of the obstacles
+     *
+     * @return the maximum error of signedDistance
+     */
+    double getMaxError() const;
+
+    /**
+     * Gets the obstacles the distance field was created from
+     *
+     * @return the obstacles
+     */
+    const std::vector<ObstaclePtr> &getObstacles() const;
+
+    // Signed distances further than this from the perimeter of the obstacles are clamped
+    static constexpr double MAX_DISTANCE_METERS = 0.5;
+
+   private:
+    /**
+     * Gets the exact signed distance from the perimeter of the nearest obstacle to the
+     * point
+     *
+     * @param p Point to get distance to
+     *
+     * @return the exact signed distance
+     */
+    double exactSignedDistance(const Point &p) const;
+
+    /**
+     * Finds the nearest sample outside of every obstacle to each sample, by sweeping
+     * the nearest free samples found so far across the grid forwards and backwards
+     */
+    void computeNearestFreeSamples();
+
+    /**
+     * Gets the position of the sample with the given index
+     *
+     * @param index The index of the sample, in row major order with rows along x
+     *
+     * @return the position of the sample
+     */
+    Point samplePosition(size_t index) const;
+
+    std::vector<ObstaclePtr> obstacles_;
+    Rectangle area_;
+    double resolution_meters_;
+    size_t num_x_samples_;
+    size_t num_y_samples_;
+    // The clamped signed distance at each sample, in row major order with rows along x
+    std::vector<float> distances_;
+    // The index of the nearest sample outside of every obstacle to each sample, or
+    // NO_FREE_SAMPLE if there is none
+    std::vector<int32_t> nearest_free_samples_;
+
+    static constexpr int32_t NO_FREE_SAMPLE = -1;
+};
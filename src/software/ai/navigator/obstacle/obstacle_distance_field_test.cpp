@@ -0,0 +1,181 @@
+#include "software/ai/navigator/obstacle/obstacle_distance_field.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+
+#include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/test_util/test_util.h"
+
+class ObstacleDistanceFieldTest : public testing::Test
+{
+   protected:
+    ObstacleDistanceFieldTest() : world(::TestUtil::createBlankTestingWorld())
+    {
+        config.set_robot_obstacle_inflation_factor(1.3);
+        RobotNavigationObstacleFactory obstacle_factory(config);
+
+        for (auto motion_constraint :
+             {TbotsProto::MotionConstraint::CENTER_CIRCLE,
+              TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+              TbotsProto::MotionConstraint::ENEMY_DEFENSE_AREA,
+              TbotsProto::MotionConstraint::AVOID_FIELD_BOUNDARY_ZONE})
+        {
+            auto new_obstacles =
+                obstacle_factory.createObstaclesFromMotionConstraint(motion_constraint,
+                                                                     *world);
+            obstacles.insert(obstacles.end(), new_obstacles.begin(),
+                             new_obstacles.end());
+        }
+    }
+
+    // Gets the exact signed distance from the obstacles to the point
+    double exactSignedDistance(const Point &point) const
+    {
+        double signed_distance = std::numeric_limits<double>::max();
+        for (const ObstaclePtr &obstacle : obstacles)
+        {
+            signed_distance = std::min(signed_distance, obstacle->signedDistance(point));
+        }
+        return signed_distance;
+    }
+
+    std::shared_ptr<World> world;
+    TbotsProto::RobotNavigationObstacleConfig config;
+    std::vector<ObstaclePtr> obstacles;
+};
+
+TEST_F(ObstacleDistanceFieldTest, no_obstacles)
+{
+    ObstacleDistanceField distance_field({}, world->field().fieldBoundary(), 0.02);
+
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              distance_field.signedDistance(Point(0, 0)));
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              distance_field.signedDistance(Point(10, 10)));
+}
+
+TEST_F(ObstacleDistanceFieldTest, interpolated_distance_within_max_error)
+{
+    ObstacleDistanceField distance_field(obstacles, world->field().fieldBoundary(),
+                                         0.02);
+    double max_error = distance_field.getMaxError();
+
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<double> x_distribution(-4.8, 4.8);
+    std::uniform_real_distribution<double> y_distribution(-3.3, 3.3);
+    for (int i = 0; i < 10000; i++)
+    {
+        Point point(x_distribution(random_engine), y_distribution(random_engine));
+        double exact_signed_distance =
+            std::clamp(exactSignedDistance(point),
+                       -ObstacleDistanceField::MAX_DISTANCE_METERS,
+                       ObstacleDistanceField::MAX_DISTANCE_METERS);
+        double signed_distance = distance_field.signedDistance(point);
+
+        EXPECT_NEAR(exact_signed_distance, signed_distance, max_error) << point;
+        if (std::abs(signed_distance) > max_error)
+        {
+            EXPECT_EQ(exact_signed_distance < 0, signed_distance < 0) << point;
+        }
+    }
+}
+
+TEST_F(ObstacleDistanceFieldTest, exact_distance_outside_area)
+{
+    Rectangle area(Point(-1, -1), Point(1, 1));
+    ObstacleDistanceField distance_field(obstacles, area, 0.02);
+
+    for (const Point &point : {Point(-3, 0), Point(4.4, 2.5), Point(0, 10)})
+    {
+        EXPECT_DOUBLE_EQ(exactSignedDistance(point), distance_field.signedDistance(point))
+            << point;
+    }
+}
+
+TEST_F(ObstacleDistanceFieldTest, nearest_free_point_is_nearest_sample_outside_obstacles)
+{
+    // A small area around the friendly defense area, so that every sample can be
+    // checked to find the nearest free sample
+    const double resolution = 0.05;
+    Rectangle area(Point(-4.8, -1.5), Point(-3, 1.5));
+    ObstacleDistanceField distance_field(obstacles, area, resolution);
+
+    std::vector<Point> free_samples;
+    for (double x = area.xMin(); x <= area.xMax() + resolution / 2; x += resolution)
+    {
+        for (double y = area.yMin(); y <= area.yMax() + resolution / 2; y += resolution)
+        {
+            if (exactSignedDistance(Point(x, y)) > 0)
+            {
+                free_samples.emplace_back(x, y);
+            }
+        }
+    }
+
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<double> x_distribution(area.xMin(), area.xMax());
+    std::uniform_real_distribution<double> y_distribution(area.yMin(), area.yMax());
+    for (int i = 0; i < 200; i++)
+    {
+        Point point(x_distribution(random_engine), y_distribution(random_engine));
+        double nearest_free_sample_distance = std::numeric_limits<double>::max();
+        for (const Point &free_sample : free_samples)
+        {
+            nearest_free_sample_distance =
+                std::min(nearest_free_sample_distance, distance(point, free_sample));
+        }
+
+        std::optional<Point> free_point = distance_field.nearestFreePoint(point);
+
+        ASSERT_TRUE(free_point.has_value()) << point;
+        EXPECT_GT(exactSignedDistance(free_point.value()), 0) << point;
+        // The point is rounded to the nearest sample before looking up its nearest
+        // free sample
+        EXPECT_LE(distance(point, free_point.value()),
+                  nearest_free_sample_distance + resolution * std::sqrt(2.0))
+            << point;
+    }
+}
+
+TEST_F(ObstacleDistanceFieldTest, nearest_free_point_of_free_point_is_nearby)
+{
+    ObstacleDistanceField distance_field(obstacles, world->field().fieldBoundary(),
+                                         0.02);
+
+    std::optional<Point> free_point = distance_field.nearestFreePoint(Point(1, 1));
+
+    ASSERT_TRUE(free_point.has_value());
+    EXPECT_LE(distance(Point(1, 1), free_point.value()), 0.02);
+}
+
+TEST_F(ObstacleDistanceFieldTest, no_nearest_free_point_outside_area)
+{
+    ObstacleDistanceField distance_field(obstacles, Rectangle(Point(-1, -1), Point(1, 1)),
+                                         0.02);
+
+    EXPECT_FALSE(distance_field.nearestFreePoint(Point(3, 0)).has_value());
+}
+
+TEST_F(ObstacleDistanceFieldTest, returns_obstacles)
+{
+    ObstacleDistanceField distance_field(obstacles, world->field().fieldBoundary(),
+                                         0.02);
+
+    EXPECT_EQ(obstacles, distance_field.getObstacles());
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name to measure how long it takes to create a distance field
+TEST_F(ObstacleDistanceFieldTest, DISABLED_create_performance)
+{
+    auto start_time = std::chrono::system_clock::now();
+    ObstacleDistanceField distance_field(obstacles, world->field().fieldBoundary(),
+                                         0.02);
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Created a distance field of " << obstacles.size()
+              << " obstacles in " << duration_ms << "ms" << std::endl;
+}
@@ -0,0 +1,322 @@
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <typeinfo>
+
+#include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
+#include "software/ai/navigator/obstacle/geom_obstacle.hpp"
+#include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
+#include "software/geom/algorithms/axis_aligned_bounding_box.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/signed_distance.h"
+#include "software/geom/geom_constants.h"
+
+namespace
+{
+/**
+ * Finds the first entry in the given entries that contains the point, if its index is
+ * lower than the given index
+ *
+ * @param entries The entries to check, sorted by index
+ * @param p Point to check if contained by the entries
+ * @param t_sec Time in seconds into the future to check if point is contained
+ * @param first_index The lowest index of an obstacle found to contain the point so
+ * far. Updated if an entry with a lower index contains the point
+ */
+template <typename ENTRY_TYPE>
+void findFirstContainingEntry(const std::vector<ENTRY_TYPE> &entries, const Point &p,
+                              double t_sec, size_t &first_index)
+{
+    for (const ENTRY_TYPE &entry : entries)
+    {
+        if (entry.index >= first_index)
+        {
+            return;
+        }
+        if (entry.contains(p, t_sec))
+        {
+            first_index = entry.index;
+            return;
+        }
+    }
+}
+}  // namespace
+
+ObstacleSet::ObstacleSet(const std::vector<ObstaclePtr> &obstacles)
+    : ObstacleSet(obstacles, nullptr)
+{
+}
+
+ObstacleSet::ObstacleSet(const std::vector<ObstaclePtr> &obstacles,
+                         std::shared_ptr<const ObstacleDistanceField> distance_field)
+    : obstacles_(obstacles), distance_field_(std::move(distance_field))
+{
+    // The distance field may have been created from an earlier list of obstacles. It
+    // can only be used if it has no obstacles other than the given ones
+    if (distance_field_ &&
+        !std::all_of(distance_field_->getObstacles().begin(),
+                     distance_field_->getObstacles().end(),
+                     [&](const ObstaclePtr &obstacle)
+                     {
+                         return std::find(obstacles_.begin(), obstacles_.end(),
+                                          obstacle) != obstacles_.end();
+                     }))
+    {
+        distance_field_ = nullptr;
+    }
+
+    if (!distance_field_)
+    {
+        for (size_t i = 0; i < obstacles_.size(); i++)
+        {
+            entries_.add(*obstacles_[i], i);
+        }
+        return;
+    }
+
+    const std::vector<ObstaclePtr> &distance_field_obstacles =
+        distance_field_->getObstacles();
+    for (size_t i = 0; i < obstacles_.size(); i++)
+    {
+        if (std::find(distance_field_obstacles.begin(), distance_field_obstacles.end(),
+                      obstacles_[i]) != distance_field_obstacles.end())
+        {
+            distance_field_entries_.add(*obstacles_[i], i);
+        }
+        else
+        {
+            entries_.add(*obstacles_[i], i);
+        }
+    }
+}
+
+bool ObstacleSet::contains(const Point &p, const double t_sec) const
+{
+    if (distance_field_)
+    {
+        // Only check the obstacles in the distance field exactly if the distance
+        // field is too close to their perimeter to tell if they contain the point
+        double distance  = distance_field_->signedDistance(p);
+        double max_error = distance_field_->getMaxError();
+        if (distance < -max_error ||
+            (distance <= max_error && distance_field_entries_.contains(p, t_sec)))
+        {
+            return true;
+        }
+    }
+    return entries_.contains(p, t_sec);
+}
+
+ObstaclePtr ObstacleSet::findContainingObstacle(const Point &p, const double t_sec) const
+{
+    size_t first_index = obstacles_.size();
+    entries_.findFirstContaining(p, t_sec, first_index);
+    if (distance_field_ &&
+        distance_field_->signedDistance(p) <= distance_field_->getMaxError())
+    {
+        distance_field_entries_.findFirstContaining(p, t_sec, first_index);
+    }
+
+    if (first_index == obstacles_.size())
+    {
+        return nullptr;
+    }
+    return obstacles_[first_index];
+}
+
+double ObstacleSet::signedDistance(const Point &p, const double t_sec) const
+{
+    double min_signed_distance = entries_.signedDistance(p, t_sec);
+    if (distance_field_)
+    {
+        double distance = distance_field_->signedDistance(p);
+        if (std::abs(distance) <= distance_field_->getMaxError())
+        {
+            distance = distance_field_entries_.signedDistance(p, t_sec);
+        }
+        min_signed_distance = std::min(min_signed_distance, distance);
+    }
+    return min_signed_distance;
+}
+
+const std::vector<ObstaclePtr> &ObstacleSet::getObstacles() const
+{
+    return obstacles_;
+}
+
+size_t ObstacleSet::size() const
+{
+    return obstacles_.size();
+}
+
+bool ObstacleSet::empty() const
+{
+    return obstacles_.empty();
+}
+
+void ObstacleSet::Entries::add(const Obstacle &obstacle, size_t index)
+{
+    // Only the exact types are stored by value, since subclasses may override how the
+    // obstacle is queried
+    const std::type_info &type = typeid(obstacle);
+    if (type == typeid(GeomObstacle<Circle>))
+    {
+        circles.push_back(
+            {static_cast<const GeomObstacle<Circle> &>(obstacle).getGeom(), index});
+    }
+    else if (type == typeid(GeomObstacle<Rectangle>))
+    {
+        rectangles.push_back(
+            {static_cast<const GeomObstacle<Rectangle> &>(obstacle).getGeom(), index});
+    }
+    else if (type == typeid(GeomObstacle<Stadium>))
+    {
+        stadiums.push_back(
+            {static_cast<const GeomObstacle<Stadium> &>(obstacle).getGeom(), index});
+    }
+    else if (type == typeid(GeomObstacle<Polygon>))
+    {
+        Polygon polygon = static_cast<const GeomObstacle<Polygon> &>(obstacle).getGeom();
+        polygons.push_back({polygon, axisAlignedBoundingBox(polygon), index});
+    }
+    else if (type == typeid(ConstVelocityObstacle<Circle>))
+    {
+        const auto &const_velocity_obstacle =
+            static_cast<const ConstVelocityObstacle<Circle> &>(obstacle);
+        const_velocity_circles.push_back(
+            {const_velocity_obstacle.getGeom(), const_velocity_obstacle.getVelocity(),
+             const_velocity_obstacle.getMaxTimeHorizonSec(), index});
+    }
+    else if (type == typeid(TrajectoryObstacle<Circle>))
+    {
+        const auto &trajectory_obstacle =
+            static_cast<const TrajectoryObstacle<Circle> &>(obstacle);
+        const TrajectoryPath &trajectory = trajectory_obstacle.getTrajectory();
+        trajectory_circles.push_back({trajectory_obstacle.getGeom(), &trajectory,
+                                      trajectory.getPosition(0), index});
+    }
+    else
+    {
+        others.push_back({&obstacle, index});
+    }
+}
+
+bool ObstacleSet::Entries::contains(const Point &p, double t_sec) const
+{
+    auto contains_point = [&p, t_sec](const auto &entry)
+    { return entry.contains(p, t_sec); };
+
+    return std::any_of(circles.begin(), circles.end(), contains_point) ||
+           std::any_of(rectangles.begin(), rectangles.end(), contains_point) ||
+           std::any_of(stadiums.begin(), stadiums.end(), contains_point) ||
+           std::any_of(polygons.begin(), polygons.end(), contains_point) ||
+           std::any_of(const_velocity_circles.begin(), const_velocity_circles.end(),
+                       contains_point) ||
+           std::any_of(trajectory_circles.begin(), trajectory_circles.end(),
+                       contains_point) ||
+           std::any_of(others.begin(), others.end(), contains_point);
+}
+
+void ObstacleSet::Entries::findFirstContaining(const Point &p, double t_sec,
+                                               size_t &first_index) const
+{
+    findFirstContainingEntry(circles, p, t_sec, first_index);
+    findFirstContainingEntry(rectangles, p, t_sec, first_index);
+    findFirstContainingEntry(stadiums, p, t_sec, first_index);
+    findFirstContainingEntry(polygons, p, t_sec, first_index);
+    findFirstContainingEntry(const_velocity_circles, p, t_sec, first_index);
+    findFirstContainingEntry(trajectory_circles, p, t_sec, first_index);
+    findFirstContainingEntry(others, p, t_sec, first_index);
+}
+
+double ObstacleSet::Entries::signedDistance(const Point &p, double t_sec) const
+{
+    double min_signed_distance = std::numeric_limits<double>::max();
+    auto update_min_signed_distance = [&](const auto &entries)
+    {
+        for (const auto &entry : entries)
+        {
+            min_signed_distance =
+                std::min(min_signed_distance, entry.signedDistance(p, t_sec));
+        }
+    };
+
+    update_min_signed_distance(circles);
+    update_min_signed_distance(rectangles);
+    update_min_signed_distance(stadiums);
+    update_min_signed_distance(polygons);
+    update_min_signed_distance(const_velocity_circles);
+    update_min_signed_distance(trajectory_circles);
+    update_min_signed_distance(others);
+    return min_signed_distance;
+}
+
+template <typename GEOM_TYPE>
+bool ObstacleSet::StaticEntry<GEOM_TYPE>::contains(const Point &p, double t_sec) const
+{
+    return ::contains(geom, p);
+}
+
+template <typename GEOM_TYPE>
+double ObstacleSet::StaticEntry<GEOM_TYPE>::signedDistance(const Point &p,
+                                                           double t_sec) const
+{
+    return ::signedDistance(geom, p);
+}
+
+bool ObstacleSet::PolygonEntry::contains(const Point &p, double t_sec) const
+{
+    return ::contains(bounding_box, p) && ::contains(polygon, p);
+}
+
+double ObstacleSet::PolygonEntry::signedDistance(const Point &p, double t_sec) const
+{
+    return ::signedDistance(polygon, p);
+}
+
+// Instead of shifting the moving obstacles, the point is shifted in the opposite
+// direction of the motion of the obstacle
+
+bool ObstacleSet::ConstVelocityCircleEntry::contains(const Point &p, double t_sec) const
+{
+    return ::contains(circle, p - velocity * std::min(t_sec, max_time_horizon_sec));
+}
+
+double ObstacleSet::ConstVelocityCircleEntry::signedDistance(const Point &p,
+                                                             double t_sec) const
+{
+    return ::signedDistance(circle,
+                            p - velocity * std::min(t_sec, max_time_horizon_sec));
+}
+
+bool ObstacleSet::TrajectoryCircleEntry::contains(const Point &p, double t_sec) const
+{
+    if (std::abs(t_sec) < FIXED_EPSILON)
+    {
+        return ::contains(circle, p);
+    }
+    return ::contains(circle, p - (trajectory->getPosition(t_sec) - start_position));
+}
+
+double ObstacleSet::TrajectoryCircleEntry::signedDistance(const Point &p,
+                                                          double t_sec) const
+{
+    if (std::abs(t_sec) < FIXED_EPSILON)
+    {
+        return ::signedDistance(circle, p);
+    }
+    return ::signedDistance(circle,
+                            p - (trajectory->getPosition(t_sec) - start_position));
+}
+
+bool ObstacleSet::OtherEntry::contains(const Point &p, double t_sec) const
+{
+    return obstacle->contains(p, t_sec);
+}
+
+double ObstacleSet::OtherEntry::signedDistance(const Point &p, double t_sec) const
+{
+    return obstacle->signedDistance(p, t_sec);
+}
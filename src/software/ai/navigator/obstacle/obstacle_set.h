@@ -0,0 +1,238 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_distance_field.h"
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/polygon.h"
+#include "software/geom/rectangle.h"
+#include "software/geom/stadium.h"
+
+/**
+ * An ObstacleSet stores a list of obstacles by value in contiguous arrays grouped by
+ * the type of the obstacle, so queries against every obstacle in the set don't need to
+ * chase a pointer and make a virtual call for each obstacle.
+ *
+ * GeomObstacles of every shape and ConstVelocityObstacle<Circle> and
+ * TrajectoryObstacle<Circle> are stored by value. Any other obstacle is queried through
+ * its ObstaclePtr. Queries return the same results as querying every obstacle in the
+ * list that the set was created from, in order.
+ *
+ * A set can also be created with an ObstacleDistanceField of static obstacles. The
+ * obstacles in the distance field are then only checked exactly when the distance field
+ * can't tell whether a point is inside them, so checking points far from the static
+ * obstacles takes constant time.
+ *
+ * NOTE: The set keeps the obstacles it was created from alive, and they must not be
+ * modified while the set is in use.
+ */
+class ObstacleSet
+{
+   public:
+    /**
+     * Creates an empty ObstacleSet
+     */
+    ObstacleSet() = default;
+
+    /**
+     * Creates an ObstacleSet from the given obstacles
+     *
+     * @param obstacles The obstacles to store in the set
+     */
+    explicit ObstacleSet(const std::vector<ObstaclePtr> &obstacles);
+
+    /**
+     * Creates an ObstacleSet from the given obstacles, where the obstacles in the given
+     * distance field are checked with the distance field. If the distance field has an
+     * obstacle that isn't one of the given obstacles, e.g. because it was created from
+     * an earlier list of obstacles, the distance field is not used and every obstacle
+     * is checked exactly
+     *
+     * @param obstacles The obstacles to store in the set
+     * @param distance_field The distance field of some of the static obstacles in the
+     * given obstacles, or nullptr to check every obstacle exactly
+     */
+    explicit ObstacleSet(const std::vector<ObstaclePtr> &obstacles,
+                         std::shared_ptr<const ObstacleDistanceField> distance_field);
+
+    /**
+     * Determines whether the given Point is contained within any of the obstacles
+     *
+     * @param p Point to check if contained by the obstacles
+     * @param t_sec Time in seconds into the future to check if point is contained
+     *
+     * @return whether the Point p is contained within any of the obstacles
+     */
+    bool contains(const Point &p, const double t_sec = 0) const;
+
+    /**
+     * Finds the first obstacle, in the order the set was created with, that contains
+     * the given Point
+     *
+     * @param p Point to check if contained by the obstacles
+     * @param t_sec Time in seconds into the future to check if point is contained
+     *
+     * @return the first obstacle containing the point, or nullptr if no obstacle
+     * contains the point
+     */
+    ObstaclePtr findContainingObstacle(const Point &p, const double t_sec = 0) const;
+
+    /**
+     * Gets the smallest signed distance from the perimeter of any of the obstacles to
+     * the point. The distance is negative if the point is inside an obstacle
+     *
+     * @param p Point to get distance to
+     * @param t_sec Time in seconds into the future to get distance to
+     *
+     * @return the smallest signed distance to the point, or the max double if the set
+     * is empty. If the set has a distance field, distances to the obstacles in the
+     * distance field are only exact within its max error of their perimeter
+     */
+    double signedDistance(const Point &p, const double t_sec = 0) const;
+
+    /**
+     * Gets the obstacles the set was created from
+     *
+     * @return the obstacles in the set
+     */
+    const std::vector<ObstaclePtr> &getObstacles() const;
+
+    /**
+     * Gets the number of obstacles in the set
+     *
+     * @return the number of obstacles in the set
+     */
+    size_t size() const;
+
+    /**
+     * Checks if the set has no obstacles
+     *
+     * @return true if the set has no obstacles, false otherwise
+     */
+    bool empty() const;
+
+   private:
+    // An obstacle that doesn't move
+    template <typename GEOM_TYPE>
+    struct StaticEntry
+    {
+        bool contains(const Point &p, double t_sec) const;
+        double signedDistance(const Point &p, double t_sec) const;
+
+        GEOM_TYPE geom;
+        // The index of the obstacle in obstacles_
+        size_t index;
+    };
+
+    // A polygon obstacle, with its bounding box to quickly reject points far from it
+    struct PolygonEntry
+    {
+        bool contains(const Point &p, double t_sec) const;
+        double signedDistance(const Point &p, double t_sec) const;
+
+        Polygon polygon;
+        Rectangle bounding_box;
+        size_t index;
+    };
+
+    // A circle obstacle moving at a constant velocity
+    struct ConstVelocityCircleEntry
+    {
+        bool contains(const Point &p, double t_sec) const;
+        double signedDistance(const Point &p, double t_sec) const;
+
+        Circle circle;
+        Vector velocity;
+        double max_time_horizon_sec;
+        size_t index;
+    };
+
+    // A circle obstacle following a trajectory. The trajectory is owned by the
+    // obstacle in obstacles_
+    struct TrajectoryCircleEntry
+    {
+        bool contains(const Point &p, double t_sec) const;
+        double signedDistance(const Point &p, double t_sec) const;
+
+        Circle circle;
+        const TrajectoryPath *trajectory;
+        Point start_position;
+        size_t index;
+    };
+
+    // Any other type of obstacle, which is queried through its virtual functions
+    struct OtherEntry
+    {
+        bool contains(const Point &p, double t_sec) const;
+        double signedDistance(const Point &p, double t_sec) const;
+
+        const Obstacle *obstacle;
+        size_t index;
+    };
+
+    // The obstacles of a set, grouped by type. Each group is sorted by index
+    struct Entries
+    {
+        /**
+         * Adds the obstacle to the group for its type
+         *
+         * @param obstacle The obstacle to add
+         * @param index The index of the obstacle in obstacles_
+         */
+        void add(const Obstacle &obstacle, size_t index);
+
+        /**
+         * Determines whether the given Point is contained within any of the entries
+         *
+         * @param p Point to check if contained by the entries
+         * @param t_sec Time in seconds into the future to check if point is contained
+         *
+         * @return whether the Point p is contained within any of the entries
+         */
+        bool contains(const Point &p, double t_sec) const;
+
+        /**
+         * Finds the entry with the lowest index that contains the point, if its index
+         * is lower than first_index
+         *
+         * @param p Point to check if contained by the entries
+         * @param t_sec Time in seconds into the future to check if point is contained
+         * @param first_index The lowest index of an obstacle found to contain the point
+         * so far. Updated if an entry with a lower index contains the point
+         */
+        void findFirstContaining(const Point &p, double t_sec,
+                                 size_t &first_index) const;
+
+        /**
+         * Gets the smallest signed distance from the perimeter of any of the entries to
+         * the point
+         *
+         * @param p Point to get distance to
+         * @param t_sec Time in seconds into the future to get distance to
+         *
+         * @return the smallest signed distance, or the max double if there are no
+         * entries
+         */
+        double signedDistance(const Point &p, double t_sec) const;
+
+        std::vector<StaticEntry<Circle>> circles;
+        std::vector<StaticEntry<Rectangle>> rectangles;
+        std::vector<StaticEntry<Stadium>> stadiums;
+        std::vector<PolygonEntry> polygons;
+        std::vector<ConstVelocityCircleEntry> const_velocity_circles;
+        std::vector<TrajectoryCircleEntry> trajectory_circles;
+        std::vector<OtherEntry> others;
+    };
+
+    std::vector<ObstaclePtr> obstacles_;
+    // The obstacles that aren't in the distance field
+    Entries entries_;
+    // The obstacles in the distance field, which are only checked when the distance
+    // field is close to or inside them
+    Entries distance_field_entries_;
+    std::shared_ptr<const ObstacleDistanceField> distance_field_;
+};
@@ -0,0 +1,250 @@
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+
+#include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
+#include "software/test_util/test_util.h"
+
+class ObstacleSetTest : public testing::Test
+{
+   protected:
+    ObstacleSetTest()
+        : world(::TestUtil::createBlankTestingWorld()),
+          trajectory(std::make_shared<BangBangTrajectory2D>(
+                         Point(-2, -2), Point(2, 2), Vector(0, 0),
+                         KinematicConstraints(2, 2, 2)),
+                     BangBangTrajectory2D::generator)
+    {
+        config.set_robot_obstacle_inflation_factor(1.3);
+        config.set_dynamic_enemy_robot_obstacle_min_speed_mps(0.5);
+        RobotNavigationObstacleFactory obstacle_factory(config);
+
+        // Create obstacles of every type the factory creates, plus an obstacle type
+        // that isn't stored by value
+        for (auto motion_constraint :
+             {TbotsProto::MotionConstraint::CENTER_CIRCLE,
+              TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+              TbotsProto::MotionConstraint::ENEMY_HALF_WITHOUT_CENTRE_CIRCLE,
+              TbotsProto::MotionConstraint::ENEMY_GOAL,
+              TbotsProto::MotionConstraint::AVOID_FIELD_BOUNDARY_ZONE})
+        {
+            auto new_obstacles =
+                obstacle_factory.createObstaclesFromMotionConstraint(motion_constraint,
+                                                                     *world);
+            obstacles.insert(obstacles.end(), new_obstacles.begin(),
+                             new_obstacles.end());
+        }
+        obstacles.push_back(obstacle_factory.createConstVelocityEnemyRobotObstacle(
+            Robot(0, Point(-3, 1), Vector(2, -1), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0))));
+        obstacles.push_back(obstacle_factory.createFromMovingRobot(
+            Robot(1, Point(-2, -2), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            trajectory));
+        obstacles.push_back(std::make_shared<TrajectoryObstacle<Rectangle>>(
+            Rectangle(Point(1, -3), Point(2, -2)), trajectory));
+        obstacles.push_back(
+            obstacle_factory.createFromShape(Circle(Point(-3.5, 1.5), 0.3)));
+    }
+
+    // Generates random points on and around the field
+    static std::vector<Point> makeRandomPoints(unsigned int num_points)
+    {
+        std::mt19937 random_engine(0);
+        std::uniform_real_distribution<double> x_distribution(-5.5, 5.5);
+        std::uniform_real_distribution<double> y_distribution(-4, 4);
+        std::vector<Point> points;
+        for (unsigned int i = 0; i < num_points; i++)
+        {
+            points.emplace_back(x_distribution(random_engine),
+                                y_distribution(random_engine));
+        }
+        return points;
+    }
+
+    std::shared_ptr<World> world;
+    TrajectoryPath trajectory;
+    TbotsProto::RobotNavigationObstacleConfig config;
+    std::vector<ObstaclePtr> obstacles;
+};
+
+TEST_F(ObstacleSetTest, empty_set)
+{
+    ObstacleSet obstacle_set;
+
+    EXPECT_TRUE(obstacle_set.empty());
+    EXPECT_FALSE(obstacle_set.contains(Point(0, 0)));
+    EXPECT_EQ(nullptr, obstacle_set.findContainingObstacle(Point(0, 0)));
+    EXPECT_EQ(std::numeric_limits<double>::max(), obstacle_set.signedDistance(Point()));
+}
+
+TEST_F(ObstacleSetTest, queries_match_obstacle_list)
+{
+    ObstacleSet obstacle_set(obstacles);
+    ASSERT_EQ(obstacles.size(), obstacle_set.size());
+    EXPECT_EQ(obstacles, obstacle_set.getObstacles());
+
+    for (double t_sec : {0.0, 0.5, 1.7, 5.0})
+    {
+        for (const Point &point : makeRandomPoints(1000))
+        {
+            ObstaclePtr expected_obstacle   = nullptr;
+            double expected_signed_distance = std::numeric_limits<double>::max();
+            for (const ObstaclePtr &obstacle : obstacles)
+            {
+                if (!expected_obstacle && obstacle->contains(point, t_sec))
+                {
+                    expected_obstacle = obstacle;
+                }
+                expected_signed_distance = std::min(
+                    expected_signed_distance, obstacle->signedDistance(point, t_sec));
+            }
+
+            EXPECT_EQ(expected_obstacle != nullptr, obstacle_set.contains(point, t_sec))
+                << point << " at " << t_sec << "s";
+            EXPECT_EQ(expected_obstacle,
+                      obstacle_set.findContainingObstacle(point, t_sec))
+                << point << " at " << t_sec << "s";
+            EXPECT_DOUBLE_EQ(expected_signed_distance,
+                             obstacle_set.signedDistance(point, t_sec))
+                << point << " at " << t_sec << "s";
+        }
+    }
+}
+
+TEST_F(ObstacleSetTest, queries_with_distance_field_match_obstacle_list)
+{
+    // Put the static obstacles in a distance field, and put the other obstacles
+    // between the static obstacles in the obstacle list to check that the order is kept
+    std::vector<ObstaclePtr> static_obstacles(obstacles.begin(), obstacles.end() - 4);
+    auto distance_field = std::make_shared<const ObstacleDistanceField>(
+        static_obstacles, world->field().fieldBoundary(), 0.05);
+    std::vector<ObstaclePtr> expected_obstacles = {obstacles.front()};
+    expected_obstacles.insert(expected_obstacles.end(), obstacles.end() - 4,
+                              obstacles.end());
+    expected_obstacles.insert(expected_obstacles.end(), static_obstacles.begin() + 1,
+                              static_obstacles.end());
+
+    ObstacleSet obstacle_set(expected_obstacles, distance_field);
+    EXPECT_EQ(expected_obstacles, obstacle_set.getObstacles());
+
+    for (double t_sec : {0.0, 1.7})
+    {
+        for (const Point &point : makeRandomPoints(1000))
+        {
+            ObstaclePtr expected_obstacle = nullptr;
+            for (const ObstaclePtr &obstacle : expected_obstacles)
+            {
+                if (obstacle->contains(point, t_sec))
+                {
+                    expected_obstacle = obstacle;
+                    break;
+                }
+            }
+
+            EXPECT_EQ(expected_obstacle != nullptr, obstacle_set.contains(point, t_sec))
+                << point << " at " << t_sec << "s";
+            EXPECT_EQ(expected_obstacle,
+                      obstacle_set.findContainingObstacle(point, t_sec))
+                << point << " at " << t_sec << "s";
+        }
+    }
+}
+
+TEST_F(ObstacleSetTest, distance_field_with_other_obstacles_is_not_used)
+{
+    // The distance field has a static obstacle that isn't in the set, like a distance
+    // field created from an earlier list of obstacles
+    std::vector<ObstaclePtr> static_obstacles(obstacles.begin(), obstacles.end() - 4);
+    auto distance_field = std::make_shared<const ObstacleDistanceField>(
+        static_obstacles, world->field().fieldBoundary(), 0.05);
+    std::vector<ObstaclePtr> set_obstacles(obstacles.begin() + 1, obstacles.end());
+
+    ObstacleSet obstacle_set(set_obstacles, distance_field);
+
+    for (const Point &point : makeRandomPoints(1000))
+    {
+        ObstaclePtr expected_obstacle = nullptr;
+        for (const ObstaclePtr &obstacle : set_obstacles)
+        {
+            if (obstacle->contains(point))
+            {
+                expected_obstacle = obstacle;
+                break;
+            }
+        }
+
+        EXPECT_EQ(expected_obstacle != nullptr, obstacle_set.contains(point)) << point;
+        EXPECT_EQ(expected_obstacle, obstacle_set.findContainingObstacle(point))
+            << point;
+    }
+}
+
+TEST_F(ObstacleSetTest, finds_first_obstacle_in_order)
+{
+    RobotNavigationObstacleFactory obstacle_factory(config);
+    ObstaclePtr rectangle =
+        obstacle_factory.createFromShape(Rectangle(Point(-1, -1), Point(1, 1)));
+    ObstaclePtr circle = obstacle_factory.createFromShape(Circle(Point(0, 0), 1));
+
+    EXPECT_EQ(rectangle,
+              ObstacleSet({rectangle, circle}).findContainingObstacle(Point(0, 0)));
+    EXPECT_EQ(circle,
+              ObstacleSet({circle, rectangle}).findContainingObstacle(Point(0, 0)));
+}
+
+TEST_F(ObstacleSetTest, copied_set_keeps_moving_obstacles)
+{
+    ObstacleSet obstacle_set;
+    {
+        ObstacleSet original_set({obstacles[obstacles.size() - 3]});
+        obstacle_set = original_set;
+    }
+
+    Point trajectory_position = trajectory.getPosition(1.0);
+    EXPECT_TRUE(obstacle_set.contains(trajectory_position, 1.0));
+    EXPECT_FALSE(obstacle_set.contains(trajectory_position, 0.0));
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name to compare the performance of ObstacleSet to a list of obstacles
+TEST_F(ObstacleSetTest, DISABLED_contains_performance)
+{
+    std::vector<Point> points = makeRandomPoints(100000);
+    ObstacleSet obstacle_set(obstacles);
+
+    int num_contained_by_list = 0;
+    auto start_time           = std::chrono::system_clock::now();
+    for (const Point &point : points)
+    {
+        for (const ObstaclePtr &obstacle : obstacles)
+        {
+            if (obstacle->contains(point, 0.5))
+            {
+                num_contained_by_list++;
+                break;
+            }
+        }
+    }
+    double list_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    int num_contained_by_set = 0;
+    start_time               = std::chrono::system_clock::now();
+    for (const Point &point : points)
+    {
+        if (obstacle_set.contains(point, 0.5))
+        {
+            num_contained_by_set++;
+        }
+    }
+    double set_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    EXPECT_EQ(num_contained_by_list, num_contained_by_set);
+    std::cout << "Checked " << points.size() << " points against " << obstacles.size()
+              << " obstacles. std::vector<ObstaclePtr> took " << list_duration_ms
+              << "ms, ObstacleSet took " << set_duration_ms << "ms" << std::endl;
+}
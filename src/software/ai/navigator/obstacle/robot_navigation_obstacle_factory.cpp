@@ -1,5 +1,7 @@
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
 
+#include <algorithm>
+
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
 #include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
 
@@ -7,7 +9,8 @@ RobotNavigationObstacleFactory::RobotNavigationObstacleFactory(
     TbotsProto::RobotNavigationObstacleConfig config)
     : config(config),
       robot_radius_expansion_amount(config.robot_obstacle_inflation_factor() *
-                                    ROBOT_MAX_RADIUS_METERS)
+                                    ROBOT_MAX_RADIUS_METERS),
+      static_obstacle_cache(std::make_shared<StaticObstacleCache>())
 {
 }
 
@@ -16,7 +19,198 @@ RobotNavigationObstacleFactory::createObstaclesFromMotionConstraint(
     const TbotsProto::MotionConstraint &motion_constraint, const World &world) const
 {
     std::vector<ObstaclePtr> obstacles;
-    const Field &field = world.field();
+
+    switch (motion_constraint)
+    {
+        case TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL:;
+            // 0.5 represents half a metre radius
+            obstacles.push_back(createFromShape(
+                Circle(world.ball().position(), STOP_COMMAND_BALL_AVOIDANCE_DISTANCE_M)));
+            break;
+        case TbotsProto::MotionConstraint::AVOID_BALL_PLACEMENT_INTERFERENCE:;
+            if (world.gameState().getBallPlacementPoint().has_value())
+            {
+                obstacles.push_back(createFromBallPlacement(
+                    world.gameState().getBallPlacementPoint().value(),
+                    world.ball().position()));
+            }
+            else
+            {
+                obstacles.push_back(
+                    createFromShape(Circle(world.ball().position(), 0.5)));
+            }
+            break;
+        default:
+            // All other obstacles only depend on the field, so they are cached
+            return getStaticObstaclesFromMotionConstraint(motion_constraint, world);
+    }
+
+    return obstacles;
+}
+
+std::shared_ptr<const ObstacleDistanceField>
+RobotNavigationObstacleFactory::getStaticObstacleDistanceField(
+    const std::set<TbotsProto::MotionConstraint> &motion_constraints,
+    const World &world) const
+{
+    std::set<TbotsProto::MotionConstraint> static_motion_constraints;
+    for (auto motion_constraint : motion_constraints)
+    {
+        if (isStaticMotionConstraint(motion_constraint))
+        {
+            static_motion_constraints.insert(motion_constraint);
+        }
+    }
+
+    std::scoped_lock lock(static_obstacle_cache->mutex);
+    clearStaticObstacleCacheIfFieldChanged(world);
+
+    auto &distance_fields      = static_obstacle_cache->distance_fields;
+    auto cached_distance_field = std::find_if(
+        distance_fields.begin(), distance_fields.end(),
+        [&](const auto &entry) { return entry.first == static_motion_constraints; });
+    if (cached_distance_field != distance_fields.end())
+    {
+        distance_fields.splice(distance_fields.begin(), distance_fields,
+                               cached_distance_field);
+        return distance_fields.front().second;
+    }
+
+    // Creating a distance field samples the whole field, which takes too long to do on
+    // the caller's thread, so it is requested from the distance field thread instead
+    std::vector<ObstaclePtr> obstacles;
+    for (auto motion_constraint : static_motion_constraints)
+    {
+        const std::vector<ObstaclePtr> &new_obstacles =
+            getCachedStaticObstacles(motion_constraint, world.field());
+        obstacles.insert(obstacles.end(), new_obstacles.begin(), new_obstacles.end());
+    }
+    static_obstacle_cache->distance_field_requests.push_back(
+        {static_motion_constraints, obstacles, world.field().fieldBoundary(),
+         world.getFieldVersion()});
+    distance_fields.emplace_front(static_motion_constraints, nullptr);
+
+    if (distance_fields.size() > MAX_NUM_CACHED_DISTANCE_FIELDS)
+    {
+        auto &requests = static_obstacle_cache->distance_field_requests;
+        requests.erase(
+            std::remove_if(requests.begin(), requests.end(),
+                           [&](const DistanceFieldRequest &request)
+                           {
+                               return request.motion_constraints ==
+                                      distance_fields.back().first;
+                           }),
+            requests.end());
+        distance_fields.pop_back();
+    }
+
+    if (!static_obstacle_cache->distance_field_thread.joinable())
+    {
+        static_obstacle_cache->distance_field_thread =
+            std::thread(&StaticObstacleCache::createRequestedDistanceFields,
+                        static_obstacle_cache.get());
+    }
+    static_obstacle_cache->distance_field_requested.notify_one();
+
+    return nullptr;
+}
+
+RobotNavigationObstacleFactory::StaticObstacleCache::~StaticObstacleCache()
+{
+    {
+        std::scoped_lock lock(mutex);
+        stop_distance_field_thread = true;
+    }
+    distance_field_requested.notify_one();
+    if (distance_field_thread.joinable())
+    {
+        distance_field_thread.join();
+    }
+}
+
+void RobotNavigationObstacleFactory::StaticObstacleCache::createRequestedDistanceFields()
+{
+    std::unique_lock lock(mutex);
+    while (true)
+    {
+        distance_field_requested.wait(
+            lock, [this]
+            { return stop_distance_field_thread || !distance_field_requests.empty(); });
+        if (stop_distance_field_thread)
+        {
+            return;
+        }
+
+        DistanceFieldRequest request = std::move(distance_field_requests.front());
+        distance_field_requests.pop_front();
+
+        lock.unlock();
+        auto distance_field = std::make_shared<const ObstacleDistanceField>(
+            request.obstacles, request.area,
+            STATIC_OBSTACLE_DISTANCE_FIELD_RESOLUTION_METERS);
+        lock.lock();
+
+        // The field may have changed, or the distance field may have been evicted from
+        // the cache, while it was being created
+        auto cached_distance_field = std::find_if(
+            distance_fields.begin(), distance_fields.end(), [&](const auto &entry)
+            { return entry.first == request.motion_constraints; });
+        if (request.field_version == field_version &&
+            cached_distance_field != distance_fields.end())
+        {
+            cached_distance_field->second = distance_field;
+        }
+    }
+}
+
+bool RobotNavigationObstacleFactory::isStaticMotionConstraint(
+    const TbotsProto::MotionConstraint &motion_constraint)
+{
+    return motion_constraint != TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL &&
+           motion_constraint !=
+               TbotsProto::MotionConstraint::AVOID_BALL_PLACEMENT_INTERFERENCE;
+}
+
+std::vector<ObstaclePtr>
+RobotNavigationObstacleFactory::getStaticObstaclesFromMotionConstraint(
+    const TbotsProto::MotionConstraint &motion_constraint, const World &world) const
+{
+    std::scoped_lock lock(static_obstacle_cache->mutex);
+    clearStaticObstacleCacheIfFieldChanged(world);
+    return getCachedStaticObstacles(motion_constraint, world.field());
+}
+
+void RobotNavigationObstacleFactory::clearStaticObstacleCacheIfFieldChanged(
+    const World &world) const
+{
+    if (static_obstacle_cache->field_version != world.getFieldVersion())
+    {
+        static_obstacle_cache->field_version = world.getFieldVersion();
+        static_obstacle_cache->obstacles.clear();
+        static_obstacle_cache->distance_fields.clear();
+        static_obstacle_cache->distance_field_requests.clear();
+    }
+}
+
+const std::vector<ObstaclePtr> &RobotNavigationObstacleFactory::getCachedStaticObstacles(
+    const TbotsProto::MotionConstraint &motion_constraint, const Field &field) const
+{
+    auto cached_obstacles = static_obstacle_cache->obstacles.find(motion_constraint);
+    if (cached_obstacles == static_obstacle_cache->obstacles.end())
+    {
+        std::vector<ObstaclePtr> obstacles =
+            createStaticObstaclesFromMotionConstraint(motion_constraint, field);
+        cached_obstacles =
+            static_obstacle_cache->obstacles.emplace(motion_constraint, obstacles).first;
+    }
+    return cached_obstacles->second;
+}
+
+std::vector<ObstaclePtr>
+RobotNavigationObstacleFactory::createStaticObstaclesFromMotionConstraint(
+    const TbotsProto::MotionConstraint &motion_constraint, const Field &field) const
+{
+    std::vector<ObstaclePtr> obstacles;
 
     switch (motion_constraint)
     {
@@ -90,22 +284,8 @@ RobotNavigationObstacleFactory::createObstaclesFromMotionConstraint(
             break;
         }
         case TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL:;
-            // 0.5 represents half a metre radius
-            obstacles.push_back(createFromShape(
-                Circle(world.ball().position(), STOP_COMMAND_BALL_AVOIDANCE_DISTANCE_M)));
-            break;
         case TbotsProto::MotionConstraint::AVOID_BALL_PLACEMENT_INTERFERENCE:;
-            if (world.gameState().getBallPlacementPoint().has_value())
-            {
-                obstacles.push_back(createFromBallPlacement(
-                    world.gameState().getBallPlacementPoint().value(),
-                    world.ball().position()));
-            }
-            else
-            {
-                obstacles.push_back(
-                    createFromShape(Circle(world.ball().position(), 0.5)));
-            }
+            // These obstacles depend on the ball, so they are not static
             break;
 
         case TbotsProto::MotionConstraint::FRIENDLY_GOAL:
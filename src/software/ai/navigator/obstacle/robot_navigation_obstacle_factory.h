@@ -1,12 +1,24 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+
 #include "proto/parameters.pb.h"
 #include "proto/primitive.pb.h"
 #include "shared/constants.h"
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_distance_field.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/geom/point.h"
 #include "software/geom/polygon.h"
+#include "software/geom/rectangle.h"
 #include "software/logger/logger.h"
 #include "software/world/world.h"
 
@@ -14,6 +26,14 @@
  * The RobotNavigationObstacleFactory creates obstacles for navigation with a robot
  * NOTE: All obstacles created include at least an additional robot radius margin on all
  * sides of the obstacle
+ *
+ * Obstacles for motion constraints that only depend on the field (e.g. the defense
+ * areas) are created once and shared between every call, and are only recreated when
+ * the field changes. Copies of a factory share these cached obstacles, since they have
+ * the same config. The cached obstacles must not be modified.
+ *
+ * Distance fields of these obstacles are created on a background thread, so creating
+ * them never delays the caller. Only the most recently used distance fields are kept.
  */
 class RobotNavigationObstacleFactory
 {
@@ -48,6 +68,23 @@ class RobotNavigationObstacleFactory
     std::vector<ObstaclePtr> createObstaclesFromMotionConstraint(
         const TbotsProto::MotionConstraint &motion_constraint, const World &world) const;
 
+    /**
+     * Gets a distance field of the obstacles for the given motion constraints that only
+     * depend on the field. Motion constraints that depend on other parts of the world
+     * are ignored. The first time a distance field is requested for a field version and
+     * set of motion constraints, it is created on a background thread, and nullptr is
+     * returned until it is ready
+     *
+     * @param motion_constraints The motion constraints to get the distance field for
+     * @param world World we're enforcing the motion constraints in
+     *
+     * @return the distance field of the static obstacles for the motion constraints, or
+     * nullptr if it is still being created
+     */
+    std::shared_ptr<const ObstacleDistanceField> getStaticObstacleDistanceField(
+        const std::set<TbotsProto::MotionConstraint> &motion_constraints,
+        const World &world) const;
+
     /**
      * Create circle obstacle around robot with additional radius scaling
      *
@@ -142,8 +179,108 @@ class RobotNavigationObstacleFactory
                                         const Point &ball_point) const;
 
    private:
+    // A distance field waiting to be created by the distance field thread
+    struct DistanceFieldRequest
+    {
+        std::set<TbotsProto::MotionConstraint> motion_constraints;
+        std::vector<ObstaclePtr> obstacles;
+        Rectangle area;
+        // The version of the field the obstacles were created for
+        uint64_t field_version;
+    };
+
+    // The obstacles created for the motion constraints that only depend on the field
+    struct StaticObstacleCache
+    {
+        StaticObstacleCache() = default;
+        ~StaticObstacleCache();
+
+        /**
+         * Creates the requested distance fields until the cache is destroyed. Runs on
+         * the distance field thread
+         */
+        void createRequestedDistanceFields();
+
+        std::mutex mutex;
+        // The version of the field the obstacles were created for
+        std::optional<uint64_t> field_version;
+        std::map<TbotsProto::MotionConstraint, std::vector<ObstaclePtr>> obstacles;
+        // The distance fields for each set of motion constraints, most recently used
+        // first. A distance field is nullptr until it has been created
+        std::list<std::pair<std::set<TbotsProto::MotionConstraint>,
+                            std::shared_ptr<const ObstacleDistanceField>>>
+            distance_fields;
+        std::deque<DistanceFieldRequest> distance_field_requests;
+        std::condition_variable distance_field_requested;
+        bool stop_distance_field_thread = false;
+        // Started when the first distance field is requested
+        std::thread distance_field_thread;
+    };
+
     TbotsProto::RobotNavigationObstacleConfig config;
     double robot_radius_expansion_amount;
+    std::shared_ptr<StaticObstacleCache> static_obstacle_cache;
+
+    // The distance between samples of the static obstacle distance fields
+    static constexpr double STATIC_OBSTACLE_DISTANCE_FIELD_RESOLUTION_METERS = 0.02;
+    // The maximum number of static obstacle distance fields kept in the cache
+    static constexpr size_t MAX_NUM_CACHED_DISTANCE_FIELDS = 8;
+
+    /**
+     * Checks if the obstacles for the given motion constraint only depend on the field
+     *
+     * @param motion_constraint The motion constraint to check
+     *
+     * @return true if the obstacles only depend on the field, false otherwise
+     */
+    static bool isStaticMotionConstraint(
+        const TbotsProto::MotionConstraint &motion_constraint);
+
+    /**
+     * Clears the static obstacle cache if it was created for a different version of the
+     * field. The cache's mutex must be held
+     *
+     * @param world World we're enforcing motion constraints in
+     */
+    void clearStaticObstacleCacheIfFieldChanged(const World &world) const;
+
+    /**
+     * Gets the cached static obstacles for the given motion constraint, creating them
+     * if they aren't cached yet. The cache's mutex must be held, and the cache must be
+     * for the given field
+     *
+     * @param motion_constraint The motion constraint to get obstacles for
+     * @param field The field we're enforcing the motion constraint in
+     *
+     * @return Obstacles representing the given motion constraint
+     */
+    const std::vector<ObstaclePtr> &getCachedStaticObstacles(
+        const TbotsProto::MotionConstraint &motion_constraint, const Field &field) const;
+
+    /**
+     * Gets the cached static obstacles for the given motion constraint, creating them
+     * if they have not been created for the version of the field yet
+     *
+     * @param motion_constraint The motion constraint to get obstacles for
+     * @param world World we're enforcing the motion constraint in
+     *
+     * @return Obstacles representing the given motion constraint
+     */
+    std::vector<ObstaclePtr> getStaticObstaclesFromMotionConstraint(
+        const TbotsProto::MotionConstraint &motion_constraint, const World &world) const;
+
+    /**
+     * Create the obstacles for the given motion constraint that only depend on the
+     * field. Motion constraints that depend on other parts of the world create no
+     * obstacles
+     *
+     * @param motion_constraint The motion constraint to create obstacles for
+     * @param field The field we're enforcing the motion constraint in
+     *
+     * @return Obstacles representing the given motion constraint
+     */
+    std::vector<ObstaclePtr> createStaticObstaclesFromMotionConstraint(
+        const TbotsProto::MotionConstraint &motion_constraint, const Field &field) const;
 
     /**
      * Returns an obstacle for the field_rectangle expanded on all sides to account for
@@ -2,7 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
 #include "software/ai/navigator/obstacle/geom_obstacle.hpp"
@@ -75,14 +77,39 @@ class RobotNavigationObstacleFactoryMotionConstraintTest : public testing::Test
             std::make_shared<World>(World(field, ball, friendly_team, enemy_team));
     }
 
+    /**
+     * Gets the static obstacle distance field for the given motion constraints, waiting
+     * for it to be created on the background thread
+     *
+     * @param motion_constraints The motion constraints to get the distance field for
+     *
+     * @return the distance field, or nullptr if it was not created within 10 seconds
+     */
+    std::shared_ptr<const ObstacleDistanceField> waitForStaticObstacleDistanceField(
+        const std::set<TbotsProto::MotionConstraint> &motion_constraints)
+    {
+        for (unsigned int i = 0; i < 10000; i++)
+        {
+            auto distance_field =
+                robot_navigation_obstacle_factory.getStaticObstacleDistanceField(
+                    motion_constraints, *world_ptr);
+            if (distance_field)
+            {
+                return distance_field;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nullptr;
+    }
+
     Timestamp current_time;
     Field field;
     Ball ball;
     Team friendly_team;
     Team enemy_team;
     std::shared_ptr<World> world_ptr;
-    RobotNavigationObstacleFactory robot_navigation_obstacle_factory;
     TbotsProto::RobotNavigationObstacleConfig robot_navigation_obstacle_config;
+    RobotNavigationObstacleFactory robot_navigation_obstacle_factory;
 };
 
 TEST_F(RobotNavigationObstacleFactoryTest, create_rectangle_obstacle)
@@ -500,3 +527,107 @@ TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest, ball_placement_rotate
         ADD_FAILURE() << "Stadium Obstacle was not created";
     }
 }
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       static_obstacles_are_shared_between_calls)
+{
+    auto obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+            TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA, *world_ptr);
+    auto cached_obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+            TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA, *world_ptr);
+
+    ASSERT_EQ(1, cached_obstacles.size());
+    EXPECT_EQ(obstacles, cached_obstacles);
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       static_obstacles_are_recreated_when_field_version_changes)
+{
+    auto obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+            TbotsProto::MotionConstraint::FRIENDLY_HALF, *world_ptr);
+
+    World division_a_world(Field::createSSLDivisionAField(), ball, friendly_team,
+                           enemy_team);
+    division_a_world.setFieldVersion(world_ptr->getFieldVersion() + 1);
+    auto division_a_obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+            TbotsProto::MotionConstraint::FRIENDLY_HALF, division_a_world);
+
+    ASSERT_EQ(1, division_a_obstacles.size());
+    EXPECT_NE(obstacles[0], division_a_obstacles[0]);
+    EXPECT_FALSE(obstacles[0]->contains(Point(-5.5, 0)));
+    EXPECT_TRUE(division_a_obstacles[0]->contains(Point(-5.5, 0)));
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       ball_obstacles_are_not_cached)
+{
+    auto obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+            TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL, *world_ptr);
+
+    world_ptr->updateBall(Ball(Point(-1, -2), Vector(), current_time));
+    auto moved_ball_obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+            TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL, *world_ptr);
+
+    ASSERT_EQ(1, moved_ball_obstacles.size());
+    EXPECT_FALSE(obstacles[0]->contains(Point(-1, -2)));
+    EXPECT_TRUE(moved_ball_obstacles[0]->contains(Point(-1, -2)));
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       static_obstacle_distance_field_is_created_in_background_and_cached)
+{
+    EXPECT_EQ(nullptr, robot_navigation_obstacle_factory.getStaticObstacleDistanceField(
+                           {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+                            TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL},
+                           *world_ptr));
+
+    auto distance_field = waitForStaticObstacleDistanceField(
+        {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA});
+    ASSERT_NE(nullptr, distance_field);
+    auto cached_distance_field =
+        robot_navigation_obstacle_factory.getStaticObstacleDistanceField(
+            {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+             TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL}, *world_ptr);
+
+    EXPECT_EQ(distance_field, cached_distance_field);
+    EXPECT_EQ(robot_navigation_obstacle_factory.createObstaclesFromMotionConstraint(
+                  TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA, *world_ptr),
+              distance_field->getObstacles());
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       least_recently_used_static_obstacle_distance_field_is_evicted)
+{
+    ASSERT_NE(nullptr, waitForStaticObstacleDistanceField(
+                           {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA}));
+
+    // Request a distance field for more sets of motion constraints than the cache holds
+    const std::vector<TbotsProto::MotionConstraint> motion_constraints = {
+        TbotsProto::MotionConstraint::ENEMY_DEFENSE_AREA,
+        TbotsProto::MotionConstraint::CENTER_CIRCLE,
+        TbotsProto::MotionConstraint::ENEMY_HALF,
+        TbotsProto::MotionConstraint::FRIENDLY_HALF};
+    for (unsigned int subset = 1; subset < (1u << motion_constraints.size()); subset++)
+    {
+        std::set<TbotsProto::MotionConstraint> motion_constraint_subset;
+        for (unsigned int i = 0; i < motion_constraints.size(); i++)
+        {
+            if (subset & (1u << i))
+            {
+                motion_constraint_subset.insert(motion_constraints[i]);
+            }
+        }
+        robot_navigation_obstacle_factory.getStaticObstacleDistanceField(
+            motion_constraint_subset, *world_ptr);
+    }
+
+    EXPECT_EQ(nullptr, robot_navigation_obstacle_factory.getStaticObstacleDistanceField(
+                           {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA},
+                           *world_ptr));
+}
@@ -28,6 +28,13 @@ class TrajectoryObstacle : public GeomObstacle<GEOM_TYPE>
     double signedDistance(const Point& p, const double t_sec = 0) const override;
     bool intersects(const Segment& segment, const double t_sec = 0) const override;
 
+    /**
+     * Gets the trajectory which the obstacle is following
+     *
+     * @return the trajectory
+     */
+    const TrajectoryPath& getTrajectory() const;
+
    private:
     const TrajectoryPath traj_;
 };
@@ -105,3 +112,9 @@ bool TrajectoryObstacle<GEOM_TYPE>::intersects(const Segment& segment,
         return ::intersects(this->geom_, segment - displacement);
     }
 }
+
+template <typename GEOM_TYPE>
+const TrajectoryPath& TrajectoryObstacle<GEOM_TYPE>::getTrajectory() const
+{
+    return traj_;
+}
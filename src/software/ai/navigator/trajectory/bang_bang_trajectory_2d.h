@@ -7,7 +7,8 @@
 #include "software/ai/navigator/trajectory/trajectory_2d.h"
 #include "software/geom/rectangle.h"
 
-class BangBangTrajectory2D : public Trajectory2D
+// BangBangTrajectory2D is final so that calls on it can be resolved at compile time
+class BangBangTrajectory2D final : public Trajectory2D
 {
    public:
     /**
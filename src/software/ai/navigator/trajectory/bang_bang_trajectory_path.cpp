@@ -0,0 +1,126 @@
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
+
+#include "software/logger/logger.h"
+
+BangBangTrajectoryPath::BangBangTrajectoryPath(
+    const BangBangTrajectory2D &initial_trajectory)
+    : trajectories({initial_trajectory}),
+      trajectory_end_times_sec({initial_trajectory.getTotalTime()}),
+      num_trajectories(1)
+{
+}
+
+void BangBangTrajectoryPath::append(double connection_time_sec,
+                                    const Point &destination,
+                                    const KinematicConstraints &constraints)
+{
+    // Find the trajectory that the new trajectory should connect to
+    for (size_t i = 0; i < num_trajectories; i++)
+    {
+        if (connection_time_sec <= trajectory_end_times_sec[i])
+        {
+            CHECK(i + 1 < MAX_NUM_TRAJECTORIES)
+                << "BangBangTrajectoryPath::append was called when the trajectories array was full";
+
+            // To have a smooth and continuous trajectory path, the new trajectory
+            // starts at the position and velocity of the existing trajectory at the
+            // connection time. All trajectories after it are replaced.
+            const BangBangTrajectory2D &trajectory = trajectories[i];
+            trajectories[i + 1] = BangBangTrajectory2D(
+                trajectory.getPosition(connection_time_sec), destination,
+                trajectory.getVelocity(connection_time_sec), constraints);
+            trajectory_end_times_sec[i + 1] = trajectories[i + 1].getTotalTime();
+            trajectory_end_times_sec[i]     = connection_time_sec;
+            num_trajectories                = i + 2;
+            return;
+        }
+        else
+        {
+            connection_time_sec -= trajectory_end_times_sec[i];
+        }
+    }
+}
+
+Point BangBangTrajectoryPath::getPosition(double t_sec) const
+{
+    for (size_t i = 0; i < num_trajectories; i++)
+    {
+        if (t_sec <= trajectory_end_times_sec[i])
+        {
+            return trajectories[i].getPosition(t_sec);
+        }
+        else
+        {
+            t_sec -= trajectory_end_times_sec[i];
+        }
+    }
+
+    return getDestination();
+}
+
+Vector BangBangTrajectoryPath::getVelocity(double t_sec) const
+{
+    for (size_t i = 0; i < num_trajectories; i++)
+    {
+        if (t_sec <= trajectory_end_times_sec[i])
+        {
+            return trajectories[i].getVelocity(t_sec);
+        }
+        else
+        {
+            t_sec -= trajectory_end_times_sec[i];
+        }
+    }
+
+    return Vector();
+}
+
+Vector BangBangTrajectoryPath::getAcceleration(double t_sec) const
+{
+    for (size_t i = 0; i < num_trajectories; i++)
+    {
+        if (t_sec <= trajectory_end_times_sec[i])
+        {
+            return trajectories[i].getAcceleration(t_sec);
+        }
+        else
+        {
+            t_sec -= trajectory_end_times_sec[i];
+        }
+    }
+
+    return Vector();
+}
+
+double BangBangTrajectoryPath::getTotalTime() const
+{
+    double total_time = 0.0;
+    for (size_t i = 0; i < num_trajectories; i++)
+    {
+        total_time += trajectory_end_times_sec[i];
+    }
+    return total_time;
+}
+
+Point BangBangTrajectoryPath::getDestination() const
+{
+    return trajectories[num_trajectories - 1].getDestination();
+}
+
+size_t BangBangTrajectoryPath::getNumTrajectories() const
+{
+    return num_trajectories;
+}
+
+TrajectoryPath BangBangTrajectoryPath::toTrajectoryPath() const
+{
+    std::vector<TrajectoryPathNode> traj_path_nodes;
+    traj_path_nodes.reserve(num_trajectories);
+    for (size_t i = 0; i < num_trajectories; i++)
+    {
+        traj_path_nodes.emplace_back(
+            std::make_shared<BangBangTrajectory2D>(trajectories[i]),
+            trajectory_end_times_sec[i]);
+    }
+    return TrajectoryPath(traj_path_nodes, BangBangTrajectory2D::generator);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
+#include "software/ai/navigator/trajectory/kinematic_constraints.h"
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+
+/**
+ * BangBangTrajectoryPath is a path of BangBangTrajectory2Ds that are connected
+ * end-to-end, like a TrajectoryPath. Unlike a TrajectoryPath, the trajectories are stored
+ * by value in a fixed size array, so copying, appending to, and sampling the path doesn't
+ * allocate memory or make virtual calls. This makes it cheap to branch off many copies of
+ * a path, e.g. when sampling paths through different sub destinations.
+ */
+class BangBangTrajectoryPath
+{
+   public:
+    BangBangTrajectoryPath() = delete;
+
+    /**
+     * Constructor
+     *
+     * @param initial_trajectory The initial trajectory of this trajectory path
+     */
+    explicit BangBangTrajectoryPath(const BangBangTrajectory2D &initial_trajectory);
+
+    /**
+     * Generate and append a new trajectory to the end of this trajectory path
+     *
+     * @note Crashes if the path would have more than MAX_NUM_TRAJECTORIES trajectories
+     *
+     * @param connection_time_sec The time where the last existing trajectory should
+     * connect to the newly generated trajectory
+     * @param destination Destination of the newly generated trajectory
+     * @param constraints Constraints of the new generated trajectory
+     */
+    void append(double connection_time_sec, const Point &destination,
+                const KinematicConstraints &constraints);
+
+    /**
+     * Get the position at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The position at time t
+     */
+    Point getPosition(double t_sec) const;
+
+    /**
+     * Get the velocity at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The velocity at time t
+     */
+    Vector getVelocity(double t_sec) const;
+
+    /**
+     * Get the acceleration at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The acceleration at time t
+     */
+    Vector getAcceleration(double t_sec) const;
+
+    /**
+     * Get the total duration of the trajectory until it reaches the destination
+     *
+     * @return The total duration for this trajectory path
+     */
+    double getTotalTime() const;
+
+    /**
+     * Get the final destination of this trajectory path
+     *
+     * @return The position which the trajectory path ends at
+     */
+    Point getDestination() const;
+
+    /**
+     * Get the number of trajectories that make up this trajectory path
+     *
+     * @return The number of trajectories in this trajectory path
+     */
+    size_t getNumTrajectories() const;
+
+    /**
+     * Convert this trajectory path to a TrajectoryPath with the same trajectories
+     *
+     * @return A TrajectoryPath with the same trajectories as this trajectory path
+     */
+    TrajectoryPath toTrajectoryPath() const;
+
+    // The trajectory planner only connects a trajectory to a sub destination with a
+    // trajectory to the destination, so paths never need more than 2 trajectories
+    static constexpr size_t MAX_NUM_TRAJECTORIES = 2;
+
+   private:
+    std::array<BangBangTrajectory2D, MAX_NUM_TRAJECTORIES> trajectories;
+    // The time at which each trajectory ends and the next trajectory begins, relative
+    // to the start of the trajectory
+    std::array<double, MAX_NUM_TRAJECTORIES> trajectory_end_times_sec;
+    size_t num_trajectories;
+};
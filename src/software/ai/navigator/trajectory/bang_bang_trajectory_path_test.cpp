@@ -0,0 +1,104 @@
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
+
+#include <gtest/gtest.h>
+
+#include "software/test_util/test_util.h"
+
+class BangBangTrajectoryPathTest : public testing::Test
+{
+   protected:
+    BangBangTrajectoryPathTest()
+        : constraints(3.0, 3.0, 3.0),
+          initial_trajectory(Point(-1, -2), Point(2, 1), Vector(1, 0), constraints)
+    {
+    }
+
+    // Checks that the paths are at the same positions and velocities over time
+    static void expectSamePath(const TrajectoryPath &expected_path,
+                               const BangBangTrajectoryPath &path)
+    {
+        ASSERT_DOUBLE_EQ(expected_path.getTotalTime(), path.getTotalTime());
+        for (double t_sec = -0.1; t_sec <= path.getTotalTime() + 0.5; t_sec += 0.05)
+        {
+            EXPECT_EQ(expected_path.getPosition(t_sec), path.getPosition(t_sec))
+                << "at t=" << t_sec;
+            EXPECT_EQ(expected_path.getVelocity(t_sec), path.getVelocity(t_sec))
+                << "at t=" << t_sec;
+            EXPECT_EQ(expected_path.getAcceleration(t_sec), path.getAcceleration(t_sec))
+                << "at t=" << t_sec;
+        }
+        EXPECT_EQ(expected_path.getDestination(), path.getDestination());
+    }
+
+    KinematicConstraints constraints;
+    BangBangTrajectory2D initial_trajectory;
+};
+
+TEST_F(BangBangTrajectoryPathTest, single_trajectory)
+{
+    BangBangTrajectoryPath path(initial_trajectory);
+
+    EXPECT_EQ(1, path.getNumTrajectories());
+    expectSamePath(
+        TrajectoryPath(std::make_shared<BangBangTrajectory2D>(initial_trajectory),
+                       BangBangTrajectory2D::generator),
+        path);
+}
+
+TEST_F(BangBangTrajectoryPathTest, append_matches_trajectory_path)
+{
+    TrajectoryPath expected_path(
+        std::make_shared<BangBangTrajectory2D>(initial_trajectory),
+        BangBangTrajectory2D::generator);
+    expected_path.append(0.4, Point(3, -1), constraints);
+
+    BangBangTrajectoryPath path(initial_trajectory);
+    path.append(0.4, Point(3, -1), constraints);
+
+    EXPECT_EQ(2, path.getNumTrajectories());
+    expectSamePath(expected_path, path);
+}
+
+TEST_F(BangBangTrajectoryPathTest, append_replaces_later_trajectories)
+{
+    TrajectoryPath expected_path(
+        std::make_shared<BangBangTrajectory2D>(initial_trajectory),
+        BangBangTrajectory2D::generator);
+    expected_path.append(0.2, Point(3, -1), constraints);
+
+    BangBangTrajectoryPath path(initial_trajectory);
+    path.append(0.8, Point(0, 3), constraints);
+    path.append(0.2, Point(3, -1), constraints);
+
+    EXPECT_EQ(2, path.getNumTrajectories());
+    expectSamePath(expected_path, path);
+}
+
+TEST_F(BangBangTrajectoryPathTest, copies_branch_independently)
+{
+    BangBangTrajectoryPath path(initial_trajectory);
+
+    BangBangTrajectoryPath first_branch = path;
+    first_branch.append(0.4, Point(3, -1), constraints);
+    BangBangTrajectoryPath second_branch = path;
+    second_branch.append(0.6, Point(0, 3), constraints);
+
+    EXPECT_EQ(1, path.getNumTrajectories());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(2, 1), path.getDestination(),
+                                               METERS_PER_MILLIMETER));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(3, -1), first_branch.getDestination(), METERS_PER_MILLIMETER));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(0, 3), second_branch.getDestination(), METERS_PER_MILLIMETER));
+}
+
+TEST_F(BangBangTrajectoryPathTest, to_trajectory_path)
+{
+    BangBangTrajectoryPath path(initial_trajectory);
+    path.append(0.4, Point(3, -1), constraints);
+
+    TrajectoryPath trajectory_path = path.toTrajectoryPath();
+
+    EXPECT_EQ(2, trajectory_path.getTrajectoryPathNodes().size());
+    expectSamePath(trajectory_path, path);
+}
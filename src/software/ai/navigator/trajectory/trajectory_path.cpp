@@ -9,6 +9,13 @@ TrajectoryPath::TrajectoryPath(const std::shared_ptr<Trajectory2D>& initial_traj
 {
 }
 
+TrajectoryPath::TrajectoryPath(const std::vector<TrajectoryPathNode>& traj_path_nodes,
+                               const TrajectoryGenerator& traj_generator)
+    : traj_path(traj_path_nodes), trajectory_generator(traj_generator)
+{
+    CHECK(!traj_path.empty()) << "TrajectoryPath was created without any trajectories";
+}
+
 void TrajectoryPath::append(double connection_time_sec, const Point& destination,
                             const KinematicConstraints& constraints)
 {
@@ -30,6 +30,17 @@ class TrajectoryPath : public Trajectory2D
     TrajectoryPath(const std::shared_ptr<Trajectory2D>& initial_trajectory,
                    const TrajectoryGenerator& traj_generator);
 
+    /**
+     * Constructor
+     *
+     * @param traj_path_nodes The trajectory path nodes of this trajectory path. Must not
+     * be empty
+     * @param traj_generator A function used to generate new trajectories given the
+     * kinematic constraints, initial position, final position, and initial velocity.
+     */
+    TrajectoryPath(const std::vector<TrajectoryPathNode>& traj_path_nodes,
+                   const TrajectoryGenerator& traj_generator);
+
     /**
      * Generate and append a new trajectory to the end of this trajectory path
      *
@@ -1,10 +1,10 @@
 #pragma once
 
 #include "software/ai/navigator/obstacle/obstacle.hpp"
-#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
 
 /**
- * A wrapper around TrajectoryPath for holding additional information about the
+ * A wrapper around BangBangTrajectoryPath for holding additional information about the
  * cost of the trajectory path
  */
 class TrajectoryPathWithCost
@@ -12,7 +12,7 @@ class TrajectoryPathWithCost
    public:
     TrajectoryPathWithCost() = delete;
 
-    explicit TrajectoryPathWithCost(const TrajectoryPath& traj_path);
+    explicit TrajectoryPathWithCost(const BangBangTrajectoryPath& traj_path);
 
     /**
      * Returns true if the trajectory collides with an obstacle
@@ -22,7 +22,7 @@ class TrajectoryPathWithCost
     bool collides() const;
 
     // The trajectory path that the costs are associated with
-    TrajectoryPath traj_path;
+    BangBangTrajectoryPath traj_path;
 
     // The duration before the trajectory leaves an obstacle that it starts
     // within. 0 if the trajectory does not start within an obstacle.
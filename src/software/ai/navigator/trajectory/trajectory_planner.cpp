@@ -57,6 +57,15 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
     const Point &start, const Point &destination, const Vector &initial_velocity,
     const KinematicConstraints &constraints, const std::vector<ObstaclePtr> &obstacles,
     const Rectangle &navigable_area, const std::optional<Point> &prev_sub_destination)
+{
+    return findTrajectory(start, destination, initial_velocity, constraints,
+                          ObstacleSet(obstacles), navigable_area, prev_sub_destination);
+}
+
+std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
+    const Point &start, const Point &destination, const Vector &initial_velocity,
+    const KinematicConstraints &constraints, const ObstacleSet &obstacles,
+    const Rectangle &navigable_area, const std::optional<Point> &prev_sub_destination)
 {
     if (constraints.getMaxVelocity() <= 0.0 || constraints.getMaxAcceleration() <= 0.0 ||
         constraints.getMaxDeceleration() <= 0.0)
@@ -70,7 +79,7 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
     // Return direct trajectory to the destination if it doesn't have any collisions
     if (!best_traj_with_cost.collides())
     {
-        return best_traj_with_cost.traj_path;
+        return best_traj_with_cost.traj_path.toTrajectoryPath();
     }
 
     // Sample trajectory paths by trying different sub destinations and connection times
@@ -98,7 +107,7 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
         {
             // Branch off of a copy of the initial trajectory at connection_time
             // to move towards the actual destination.
-            TrajectoryPath traj_path_to_dest = sub_trajectory.traj_path;
+            BangBangTrajectoryPath traj_path_to_dest = sub_trajectory.traj_path;
             traj_path_to_dest.append(connection_time, destination, constraints);
 
             // Return early for this sub destination if the trajectory can
@@ -132,22 +141,21 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
         }
     }
 
-    return best_traj_with_cost.traj_path;
+    return best_traj_with_cost.traj_path.toTrajectoryPath();
 }
 
 TrajectoryPathWithCost TrajectoryPlanner::getDirectTrajectoryWithCost(
     const Point &start, const Point &destination, const Vector &initial_velocity,
-    const KinematicConstraints &constraints, const std::vector<ObstaclePtr> &obstacles)
+    const KinematicConstraints &constraints, const ObstacleSet &obstacles)
 {
     return getTrajectoryWithCost(
-        TrajectoryPath(std::make_shared<BangBangTrajectory2D>(
-                           start, destination, initial_velocity, constraints),
-                       BangBangTrajectory2D::generator),
+        BangBangTrajectoryPath(
+            BangBangTrajectory2D(start, destination, initial_velocity, constraints)),
         obstacles, std::nullopt, std::nullopt);
 }
 
 TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
-    const TrajectoryPath &trajectory, const std::vector<ObstaclePtr> &obstacles,
+    const BangBangTrajectoryPath &trajectory, const ObstacleSet &obstacles,
     const std::optional<TrajectoryPathWithCost> &sub_traj_with_cost,
     const std::optional<double> sub_traj_duration_s)
 {
@@ -236,25 +244,14 @@ double TrajectoryPlanner::calculateCost(
 }
 
 double TrajectoryPlanner::getFirstNonCollisionTime(
-    const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
+    const BangBangTrajectoryPath &traj_path, const ObstacleSet &obstacles,
     const double search_end_time_s) const
 {
     double path_duration = traj_path.getTotalTime();
     for (double time = 0.0; time <= search_end_time_s;
          time += FORWARD_COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position       = traj_path.getPosition(time);
-        bool collision_found = false;
-        for (const ObstaclePtr &obstacle : obstacles)
-        {
-            if (obstacle->contains(position, time))
-            {
-                collision_found = true;
-                break;
-            }
-        }
-
-        if (!collision_found)
+        if (!obstacles.contains(traj_path.getPosition(time), time))
         {
             return time;
         }
@@ -263,19 +260,17 @@ double TrajectoryPlanner::getFirstNonCollisionTime(
 }
 
 std::pair<double, ObstaclePtr> TrajectoryPlanner::getFirstCollisionTime(
-    const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
+    const BangBangTrajectoryPath &traj_path, const ObstacleSet &obstacles,
     const double start_time_s, const double search_end_time_s) const
 {
     for (double time = start_time_s; time <= search_end_time_s;
          time += COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position = traj_path.getPosition(time);
-        for (const ObstaclePtr &obstacle : obstacles)
+        ObstaclePtr obstacle =
+            obstacles.findContainingObstacle(traj_path.getPosition(time), time);
+        if (obstacle)
         {
-            if (obstacle->contains(position, time))
-            {
-                return std::make_pair(time, obstacle);
-            }
+            return std::make_pair(time, obstacle);
         }
     }
 
@@ -284,24 +279,13 @@ std::pair<double, ObstaclePtr> TrajectoryPlanner::getFirstCollisionTime(
 }
 
 double TrajectoryPlanner::getLastNonCollisionTime(
-    const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
+    const BangBangTrajectoryPath &traj_path, const ObstacleSet &obstacles,
     const double search_end_time_s) const
 {
     for (double time = search_end_time_s; time >= 0.0;
          time -= COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position       = traj_path.getPosition(time);
-        bool collision_found = false;
-        for (const ObstaclePtr &obstacle : obstacles)
-        {
-            if (obstacle->contains(position, time))
-            {
-                collision_found = true;
-                break;
-            }
-        }
-
-        if (!collision_found)
+        if (!obstacles.contains(traj_path.getPosition(time), time))
         {
             return time;
         }
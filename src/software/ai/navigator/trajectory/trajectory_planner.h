@@ -3,6 +3,8 @@
 #include <optional>
 
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path_with_cost.h"
 
@@ -34,6 +36,26 @@ class TrajectoryPlanner
         const std::vector<ObstaclePtr> &obstacles, const Rectangle &navigable_area,
         const std::optional<Point> &prev_sub_destination = std::nullopt);
 
+    /**
+     * Find a trajectory from the start position to the destination which
+     * attempts to avoid the set of obstacles.
+     *
+     * @param start Start position of the trajectory
+     * @param destination Destination of the trajectory
+     * @param initial_velocity Initial velocity of the trajectory
+     * @param constraints Kinematic constraints of the trajectory
+     * @param obstacles Set of obstacles to avoid
+     * @param navigable_area The navigable area of the field
+     * @param prev_sub_destination The previous sub destination of this robot.
+     * nullopt if there is no previous sub destination
+     * @return TrajectoryPath which attempts to avoid the obstacles
+     */
+    std::optional<TrajectoryPath> findTrajectory(
+        const Point &start, const Point &destination, const Vector &initial_velocity,
+        const KinematicConstraints &constraints, const ObstacleSet &obstacles,
+        const Rectangle &navigable_area,
+        const std::optional<Point> &prev_sub_destination = std::nullopt);
+
    private:
     /**
      * Calculate the cost of the given trajectory path with cost
@@ -51,26 +73,26 @@ class TrajectoryPlanner
      * @param destination Destination of the trajectory
      * @param initial_velocity Initial velocity of the trajectory
      * @param constraints Kinematic constraints of the trajectory
-     * @param obstacles List of all obstacles
+     * @param obstacles Set of all obstacles
      * @return A trajectory path with only a single trajectory + its cost
      */
     TrajectoryPathWithCost getDirectTrajectoryWithCost(
         const Point &start, const Point &destination, const Vector &initial_velocity,
         const KinematicConstraints &constraints,
-        const std::vector<ObstaclePtr> &obstacles);
+        const ObstacleSet &obstacles);
 
     /**
      * Given a trajectory path, calculate its cost
      *
      * @param trajectory The trajectory path to calculate the cost of
-     * @param obstacles List of all obstacles
+     * @param obstacles Set of all obstacles
      * @param sub_traj_with_cost Optional cached trajectory path with cost of the sub
      * trajectory
      * @param sub_traj_duration_s Optional duration of the cached sub_traj_with_cost
      * @return The trajectory path with its cost
      */
     TrajectoryPathWithCost getTrajectoryWithCost(
-        const TrajectoryPath &trajectory, const std::vector<ObstaclePtr> &obstacles,
+        const BangBangTrajectoryPath &trajectory, const ObstacleSet &obstacles,
         const std::optional<TrajectoryPathWithCost> &sub_traj_with_cost,
         const std::optional<double> sub_traj_duration_s);
 
@@ -79,13 +101,13 @@ class TrajectoryPlanner
      * E.g. will return 0 if the trajectory's start position is not in an obstacle
      *
      * @param traj_path The trajectory path to check
-     * @param obstacles A list of all obstacles
+     * @param obstacles Set of all obstacles
      * @param search_end_time_s The latest time to check for collisions
      * @return Earliest non-collision time, or traj_path.getTotalDuration() if the
      * trajectory is in a collision from start to search_end_time_s
      */
-    double getFirstNonCollisionTime(const TrajectoryPath &traj_path,
-                                    const std::vector<ObstaclePtr> &obstacles,
+    double getFirstNonCollisionTime(const BangBangTrajectoryPath &traj_path,
+                                    const ObstacleSet &obstacles,
                                     const double search_end_time_s) const;
 
     /**
@@ -93,7 +115,7 @@ class TrajectoryPlanner
      * for the given trajectory path and obstacles.
      *
      * @param traj_path The trajectory path to check
-     * @param obstacles The list of all obstacles
+     * @param obstacles The set of all obstacles
      * @param start_time_s The time in seconds to start the search from
      * @param search_end_time_s The time in seconds to stop the search at
      * @return The first collision time within [start_time_sec and search_end_time_s]
@@ -101,7 +123,7 @@ class TrajectoryPlanner
      * std::numeric_limits<double>::max() and nullptr.
      */
     std::pair<double, ObstaclePtr> getFirstCollisionTime(
-        const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
+        const BangBangTrajectoryPath &traj_path, const ObstacleSet &obstacles,
         const double start_time_s, const double search_end_time_s) const;
 
     /**
@@ -110,14 +132,14 @@ class TrajectoryPlanner
      * end in a collision.
      *
      * @param traj_path The trajectory path to check
-     * @param obstacles The list of all obstacles
+     * @param obstacles The set of all obstacles
      * @param search_end_time_s The latest time to check for collisions. Assumed to
      * be within the duration of the trajectory path.
      * @return Time in seconds at which the trajectory is not in a collision. Result
      * will be in the range [0, search_end_time_s].
      */
-    double getLastNonCollisionTime(const TrajectoryPath &traj_path,
-                                   const std::vector<ObstaclePtr> &obstacles,
+    double getLastNonCollisionTime(const BangBangTrajectoryPath &traj_path,
+                                   const ObstacleSet &obstacles,
                                    const double search_end_time_s) const;
 
     /**
@@ -8,6 +8,7 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/time_to_travel.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/pass_cost_map.h"
 #include "software/geom/algorithms/closest_point.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/convex_angle.h"
@@ -56,6 +57,16 @@ double ratePassNotTooClose(const Pass& pass,
                              pass.receiverPoint(), 2.0);
 }
 
+double ratePassNotTooFar(const Pass& pass,
+                         const TbotsProto::PassingConfig& passing_config)
+{
+    // We want to encourage passes that are not too far away from the passer
+    // to stop the robots from trying to pass across the field
+    return circleSigmoid(
+        Circle(pass.passerPoint(), passing_config.receiver_ideal_max_distance_meters()),
+        pass.receiverPoint(), 2.0);
+}
+
 double rateReceivingPosition(const World& world, const Pass& pass,
                              const TbotsProto::PassingConfig& passing_config)
 {
@@ -64,11 +75,7 @@ double rateReceivingPosition(const World& world, const Pass& pass,
 
     double receiver_up_field_rating = ratePassForwardQuality(pass, passing_config);
 
-    // We want to encourage passes that are not too far away from the passer
-    // to stop the robots from trying to pass across the field
-    double receiver_not_too_far_rating = circleSigmoid(
-        Circle(pass.passerPoint(), passing_config.receiver_ideal_max_distance_meters()),
-        pass.receiverPoint(), 2.0);
+    double receiver_not_too_far_rating   = ratePassNotTooFar(pass, passing_config);
     double receiver_not_too_close_rating = ratePassNotTooClose(pass, passing_config);
 
     double enemy_risk_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
@@ -356,124 +363,56 @@ void samplePassesForVisualization(const World& world,
     int num_cols = passing_config.cost_vis_config().num_cols();
     // this is for DivB field, for DivA, it would be num_cols * 3 / 4 as specified in
     // field.cpp
-    int num_rows  = num_cols * 2 / 3;
-    double width  = world.field().xLength() / num_cols;
-    double height = world.field().yLength() / num_rows;
-
-    std::vector<double> costs;
-    double static_pos_quality_costs;
-    double pass_friendly_capability_costs;
-    double pass_enemy_risk_costs;
-    double enemy_proximity_costs;
-    double enemy_interception_costs;
-    double pass_shoot_score_costs;
-    double receiver_position_costs;
-    double keep_away_position_costs;
-    double pass_forward_costs;
-    double pass_not_too_close_costs;
-
-    // We loop column wise (in the same order as how zones are defined)
-    for (int i = 0; i < num_cols; i++)
+    int num_rows = num_cols * 2 / 3;
+
+    const auto& cost_vis_config = passing_config.cost_vis_config();
+    std::vector<PassCostComponent> components;
+    if (cost_vis_config.static_position_quality())
     {
-        // x coordinate of the centre of the column
-        double x = width * i + width / 2 - world.field().xLength() / 2;
-        for (int j = 0; j < num_rows; j++)
-        {
-            // y coordinate of the centre of the row
-            double y = height * j + height / 2 - world.field().yLength() / 2;
-            Point curr_point(x, y);
-            auto pass = Pass::fromDestReceiveSpeed(world.ball().position(), curr_point,
-                                                   passing_config);
-
-            // default values
-            static_pos_quality_costs       = 1;
-            pass_friendly_capability_costs = 1;
-            pass_enemy_risk_costs          = 1;
-            enemy_proximity_costs          = 1;
-            enemy_interception_costs       = 1;
-            pass_shoot_score_costs         = 1;
-            receiver_position_costs        = 1;
-            keep_away_position_costs       = 1;
-            pass_forward_costs             = 1;
-            pass_not_too_close_costs       = 1;
-
-            // getStaticPositionQuality
-            if (passing_config.cost_vis_config().static_position_quality())
-            {
-                static_pos_quality_costs = getStaticPositionQuality(
-                    world.field(), pass.receiverPoint(), passing_config);
-            }
-
-            // ratePassForwardQuality
-            if (passing_config.cost_vis_config().pass_forward_quality())
-            {
-                pass_forward_costs = ratePassForwardQuality(pass, passing_config);
-            }
-
-            // ratePassNotTooClose
-            if (passing_config.cost_vis_config().pass_not_too_close_quality())
-            {
-                pass_not_too_close_costs = ratePassNotTooClose(pass, passing_config);
-            }
-
-            // ratePassFriendlyCapability
-            if (passing_config.cost_vis_config().pass_friendly_capability())
-            {
-                pass_friendly_capability_costs = ratePassFriendlyCapability(
-                    world.friendlyTeam(), pass, passing_config);
-            }
-
-            // ratePassEnemyRisk
-            if (passing_config.cost_vis_config().pass_enemy_risk())
-            {
-                pass_enemy_risk_costs =
-                    ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
-            }
-
-            // ratePassShootScore
-            if (passing_config.cost_vis_config().pass_shoot_score())
-            {
-                pass_shoot_score_costs = ratePassShootScore(
-                    world.field(), world.enemyTeam(), pass, passing_config);
-            }
-
-            // calculateInterceptRisk
-            if (passing_config.cost_vis_config().enemy_interception_risk())
-            {
-                enemy_interception_costs =
-                    calculateInterceptRisk(world.enemyTeam(), pass, passing_config);
-            }
-
-            // calculateProximityRisk
-            if (passing_config.cost_vis_config().enemy_proximity_risk())
-            {
-                enemy_proximity_costs =
-                    calculateProximityRisk(curr_point, world.enemyTeam(), passing_config);
-            }
-
-            // rateReceivingPosition
-            if (passing_config.cost_vis_config().receiver_position_score())
-            {
-                receiver_position_costs =
-                    rateReceivingPosition(world, pass, passing_config);
-            }
-
-            // rateKeepAwayPosition
-            if (passing_config.cost_vis_config().passer_position_score() &&
-                best_pass_so_far.has_value())
-            {
-                keep_away_position_costs =
-                    rateKeepAwayPosition(curr_point, world, best_pass_so_far.value(),
-                                         world.field().fieldBoundary(), passing_config);
-            }
-
-            costs.push_back(static_pos_quality_costs * pass_friendly_capability_costs *
-                            pass_enemy_risk_costs * enemy_proximity_costs *
-                            pass_shoot_score_costs * enemy_interception_costs *
-                            receiver_position_costs * keep_away_position_costs *
-                            pass_forward_costs * pass_not_too_close_costs);
-        }
+        components.push_back(PassCostComponent::STATIC_POSITION_QUALITY);
+    }
+    if (cost_vis_config.pass_forward_quality())
+    {
+        components.push_back(PassCostComponent::PASS_FORWARD_QUALITY);
     }
+    if (cost_vis_config.pass_not_too_close_quality())
+    {
+        components.push_back(PassCostComponent::PASS_NOT_TOO_CLOSE_QUALITY);
+    }
+    if (cost_vis_config.pass_friendly_capability())
+    {
+        components.push_back(PassCostComponent::PASS_FRIENDLY_CAPABILITY);
+    }
+    if (cost_vis_config.pass_enemy_risk())
+    {
+        components.push_back(PassCostComponent::PASS_ENEMY_RISK);
+    }
+    if (cost_vis_config.pass_shoot_score())
+    {
+        components.push_back(PassCostComponent::PASS_SHOOT_SCORE);
+    }
+    if (cost_vis_config.enemy_interception_risk())
+    {
+        components.push_back(PassCostComponent::ENEMY_INTERCEPTION_RISK);
+    }
+    if (cost_vis_config.enemy_proximity_risk())
+    {
+        components.push_back(PassCostComponent::ENEMY_PROXIMITY_RISK);
+    }
+    if (cost_vis_config.receiver_position_score())
+    {
+        components.push_back(PassCostComponent::RECEIVER_POSITION_SCORE);
+    }
+    if (cost_vis_config.passer_position_score())
+    {
+        components.push_back(PassCostComponent::KEEP_AWAY_POSITION_SCORE);
+    }
+
+    // This runs on the AI thread every tick, so the grid is evaluated on the calling
+    // thread instead of starting a thread per hardware thread every tick
+    PassCostMap cost_map(world, passing_config, num_cols, num_rows, components,
+                         best_pass_so_far, 1);
 
-    LOG(VISUALIZE) << *createCostVisualization(costs, num_rows, num_cols);
+    LOG(VISUALIZE) << *createCostVisualization(cost_map.getCombinedCosts(components),
+                                               num_rows, num_cols);
 }
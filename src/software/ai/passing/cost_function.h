@@ -103,6 +103,19 @@ double ratePassForwardQuality(const Pass& pass,
 double ratePassNotTooClose(const Pass& pass,
                            const TbotsProto::PassingConfig& passing_config);
 
+/**
+ * Encourage passes that are not too far away from the passer, to stop the robots from
+ * trying to pass across the field
+ *
+ * @param pass The pass to rate
+ * @param passing_config The passing config used for tuning
+ * @return A value in [0,1] indicating the quality of the pass, where
+ *        1 indicates the pass is ideal and 0 indicates the pass is bad as
+ *        it is too far away from the passer.
+ */
+double ratePassNotTooFar(const Pass& pass,
+                         const TbotsProto::PassingConfig& passing_config);
+
 /**
  * Calculates the likelihood that the given pass will be intercepted
  *
@@ -206,6 +219,8 @@ double rateKeepAwayPosition(const Point& keep_away_position, const World& world,
  * The sampled values are sent over protobuf to thunderscope as a CostVisualization
  * message. These values are eventually visualized in thunderscope in the cost_vis widget
  *
+ * The passes are sampled on the calling thread, since this is called from the AI
+ *
  * @param world The world in which to sample passes
  * @param passing_config The passing config used for tuning
  * @param best_pass_so_far The best pass so far used for sampling best passer position
@@ -1,28 +1,31 @@
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
 
+#include <cmath>
+
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/point.h"
 #include "software/geom/rectangle.h"
 
 EighteenZonePitchDivision::EighteenZonePitchDivision(const Field& field)
+    : field_lines_(field.fieldLines()),
+      zone_width_(field.xLength() / NUM_ZONE_COLUMNS),
+      zone_height_(field.yLength() / NUM_ZONE_ROWS)
 {
-    const double zone_width  = field.xLength() / 6;
-    const double zone_height = field.yLength() / 3;
-
-    for (double pos_x = -field.xLength() / 2; pos_x < field.xLength() / 2;
-         pos_x += zone_width)
+    // Zones are numbered column by column from the friendly goal line, and from the
+    // positive y sideline within each column
+    for (unsigned int column = 0; column < NUM_ZONE_COLUMNS; column++)
     {
-        for (double pos_y = field.yLength() / 2; pos_y > -field.yLength() / 2;
-             pos_y -= zone_height)
+        for (unsigned int row = 0; row < NUM_ZONE_ROWS; row++)
         {
+            const double pos_x = field_lines_.xMin() + column * zone_width_;
+            const double pos_y = field_lines_.yMax() - row * zone_height_;
             pitch_division_.emplace_back(Rectangle(
-                Point(pos_x, pos_y), Point(pos_x + zone_width, pos_y - zone_height)));
+                Point(pos_x, pos_y), Point(pos_x + zone_width_, pos_y - zone_height_)));
         }
     }
 
     constexpr auto enum_values = reflective_enum::values<EighteenZoneId>();
     zones_                     = std::vector(enum_values.begin(), enum_values.end());
-    field_lines_               = std::make_shared<Rectangle>(field.fieldLines());
 }
 
 const Rectangle& EighteenZonePitchDivision::getZone(EighteenZoneId zone_id) const
@@ -32,15 +35,25 @@ const Rectangle& EighteenZonePitchDivision::getZone(EighteenZoneId zone_id) cons
 
 EighteenZoneId EighteenZonePitchDivision::getZoneId(const Point& position) const
 {
-    if (!contains(*field_lines_, position))
+    if (!contains(field_lines_, position))
     {
         throw std::invalid_argument("requested position not on field!");
     }
 
-    auto zone_id = *std::find_if(zones_.begin(), zones_.end(),
-                                 [this, position](const EighteenZoneId& id)
-                                 { return contains(getZone(id), position); });
-    return zone_id;
+    // The index of the zone along one axis, rounding a position on the edge between
+    // two zones down to the zone with the lower index
+    auto zone_index = [](double distance, double zone_length, unsigned int num_zones)
+    {
+        const double index = std::ceil(distance / zone_length) - 1;
+        return static_cast<unsigned int>(
+            std::clamp(index, 0.0, static_cast<double>(num_zones - 1)));
+    };
+
+    const unsigned int column =
+        zone_index(position.x() - field_lines_.xMin(), zone_width_, NUM_ZONE_COLUMNS);
+    const unsigned int row =
+        zone_index(field_lines_.yMax() - position.y(), zone_height_, NUM_ZONE_ROWS);
+    return static_cast<EighteenZoneId>(column * NUM_ZONE_ROWS + row);
 }
 
 const std::vector<EighteenZoneId>& EighteenZonePitchDivision::getAllZoneIds() const
@@ -1,6 +1,4 @@
 #pragma once
-#include <memory>
-
 #include "software/ai/passing/field_pitch_division.h"
 #include "software/geom/rectangle.h"
 #include "software/util/make_enum/make_enum.hpp"
@@ -44,10 +42,22 @@ class EighteenZonePitchDivision : public FieldPitchDivision<EighteenZoneId>
 
     const Rectangle& getZone(EighteenZoneId zone_id) const override;
     const std::vector<EighteenZoneId>& getAllZoneIds() const override;
+    /**
+     * Finds the zone a position is in from its distance to the corner of the field
+     * lines, without checking each zone. A position on the edge between zones is in
+     * the zone with the lowest id.
+     *
+     * @throws std::invalid_argument if the position is not within the field lines
+     */
     EighteenZoneId getZoneId(const Point& position) const override;
 
    private:
-    std::shared_ptr<Rectangle> field_lines_;
+    static constexpr unsigned int NUM_ZONE_COLUMNS = 6;
+    static constexpr unsigned int NUM_ZONE_ROWS    = 3;
+
+    Rectangle field_lines_;
+    double zone_width_;
+    double zone_height_;
     std::vector<Rectangle> pitch_division_;
     std::vector<EighteenZoneId> zones_;
 };
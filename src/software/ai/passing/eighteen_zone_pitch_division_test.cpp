@@ -133,3 +133,34 @@ TEST(EighteenZonePitchDivision, test_no_zone_overlap)
         }
     }
 }
+
+TEST(EighteenZonePitchDivision, test_get_zone_id_matches_zone_containing_position)
+{
+    auto field          = Field::createSSLDivisionAField();
+    auto pitch_division = EighteenZonePitchDivision(field);
+
+    // Step through the field lines in steps that land on the edges between zones
+    for (double x = -field.xLength() / 2; x <= field.xLength() / 2; x += 0.25)
+    {
+        for (double y = -field.yLength() / 2; y <= field.yLength() / 2; y += 0.25)
+        {
+            const Point position(x, y);
+            const auto first_containing_zone = *std::find_if(
+                pitch_division.getAllZoneIds().begin(),
+                pitch_division.getAllZoneIds().end(), [&](EighteenZoneId zone_id)
+                { return contains(pitch_division.getZone(zone_id), position); });
+
+            EXPECT_EQ(first_containing_zone, pitch_division.getZoneId(position))
+                << position;
+        }
+    }
+}
+
+TEST(EighteenZonePitchDivision, test_get_zone_id_off_field_throws)
+{
+    auto field          = Field::createSSLDivisionBField();
+    auto pitch_division = EighteenZonePitchDivision(field);
+
+    EXPECT_THROW(pitch_division.getZoneId(Point(field.xLength(), 0)),
+                 std::invalid_argument);
+}
@@ -0,0 +1,268 @@
+#include "software/ai/passing/pass_cost_map.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "software/ai/passing/cost_function.h"
+
+PassCostMap::PassCostMap(const World& world,
+                         const TbotsProto::PassingConfig& passing_config,
+                         unsigned int num_cols, unsigned int num_rows,
+                         const std::vector<PassCostComponent>& components,
+                         const std::optional<Pass>& best_pass_so_far,
+                         unsigned int num_threads)
+    : num_cols_(num_cols),
+      num_rows_(num_rows),
+      grid_origin_(-world.field().xLength() / 2, -world.field().yLength() / 2),
+      cell_x_length_(world.field().xLength() / std::max(num_cols, 1u)),
+      cell_y_length_(world.field().yLength() / std::max(num_rows, 1u))
+{
+    requested_.fill(false);
+    for (PassCostComponent component : components)
+    {
+        requested_[static_cast<size_t>(component)] = true;
+    }
+
+    for (auto& costs : costs_)
+    {
+        costs.assign(static_cast<size_t>(num_cols_) * num_rows_, 1.0);
+    }
+
+    if (num_threads == 0)
+    {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    num_threads = std::min(num_threads, std::max(num_cols_, 1u));
+
+    if (num_threads <= 1)
+    {
+        evaluateColumns(world, passing_config, best_pass_so_far, 0, num_cols_);
+        return;
+    }
+
+    // Each thread evaluates a contiguous block of columns. The blocks don't overlap,
+    // so the threads write to disjoint parts of the cost arrays
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    unsigned int cols_per_thread = (num_cols_ + num_threads - 1) / num_threads;
+    for (unsigned int start_col = 0; start_col < num_cols_; start_col += cols_per_thread)
+    {
+        unsigned int end_col = std::min(start_col + cols_per_thread, num_cols_);
+        workers.emplace_back(&PassCostMap::evaluateColumns, this, std::cref(world),
+                             std::cref(passing_config), std::cref(best_pass_so_far),
+                             start_col, end_col);
+    }
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+std::vector<PassCostComponent> PassCostMap::allComponents()
+{
+    constexpr auto values = reflective_enum::values<PassCostComponent>();
+    return std::vector<PassCostComponent>(values.begin(), values.end());
+}
+
+unsigned int PassCostMap::numCols() const
+{
+    return num_cols_;
+}
+
+unsigned int PassCostMap::numRows() const
+{
+    return num_rows_;
+}
+
+Point PassCostMap::cellCentre(unsigned int col, unsigned int row) const
+{
+    return Point(grid_origin_.x() + cell_x_length_ * col + cell_x_length_ / 2,
+                 grid_origin_.y() + cell_y_length_ * row + cell_y_length_ / 2);
+}
+
+bool PassCostMap::hasComponent(PassCostComponent component) const
+{
+    return requested_[static_cast<size_t>(component)];
+}
+
+const std::vector<double>& PassCostMap::getCosts(PassCostComponent component) const
+{
+    return costs_[static_cast<size_t>(component)];
+}
+
+double PassCostMap::getCost(PassCostComponent component, unsigned int col,
+                            unsigned int row) const
+{
+    return getCosts(component).at(static_cast<size_t>(col) * num_rows_ + row);
+}
+
+std::vector<double> PassCostMap::getCombinedCosts(
+    const std::vector<PassCostComponent>& components) const
+{
+    std::vector<double> combined_costs(static_cast<size_t>(num_cols_) * num_rows_, 1.0);
+    for (PassCostComponent component : components)
+    {
+        const std::vector<double>& costs = getCosts(component);
+        for (size_t i = 0; i < combined_costs.size(); i++)
+        {
+            combined_costs[i] *= costs[i];
+        }
+    }
+    return combined_costs;
+}
+
+void PassCostMap::evaluateColumns(const World& world,
+                                  const TbotsProto::PassingConfig& passing_config,
+                                  const std::optional<Pass>& best_pass_so_far,
+                                  unsigned int start_col, unsigned int end_col)
+{
+    auto requested = [this](PassCostComponent component)
+    { return requested_[static_cast<size_t>(component)]; };
+
+    // Work out which underlying cost functions are needed, taking into account the
+    // composite ratings that are built from them
+    const bool need_receiver_position =
+        requested(PassCostComponent::RECEIVER_POSITION_SCORE);
+    const bool need_pass_rating = requested(PassCostComponent::PASS_RATING);
+    const bool need_enemy_risk  = requested(PassCostComponent::PASS_ENEMY_RISK) ||
+                                 need_receiver_position || need_pass_rating;
+
+    const bool need_static = requested(PassCostComponent::STATIC_POSITION_QUALITY) ||
+                             need_receiver_position || need_pass_rating;
+    const bool need_forward = requested(PassCostComponent::PASS_FORWARD_QUALITY) ||
+                              need_receiver_position || need_pass_rating;
+    const bool need_not_too_close =
+        requested(PassCostComponent::PASS_NOT_TOO_CLOSE_QUALITY) ||
+        need_receiver_position || need_pass_rating;
+    const bool need_not_too_far =
+        requested(PassCostComponent::PASS_NOT_TOO_FAR_QUALITY) || need_receiver_position;
+    const bool need_friendly =
+        requested(PassCostComponent::PASS_FRIENDLY_CAPABILITY) || need_pass_rating;
+    const bool need_intercept =
+        requested(PassCostComponent::ENEMY_INTERCEPTION_RISK) || need_enemy_risk;
+    const bool need_proximity =
+        requested(PassCostComponent::ENEMY_PROXIMITY_RISK) || need_enemy_risk;
+    const bool need_shoot = requested(PassCostComponent::PASS_SHOOT_SCORE) ||
+                            need_receiver_position || need_pass_rating;
+    const bool need_keep_away =
+        requested(PassCostComponent::KEEP_AWAY_POSITION_SCORE) &&
+        best_pass_so_far.has_value();
+
+    // Values that only depend on the world are computed once for every cell
+    const Point passer_point       = world.ball().position();
+    const Field& field             = world.field();
+    const Team& friendly_team      = world.friendlyTeam();
+    const Team& enemy_team         = world.enemyTeam();
+    const Rectangle field_boundary = field.fieldBoundary();
+
+    // Components that are only computed as an input to another component are not
+    // stored, so that every component that was not requested reads as 1
+    auto set_cost = [&](PassCostComponent component, size_t index, double cost)
+    {
+        if (requested(component))
+        {
+            costs_[static_cast<size_t>(component)][index] = cost;
+        }
+    };
+
+    for (unsigned int col = start_col; col < end_col; col++)
+    {
+        for (unsigned int row = 0; row < num_rows_; row++)
+        {
+            const size_t index         = static_cast<size_t>(col) * num_rows_ + row;
+            const Point receiver_point = cellCentre(col, row);
+            const Pass pass =
+                Pass::fromDestReceiveSpeed(passer_point, receiver_point, passing_config);
+
+            double static_quality        = 1.0;
+            double forward_quality       = 1.0;
+            double not_too_close_quality = 1.0;
+            double not_too_far_quality   = 1.0;
+            double friendly_capability   = 1.0;
+            double intercept_risk        = 0.0;
+            double proximity_risk        = 0.0;
+            double shoot_score           = 1.0;
+
+            if (need_static)
+            {
+                static_quality =
+                    getStaticPositionQuality(field, receiver_point, passing_config);
+                set_cost(PassCostComponent::STATIC_POSITION_QUALITY, index,
+                         static_quality);
+            }
+            if (need_forward)
+            {
+                forward_quality = ratePassForwardQuality(pass, passing_config);
+                set_cost(PassCostComponent::PASS_FORWARD_QUALITY, index, forward_quality);
+            }
+            if (need_not_too_close)
+            {
+                not_too_close_quality = ratePassNotTooClose(pass, passing_config);
+                set_cost(PassCostComponent::PASS_NOT_TOO_CLOSE_QUALITY, index,
+                         not_too_close_quality);
+            }
+            if (need_not_too_far)
+            {
+                not_too_far_quality = ratePassNotTooFar(pass, passing_config);
+                set_cost(PassCostComponent::PASS_NOT_TOO_FAR_QUALITY, index,
+                         not_too_far_quality);
+            }
+            if (need_friendly)
+            {
+                friendly_capability =
+                    ratePassFriendlyCapability(friendly_team, pass, passing_config);
+                set_cost(PassCostComponent::PASS_FRIENDLY_CAPABILITY, index,
+                         friendly_capability);
+            }
+            if (need_intercept)
+            {
+                intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+                set_cost(PassCostComponent::ENEMY_INTERCEPTION_RISK, index,
+                         intercept_risk);
+            }
+            if (need_proximity)
+            {
+                proximity_risk =
+                    calculateProximityRisk(receiver_point, enemy_team, passing_config);
+                set_cost(PassCostComponent::ENEMY_PROXIMITY_RISK, index, proximity_risk);
+            }
+            if (need_shoot)
+            {
+                shoot_score = ratePassShootScore(field, enemy_team, pass, passing_config);
+                set_cost(PassCostComponent::PASS_SHOOT_SCORE, index, shoot_score);
+            }
+
+            // Same as ratePassEnemyRisk
+            const double enemy_risk = 1 - std::max(intercept_risk, proximity_risk);
+            if (need_enemy_risk)
+            {
+                set_cost(PassCostComponent::PASS_ENEMY_RISK, index, enemy_risk);
+            }
+
+            // Same as rateReceivingPosition
+            if (need_receiver_position)
+            {
+                set_cost(PassCostComponent::RECEIVER_POSITION_SCORE, index,
+                         static_quality * forward_quality * not_too_far_quality *
+                             not_too_close_quality * enemy_risk * shoot_score);
+            }
+
+            // Same as ratePass
+            if (need_pass_rating)
+            {
+                set_cost(PassCostComponent::PASS_RATING, index,
+                         static_quality * not_too_close_quality * friendly_capability *
+                             enemy_risk * forward_quality * shoot_score);
+            }
+
+            if (need_keep_away)
+            {
+                set_cost(PassCostComponent::KEEP_AWAY_POSITION_SCORE, index,
+                         rateKeepAwayPosition(receiver_point, world,
+                                              best_pass_so_far.value(), field_boundary,
+                                              passing_config));
+            }
+        }
+    }
+}
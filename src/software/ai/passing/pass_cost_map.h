@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/passing/pass.h"
+#include "software/util/make_enum/make_enum.hpp"
+#include "software/world/world.h"
+
+/**
+ * The pass cost functions that can be evaluated over a grid:
+ *
+ * STATIC_POSITION_QUALITY: getStaticPositionQuality
+ * PASS_FORWARD_QUALITY: ratePassForwardQuality
+ * PASS_NOT_TOO_CLOSE_QUALITY: ratePassNotTooClose
+ * PASS_NOT_TOO_FAR_QUALITY: ratePassNotTooFar
+ * PASS_FRIENDLY_CAPABILITY: ratePassFriendlyCapability
+ * PASS_ENEMY_RISK: ratePassEnemyRisk
+ * ENEMY_INTERCEPTION_RISK: calculateInterceptRisk
+ * ENEMY_PROXIMITY_RISK: calculateProximityRisk
+ * PASS_SHOOT_SCORE: ratePassShootScore
+ * RECEIVER_POSITION_SCORE: rateReceivingPosition
+ * KEEP_AWAY_POSITION_SCORE: rateKeepAwayPosition
+ * PASS_RATING: ratePass
+ */
+MAKE_ENUM(PassCostComponent, STATIC_POSITION_QUALITY, PASS_FORWARD_QUALITY,
+          PASS_NOT_TOO_CLOSE_QUALITY, PASS_NOT_TOO_FAR_QUALITY, PASS_FRIENDLY_CAPABILITY,
+          PASS_ENEMY_RISK, ENEMY_INTERCEPTION_RISK, ENEMY_PROXIMITY_RISK,
+          PASS_SHOOT_SCORE, RECEIVER_POSITION_SCORE, KEEP_AWAY_POSITION_SCORE,
+          PASS_RATING);
+
+/**
+ * Evaluates the pass cost functions over a uniform grid covering the field of play.
+ *
+ * Each grid cell is rated as a pass from the ball to the centre of the cell, the same
+ * way samplePassesForVisualization does. Every cell evaluates each underlying cost
+ * function at most once and the composite ratings (ratePass, rateReceivingPosition,
+ * ratePassEnemyRisk) are assembled from those results, so enabling several components
+ * is not much more expensive than enabling the most expensive one. Columns are
+ * evaluated in parallel.
+ *
+ * The costs of each component are stored in one contiguous array of
+ * num_cols * num_rows values, ordered column by column (i.e. the value of the cell in
+ * column i and row j is at index i * num_rows + j), which matches the order expected by
+ * the CostVisualization proto. Components that were not requested are filled with 1.
+ */
+class PassCostMap
+{
+   public:
+    static constexpr size_t NUM_COMPONENTS = reflective_enum::size<PassCostComponent>();
+
+    /**
+     * Evaluates the requested cost components over the field
+     *
+     * @param world The world in which to rate the passes
+     * @param passing_config The passing config used for tuning
+     * @param num_cols The number of columns in the grid along the x axis
+     * @param num_rows The number of rows in the grid along the y axis
+     * @param components The components to evaluate
+     * @param best_pass_so_far The best pass so far, needed to evaluate
+     * KEEP_AWAY_POSITION_SCORE. If not given, that component is left at 1
+     * @param num_threads The number of threads to evaluate the grid with, 0 to use the
+     * number of hardware threads available
+     */
+    PassCostMap(const World& world, const TbotsProto::PassingConfig& passing_config,
+                unsigned int num_cols, unsigned int num_rows,
+                const std::vector<PassCostComponent>& components = allComponents(),
+                const std::optional<Pass>& best_pass_so_far      = std::nullopt,
+                unsigned int num_threads                         = 0);
+
+    /**
+     * Gets every cost component
+     *
+     * @return a list of all cost components
+     */
+    static std::vector<PassCostComponent> allComponents();
+
+    /**
+     * Gets the number of columns (cells along the x axis) in the grid
+     *
+     * @return the number of columns
+     */
+    unsigned int numCols() const;
+
+    /**
+     * Gets the number of rows (cells along the y axis) in the grid
+     *
+     * @return the number of rows
+     */
+    unsigned int numRows() const;
+
+    /**
+     * Gets the centre of the given cell
+     *
+     * @param col The column of the cell
+     * @param row The row of the cell
+     *
+     * @return the centre of the cell on the field
+     */
+    Point cellCentre(unsigned int col, unsigned int row) const;
+
+    /**
+     * Whether the given component was evaluated
+     *
+     * @param component The cost component
+     *
+     * @return true if the component was requested when creating this cost map
+     */
+    bool hasComponent(PassCostComponent component) const;
+
+    /**
+     * Gets the costs of a component over the grid
+     *
+     * @param component The cost component
+     *
+     * @return The num_cols * num_rows costs of the component, ordered column by column
+     */
+    const std::vector<double>& getCosts(PassCostComponent component) const;
+
+    /**
+     * Gets the cost of a component at the given cell
+     *
+     * @param component The cost component
+     * @param col The column of the cell
+     * @param row The row of the cell
+     *
+     * @return the cost of the component at the given cell
+     */
+    double getCost(PassCostComponent component, unsigned int col,
+                   unsigned int row) const;
+
+    /**
+     * Multiplies the given components together cell by cell
+     *
+     * @param components The components to multiply
+     *
+     * @return The num_cols * num_rows products, ordered column by column
+     */
+    std::vector<double> getCombinedCosts(
+        const std::vector<PassCostComponent>& components) const;
+
+   private:
+    /**
+     * Evaluates the columns in [start_col, end_col)
+     *
+     * @param world The world in which to rate the passes
+     * @param passing_config The passing config used for tuning
+     * @param best_pass_so_far The best pass so far
+     * @param start_col The first column to evaluate
+     * @param end_col One past the last column to evaluate
+     */
+    void evaluateColumns(const World& world,
+                         const TbotsProto::PassingConfig& passing_config,
+                         const std::optional<Pass>& best_pass_so_far,
+                         unsigned int start_col, unsigned int end_col);
+
+    unsigned int num_cols_;
+    unsigned int num_rows_;
+
+    // The bottom left corner of the grid and the size of each cell
+    Point grid_origin_;
+    double cell_x_length_;
+    double cell_y_length_;
+
+    // Which components were requested
+    std::array<bool, NUM_COMPONENTS> requested_;
+
+    // The costs of each component, indexed by the component's enum value
+    std::array<std::vector<double>, NUM_COMPONENTS> costs_;
+};
@@ -0,0 +1,177 @@
+#include "software/ai/passing/pass_cost_map.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/passing/cost_function.h"
+#include "software/test_util/test_util.h"
+
+class PassCostMapTest : public testing::Test
+{
+   protected:
+    PassCostMapTest() : world(::TestUtil::createBlankTestingWorld())
+    {
+        world->updateFriendlyTeamState(Team(
+            {
+                Robot(0, {-1, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0)),
+                Robot(1, {1, 1.5}, {0.5, 0}, Angle::half(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0)),
+                Robot(2, {2.5, -1}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0)),
+            },
+            Duration::fromSeconds(10)));
+        world->updateEnemyTeamState(Team(
+            {
+                Robot(0, {0.5, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0)),
+                Robot(1, {3, 0.5}, {-1, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0)),
+                Robot(2, {4.2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0)),
+            },
+            Duration::fromSeconds(10)));
+        world->updateBall(
+            Ball(BallState(Point(-1, 0), Vector(0, 0)), Timestamp::fromSeconds(0)));
+    }
+
+    std::shared_ptr<World> world;
+    TbotsProto::PassingConfig passing_config;
+
+    static constexpr unsigned int NUM_COLS = 12;
+    static constexpr unsigned int NUM_ROWS = 8;
+};
+
+TEST_F(PassCostMapTest, cell_centres_cover_the_field)
+{
+    PassCostMap cost_map(*world, passing_config, NUM_COLS, NUM_ROWS, {}, std::nullopt,
+                         1);
+
+    const double cell_x_length = world->field().xLength() / NUM_COLS;
+    const double cell_y_length = world->field().yLength() / NUM_ROWS;
+
+    EXPECT_EQ(NUM_COLS, cost_map.numCols());
+    EXPECT_EQ(NUM_ROWS, cost_map.numRows());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(-world->field().xLength() / 2 + cell_x_length / 2,
+              -world->field().yLength() / 2 + cell_y_length / 2),
+        cost_map.cellCentre(0, 0), 1e-9));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(world->field().xLength() / 2 - cell_x_length / 2,
+              world->field().yLength() / 2 - cell_y_length / 2),
+        cost_map.cellCentre(NUM_COLS - 1, NUM_ROWS - 1), 1e-9));
+}
+
+TEST_F(PassCostMapTest, matches_per_pass_cost_functions)
+{
+    Pass best_pass(Point(-1, 0), Point(1, 1.5), 4.0);
+    PassCostMap cost_map(*world, passing_config, NUM_COLS, NUM_ROWS,
+                         PassCostMap::allComponents(), best_pass);
+
+    for (unsigned int col = 0; col < NUM_COLS; col++)
+    {
+        for (unsigned int row = 0; row < NUM_ROWS; row++)
+        {
+            Point receiver_point = cost_map.cellCentre(col, row);
+            Pass pass = Pass::fromDestReceiveSpeed(world->ball().position(),
+                                                   receiver_point, passing_config);
+
+            EXPECT_DOUBLE_EQ(
+                getStaticPositionQuality(world->field(), receiver_point, passing_config),
+                cost_map.getCost(PassCostComponent::STATIC_POSITION_QUALITY, col, row));
+            EXPECT_DOUBLE_EQ(
+                ratePassForwardQuality(pass, passing_config),
+                cost_map.getCost(PassCostComponent::PASS_FORWARD_QUALITY, col, row));
+            EXPECT_DOUBLE_EQ(
+                ratePassNotTooClose(pass, passing_config),
+                cost_map.getCost(PassCostComponent::PASS_NOT_TOO_CLOSE_QUALITY, col, row));
+            EXPECT_DOUBLE_EQ(
+                ratePassNotTooFar(pass, passing_config),
+                cost_map.getCost(PassCostComponent::PASS_NOT_TOO_FAR_QUALITY, col, row));
+            EXPECT_DOUBLE_EQ(
+                ratePassFriendlyCapability(world->friendlyTeam(), pass, passing_config),
+                cost_map.getCost(PassCostComponent::PASS_FRIENDLY_CAPABILITY, col, row));
+            EXPECT_DOUBLE_EQ(
+                ratePassEnemyRisk(world->enemyTeam(), pass, passing_config),
+                cost_map.getCost(PassCostComponent::PASS_ENEMY_RISK, col, row));
+            EXPECT_DOUBLE_EQ(
+                calculateInterceptRisk(world->enemyTeam(), pass, passing_config),
+                cost_map.getCost(PassCostComponent::ENEMY_INTERCEPTION_RISK, col, row));
+            EXPECT_DOUBLE_EQ(
+                calculateProximityRisk(receiver_point, world->enemyTeam(),
+                                       passing_config),
+                cost_map.getCost(PassCostComponent::ENEMY_PROXIMITY_RISK, col, row));
+            EXPECT_DOUBLE_EQ(
+                ratePassShootScore(world->field(), world->enemyTeam(), pass,
+                                   passing_config),
+                cost_map.getCost(PassCostComponent::PASS_SHOOT_SCORE, col, row));
+            EXPECT_DOUBLE_EQ(
+                rateReceivingPosition(*world, pass, passing_config),
+                cost_map.getCost(PassCostComponent::RECEIVER_POSITION_SCORE, col, row));
+            EXPECT_DOUBLE_EQ(
+                rateKeepAwayPosition(receiver_point, *world, best_pass,
+                                     world->field().fieldBoundary(), passing_config),
+                cost_map.getCost(PassCostComponent::KEEP_AWAY_POSITION_SCORE, col, row));
+            EXPECT_DOUBLE_EQ(ratePass(*world, pass, passing_config),
+                             cost_map.getCost(PassCostComponent::PASS_RATING, col, row));
+        }
+    }
+}
+
+TEST_F(PassCostMapTest, components_not_requested_are_one)
+{
+    PassCostMap cost_map(*world, passing_config, NUM_COLS, NUM_ROWS,
+                         {PassCostComponent::PASS_RATING});
+
+    EXPECT_TRUE(cost_map.hasComponent(PassCostComponent::PASS_RATING));
+    EXPECT_FALSE(cost_map.hasComponent(PassCostComponent::PASS_SHOOT_SCORE));
+
+    // PASS_SHOOT_SCORE is computed as part of PASS_RATING but was not requested
+    for (double cost : cost_map.getCosts(PassCostComponent::PASS_SHOOT_SCORE))
+    {
+        EXPECT_DOUBLE_EQ(1.0, cost);
+    }
+}
+
+TEST_F(PassCostMapTest, keep_away_position_without_best_pass_is_one)
+{
+    PassCostMap cost_map(*world, passing_config, NUM_COLS, NUM_ROWS,
+                         {PassCostComponent::KEEP_AWAY_POSITION_SCORE});
+
+    for (double cost : cost_map.getCosts(PassCostComponent::KEEP_AWAY_POSITION_SCORE))
+    {
+        EXPECT_DOUBLE_EQ(1.0, cost);
+    }
+}
+
+TEST_F(PassCostMapTest, single_and_multi_threaded_results_are_identical)
+{
+    PassCostMap single_threaded_cost_map(*world, passing_config, NUM_COLS, NUM_ROWS,
+                                         PassCostMap::allComponents(), std::nullopt, 1);
+    PassCostMap multi_threaded_cost_map(*world, passing_config, NUM_COLS, NUM_ROWS,
+                                        PassCostMap::allComponents(), std::nullopt, 5);
+
+    for (PassCostComponent component : PassCostMap::allComponents())
+    {
+        EXPECT_EQ(single_threaded_cost_map.getCosts(component),
+                  multi_threaded_cost_map.getCosts(component));
+    }
+}
+
+TEST_F(PassCostMapTest, combined_costs_are_products_of_components)
+{
+    std::vector<PassCostComponent> components = {
+        PassCostComponent::STATIC_POSITION_QUALITY,
+        PassCostComponent::ENEMY_PROXIMITY_RISK};
+    PassCostMap cost_map(*world, passing_config, NUM_COLS, NUM_ROWS, components);
+
+    std::vector<double> combined_costs = cost_map.getCombinedCosts(components);
+
+    ASSERT_EQ(NUM_COLS * NUM_ROWS, combined_costs.size());
+    for (size_t i = 0; i < combined_costs.size(); i++)
+    {
+        EXPECT_DOUBLE_EQ(
+            cost_map.getCosts(PassCostComponent::STATIC_POSITION_QUALITY)[i] *
+                cost_map.getCosts(PassCostComponent::ENEMY_PROXIMITY_RISK)[i],
+            combined_costs[i]);
+    }
+}
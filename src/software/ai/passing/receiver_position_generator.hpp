@@ -1,7 +1,5 @@
 #pragma once
 
-#include <random>
-
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/parameters.pb.h"
 #include "software/ai/passing/cost_function.h"
@@ -9,11 +7,20 @@
 #include "software/ai/passing/pass.h"
 #include "software/ai/passing/pass_with_rating.h"
 #include "software/logger/logger.h"
+#include "software/math/math_functions.h"
+#include "software/multithreading/worker_pool.h"
 #include "software/world/world.h"
 
 /**
  * This class is responsible for generating the best positions for our pass
  * receivers to go to
+ *
+ * Receiving positions are sampled in each zone with a Halton sequence, which covers the
+ * zone more evenly than random samples do. Once a zone has a best receiving position,
+ * part of its samples refine the position in an area around it that shrinks each round,
+ * similar to the cross-entropy method with a single elite sample. Zones are sampled in
+ * parallel since they are independent of each other, on a pool of threads that is
+ * started when the generator is created and shared by its copies.
  */
 template <class ZoneEnum>
 class ReceiverPositionGenerator
@@ -57,7 +64,7 @@ class ReceiverPositionGenerator
    private:
     /**
      * Sample more points and update the best_receiving_positions map if better
-     * receiving positions in each zone were found
+     * receiving positions in each zone were found. The zones are sampled in parallel
      *
      * @param best_receiving_positions The map of the best receiving positions for each
      * zone found so far, and their ratings.
@@ -71,6 +78,27 @@ class ReceiverPositionGenerator
         const Point &pass_origin, const std::vector<ZoneEnum> &zones_to_sample,
         unsigned int num_samples_per_zone);
 
+    /**
+     * Samples receiving positions in a zone, spreading some samples across the zone
+     * and taking the rest around the best receiving position found so far
+     *
+     * @param zone_id The zone to sample receiving positions in
+     * @param best_sampled_pass The best pass to a receiving position in the zone found
+     * so far, if any
+     * @param world The world to sample receiving positions in
+     * @param pass_origin The origin of the pass
+     * @param num_samples The number of samples to take
+     * @param next_sample_index The index of the next point of the Halton sequence to
+     * sample. This is incremented for every sample taken
+     *
+     * @return The best pass to a receiving position in the zone
+     */
+    PassWithRating sampleZone(const ZoneEnum zone_id,
+                              const std::optional<PassWithRating> &best_sampled_pass,
+                              const World &world, const Point &pass_origin,
+                              unsigned int num_samples,
+                              unsigned int &next_sample_index) const;
+
     /**
      * Helper function for getting the top num_positions zones from the current
      * best_receiving_positions. Note that this function will attempt to spread out the
@@ -109,11 +137,19 @@ class ReceiverPositionGenerator
     // A vector of shapes that will be visualized
     std::vector<TbotsProto::DebugShapes::DebugShape> debug_shapes;
 
-    // A random number generator for use across the class
-    std::mt19937 random_num_gen_;
+    // The index of the next point of the Halton sequence to sample in each zone, so
+    // each iteration continues the sequence instead of repeating it. Every zone has an
+    // entry, so zones can be sampled in parallel without modifying the map
+    std::map<ZoneEnum, unsigned int> next_sample_indices_;
+
+    // The threads that zones are sampled on
+    std::shared_ptr<WorkerPool> zone_sampling_pool_;
 
-    // The random seed to initialize the random number generator
-    static constexpr int RNG_SEED = 1010;
+    // The number of samples taken around the best receiving position in a zone before
+    // the area sampled is shrunk around the new best receiving position
+    static constexpr unsigned int NUM_REFINEMENT_SAMPLES_PER_ROUND = 4;
+    // How much the area sampled around the best receiving position shrinks each round
+    static constexpr double REFINEMENT_AREA_SHRINK_FACTOR = 0.5;
 };
 
 template <class ZoneEnum>
@@ -122,8 +158,16 @@ ReceiverPositionGenerator<ZoneEnum>::ReceiverPositionGenerator(
     TbotsProto::PassingConfig passing_config)
     : pitch_division_(pitch_division),
       passing_config_(passing_config),
-      random_num_gen_(RNG_SEED)
+      zone_sampling_pool_(std::make_shared<WorkerPool>(
+          passing_config_.receiver_position_generator_config()
+              .num_zone_sampling_threads()))
 {
+    // Start at 1 since the first point of the Halton sequence is always the corner of
+    // the zone
+    for (const auto &zone_id : pitch_division_->getAllZoneIds())
+    {
+        next_sample_indices_.emplace(zone_id, 1);
+    }
 }
 
 template <class ZoneEnum>
@@ -234,38 +278,108 @@ void ReceiverPositionGenerator<ZoneEnum>::updateBestReceiverPositions(
     const Point &pass_origin, const std::vector<ZoneEnum> &zones_to_sample,
     unsigned int num_samples_per_zone)
 {
-    for (const auto &zone_id : zones_to_sample)
+    std::vector<PassWithRating> best_passes_for_receiving(
+        zones_to_sample.size(),
+        PassWithRating{Pass(Point(0, 0), Point(0, 0), 1.0), -1.0});
+
+    // Each thread samples every num_threads-th zone, starting from the zone at its
+    // thread index. The threads only read best_receiving_positions, and each writes to
+    // the entries of best_passes_for_receiving and next_sample_indices_ of its own zones
+    const std::size_t num_threads = zone_sampling_pool_->numThreads();
+    zone_sampling_pool_->run(
+        [&](std::size_t first_zone_index)
+        {
+            for (std::size_t i = first_zone_index; i < zones_to_sample.size();
+                 i += num_threads)
+            {
+                // Check if we have already sampled some passes for this zone
+                std::optional<PassWithRating> best_sampled_pass;
+                const auto &best_sampled_pass_iter =
+                    best_receiving_positions.find(zones_to_sample[i]);
+                if (best_sampled_pass_iter != best_receiving_positions.end())
+                {
+                    best_sampled_pass = best_sampled_pass_iter->second;
+                }
+
+                best_passes_for_receiving[i] =
+                    sampleZone(zones_to_sample[i], best_sampled_pass, world, pass_origin,
+                               num_samples_per_zone,
+                               next_sample_indices_.find(zones_to_sample[i])->second);
+            }
+        });
+
+    for (std::size_t i = 0; i < zones_to_sample.size(); i++)
     {
-        auto zone = pitch_division_->getZone(zone_id);
-        std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
-        std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
+        best_receiving_positions.insert_or_assign(zones_to_sample[i],
+                                                  best_passes_for_receiving[i]);
+    }
+}
 
-        PassWithRating best_pass_for_receiving{Pass(Point(0, 0), Point(0, 0), 1.0), -1.0};
+template <class ZoneEnum>
+PassWithRating ReceiverPositionGenerator<ZoneEnum>::sampleZone(
+    const ZoneEnum zone_id, const std::optional<PassWithRating> &best_sampled_pass,
+    const World &world, const Point &pass_origin, unsigned int num_samples,
+    unsigned int &next_sample_index) const
+{
+    const auto &receiver_config = passing_config_.receiver_position_generator_config();
+    const Rectangle zone        = pitch_division_->getZone(zone_id);
 
-        // Check if we have already sampled some passes for this zone
-        const auto &best_sampled_pass_iter = best_receiving_positions.find(zone_id);
-        if (best_sampled_pass_iter != best_receiving_positions.end())
+    PassWithRating best_pass_for_receiving = best_sampled_pass.value_or(
+        PassWithRating{Pass(Point(0, 0), Point(0, 0), 1.0), -1.0});
+    auto rate_receiving_position = [&](const Point &receiving_position)
+    {
+        auto pass =
+            Pass::fromDestReceiveSpeed(pass_origin, receiving_position, passing_config_);
+        double rating = rateReceivingPosition(world, pass, passing_config_);
+
+        if (rating > best_pass_for_receiving.rating)
         {
-            best_pass_for_receiving = best_sampled_pass_iter->second;
+            best_pass_for_receiving = PassWithRating{pass, rating};
         }
+    };
 
-        // Randomly sample receiving positions in the zone
-        for (unsigned int i = 0; i < num_samples_per_zone; ++i)
-        {
-            auto pass = Pass::fromDestReceiveSpeed(
-                pass_origin,
-                Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
-                passing_config_);
-            double rating = rateReceivingPosition(world, pass, passing_config_);
+    // Only refine a receiving position if there is one to refine
+    unsigned int num_refinement_samples = 0;
+    if (best_sampled_pass.has_value())
+    {
+        num_refinement_samples = static_cast<unsigned int>(
+            std::round(num_samples * receiver_config.refinement_sample_fraction()));
+    }
 
-            if (rating > best_pass_for_receiving.rating)
-            {
-                best_pass_for_receiving = PassWithRating{pass, rating};
-            }
+    // Spread the samples evenly across the zone
+    for (unsigned int i = 0; i < num_samples - num_refinement_samples; ++i)
+    {
+        rate_receiving_position(haltonPoint(zone, next_sample_index++));
+    }
+
+    // Sample in rounds around the best receiving position, shrinking the area sampled
+    // after each round
+    Vector refinement_area_half_size = Vector(zone.xLength(), zone.yLength()) *
+                                       (receiver_config.refinement_area_fraction() / 2);
+    for (unsigned int i = 0; i < num_refinement_samples;
+         i += NUM_REFINEMENT_SAMPLES_PER_ROUND)
+    {
+        const Point best_receiving_position =
+            best_pass_for_receiving.pass.receiverPoint();
+        const Point area_min = best_receiving_position - refinement_area_half_size;
+        const Point area_max = best_receiving_position + refinement_area_half_size;
+        const Rectangle refinement_area(Point(std::max(area_min.x(), zone.xMin()),
+                                              std::max(area_min.y(), zone.yMin())),
+                                        Point(std::min(area_max.x(), zone.xMax()),
+                                              std::min(area_max.y(), zone.yMax())));
+
+        for (unsigned int j = i;
+             j < std::min(i + NUM_REFINEMENT_SAMPLES_PER_ROUND, num_refinement_samples);
+             ++j)
+        {
+            rate_receiving_position(haltonPoint(refinement_area, next_sample_index++));
         }
 
-        best_receiving_positions.insert_or_assign(zone_id, best_pass_for_receiving);
+        refinement_area_half_size =
+            refinement_area_half_size * REFINEMENT_AREA_SHRINK_FACTOR;
     }
+
+    return best_pass_for_receiving;
 }
 
 template <class ZoneEnum>
@@ -152,3 +152,27 @@ TEST_F(ReceiverPositionGeneratorTest, test_receiving_position_rating_not_degradi
         prev_score = score;
     }
 }
+
+TEST_F(ReceiverPositionGeneratorTest, test_same_positions_with_any_number_of_threads)
+{
+    ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
+    ::TestUtil::setEnemyRobotPositions(
+        world, {{1, -2}, {1, 0}, {1, 2}, {3, 0.1}, {3, -0.1}, {4.4, 0}},
+        Timestamp::fromSeconds(0));
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(2, -2), Point(2, 0), Point(2, 2)},
+                                          Timestamp::fromSeconds(0));
+
+    auto pitch_division =
+        std::make_shared<const EighteenZonePitchDivision>(world->field());
+    TbotsProto::PassingConfig single_threaded_config;
+    single_threaded_config.mutable_receiver_position_generator_config()
+        ->set_num_zone_sampling_threads(1);
+    ReceiverPositionGenerator<EighteenZoneId> single_threaded_generator(
+        pitch_division, single_threaded_config);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(single_threaded_generator.getBestReceivingPositions(*world, 2),
+                  receiver_position_generator.getBestReceivingPositions(*world, 2));
+    }
+}
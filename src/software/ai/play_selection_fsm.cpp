@@ -1,22 +1,14 @@
 #include "software/ai/play_selection_fsm.h"
 
-#include "software/ai/hl/stp/play/ball_placement/ball_placement_play.h"
-#include "software/ai/hl/stp/play/enemy_ball_placement/enemy_ball_placement_play.h"
-#include "software/ai/hl/stp/play/enemy_free_kick/enemy_free_kick_play.h"
-#include "software/ai/hl/stp/play/free_kick/free_kick_play.h"
-#include "software/ai/hl/stp/play/halt_play/halt_play.h"
-#include "software/ai/hl/stp/play/kickoff_enemy_play.h"
-#include "software/ai/hl/stp/play/kickoff_friendly_play.h"
-#include "software/ai/hl/stp/play/offense/offense_play.h"
-#include "software/ai/hl/stp/play/penalty_kick/penalty_kick_play.h"
-#include "software/ai/hl/stp/play/penalty_kick_enemy/penalty_kick_enemy_play.h"
-#include "software/ai/hl/stp/play/stop_play.h"
-
-
 PlaySelectionFSM::PlaySelectionFSM(
-    std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr)
-    : ai_config_ptr(ai_config_ptr), current_set_play(std::nullopt)
+    std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr,
+    std::shared_ptr<PlayPool> play_pool)
+    : ai_config_ptr(ai_config_ptr), play_pool(play_pool), current_set_play(std::nullopt)
 {
+    if (!this->play_pool)
+    {
+        this->play_pool = std::make_shared<PlayPool>(ai_config_ptr, SELECTABLE_PLAYS);
+    }
 }
 
 bool PlaySelectionFSM::gameStateStopped(const Update& event)
@@ -46,7 +38,8 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::BallPlacementPlay)
         {
             current_set_play = TbotsProto::PlayName::BallPlacementPlay;
-            event.set_current_play(std::make_unique<BallPlacementPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::BallPlacementPlay));
         }
     }
     else if (event.game_state.isTheirBallPlacement())
@@ -55,7 +48,7 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         {
             current_set_play = TbotsProto::PlayName::EnemyBallPlacementPlay;
             event.set_current_play(
-                std::make_unique<EnemyBallPlacementPlay>(ai_config_ptr));
+                play_pool->acquire(TbotsProto::PlayName::EnemyBallPlacementPlay));
         }
     }
     else if (event.game_state.isOurKickoff())
@@ -63,7 +56,8 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::KickoffFriendlyPlay)
         {
             current_set_play = TbotsProto::PlayName::KickoffFriendlyPlay;
-            event.set_current_play(std::make_unique<KickoffFriendlyPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::KickoffFriendlyPlay));
         }
     }
     else if (event.game_state.isTheirKickoff())
@@ -71,7 +65,8 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::KickoffEnemyPlay)
         {
             current_set_play = TbotsProto::PlayName::KickoffEnemyPlay;
-            event.set_current_play(std::make_unique<KickoffEnemyPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::KickoffEnemyPlay));
         }
     }
     else if (event.game_state.isOurPenalty())
@@ -79,7 +74,8 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::PenaltyKickPlay)
         {
             current_set_play = TbotsProto::PlayName::PenaltyKickPlay;
-            event.set_current_play(std::make_unique<PenaltyKickPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::PenaltyKickPlay));
         }
     }
     else if (event.game_state.isTheirPenalty())
@@ -87,7 +83,8 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::PenaltyKickEnemyPlay)
         {
             current_set_play = TbotsProto::PlayName::PenaltyKickEnemyPlay;
-            event.set_current_play(std::make_unique<PenaltyKickEnemyPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::PenaltyKickEnemyPlay));
         }
     }
     else if (event.game_state.isOurDirectFree() || event.game_state.isOurIndirectFree())
@@ -95,7 +92,8 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::FreeKickPlay)
         {
             current_set_play = TbotsProto::PlayName::FreeKickPlay;
-            event.set_current_play(std::make_unique<FreeKickPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::FreeKickPlay));
         }
     }
     else if (event.game_state.isTheirDirectFree() ||
@@ -104,24 +102,25 @@ void PlaySelectionFSM::setupSetPlay(const Update& event)
         if (current_set_play != TbotsProto::PlayName::EnemyFreeKickPlay)
         {
             current_set_play = TbotsProto::PlayName::EnemyFreeKickPlay;
-            event.set_current_play(std::make_unique<EnemyFreeKickPlay>(ai_config_ptr));
+            event.set_current_play(
+                play_pool->acquire(TbotsProto::PlayName::EnemyFreeKickPlay));
         }
     }
 }
 
 void PlaySelectionFSM::setupStopPlay(const Update& event)
 {
-    event.set_current_play(std::make_unique<StopPlay>(ai_config_ptr));
+    event.set_current_play(play_pool->acquire(TbotsProto::PlayName::StopPlay));
 }
 
 void PlaySelectionFSM::setupHaltPlay(const Update& event)
 {
-    event.set_current_play(std::make_unique<HaltPlay>(ai_config_ptr));
+    event.set_current_play(play_pool->acquire(TbotsProto::PlayName::HaltPlay));
 }
 
 void PlaySelectionFSM::setupOffensePlay(const Update& event)
 {
-    event.set_current_play(std::make_unique<OffensePlay>(ai_config_ptr));
+    event.set_current_play(play_pool->acquire(TbotsProto::PlayName::OffensePlay));
 }
 
 void PlaySelectionFSM::resetSetPlay(const Update& event)
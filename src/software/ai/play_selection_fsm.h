@@ -3,6 +3,7 @@
 #include "proto/parameters.pb.h"
 #include "shared/constants.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/play/play_pool.h"
 
 struct PlaySelectionFSM
 {
@@ -26,12 +27,30 @@ struct PlaySelectionFSM
         TbotsProto::AiConfig ai_config;
     };
 
+    // The plays the FSM selects from, which are kept ready in its play pool
+    inline static const std::vector<TbotsProto::PlayName> SELECTABLE_PLAYS = {
+        TbotsProto::PlayName::HaltPlay,
+        TbotsProto::PlayName::StopPlay,
+        TbotsProto::PlayName::OffensePlay,
+        TbotsProto::PlayName::BallPlacementPlay,
+        TbotsProto::PlayName::EnemyBallPlacementPlay,
+        TbotsProto::PlayName::KickoffFriendlyPlay,
+        TbotsProto::PlayName::KickoffEnemyPlay,
+        TbotsProto::PlayName::PenaltyKickPlay,
+        TbotsProto::PlayName::PenaltyKickEnemyPlay,
+        TbotsProto::PlayName::FreeKickPlay,
+        TbotsProto::PlayName::EnemyFreeKickPlay,
+    };
+
     /**
      * Creates a play selection FSM
      *
      * @param ai_config_ptr pointer to the default play config for this play fsm
+     * @param play_pool The pool to take the selected plays from. If null, the FSM
+     * creates a pool of the SELECTABLE_PLAYS
      */
-    explicit PlaySelectionFSM(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr);
+    explicit PlaySelectionFSM(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr,
+                              std::shared_ptr<PlayPool> play_pool = nullptr);
 
     /**
      * Guards for whether the game state is stopped, halted, playing, or in set up
@@ -121,5 +140,6 @@ struct PlaySelectionFSM
 
    private:
     std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr;
+    std::shared_ptr<PlayPool> play_pool;
     std::optional<TbotsProto::PlayName> current_set_play;
 };
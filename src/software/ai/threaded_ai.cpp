@@ -5,6 +5,9 @@
 #include "software/ai/hl/stp/play/assigned_tactics_play.h"
 #include "software/ai/hl/stp/play/play_factory.h"
 #include "software/ai/hl/stp/tactic/tactic_factory.h"
+#include "software/metrics/latency_trace.h"
+#include "software/metrics/metrics_registry.h"
+#include "software/metrics/scoped_metrics_timer.h"
 #include "software/multithreading/thread_safe_buffer.hpp"
 
 ThreadedAi::ThreadedAi(const TbotsProto::AiConfig& ai_config)
@@ -64,17 +67,51 @@ void ThreadedAi::onValueReceived(TbotsProto::ThunderbotsConfig config)
 
 void ThreadedAi::runAiAndSendPrimitives(const WorldPtr& world_ptr)
 {
+    static MetricsHistogram& tick_duration =
+        MetricsRegistry::global().getHistogram("ai.tick_duration_ns");
+
     std::scoped_lock lock(ai_mutex);
     if (ai_control_config.run_ai())
     {
-        auto new_primitives = ai.getPrimitives(world_ptr);
-
-        TbotsProto::PlayInfo play_info_msg = ai.getPlayInfo();
-
-        LOG(VISUALIZE) << play_info_msg;
-
-        Subject<TbotsProto::PlayInfo>::sendValueToObservers(play_info_msg);
-
-        Subject<TbotsProto::PrimitiveSet>::sendValueToObservers(*new_primitives);
+        {
+            ScopedMetricsTimer tick_timer(tick_duration);
+
+            std::optional<TbotsProto::LatencyTrace> latency_trace =
+                world_ptr->getLatencyTrace();
+            if (latency_trace)
+            {
+                latency_trace->set_ai_tick_start_s(getLatencyTraceTimeSeconds());
+            }
+
+            auto new_primitives = ai.getPrimitives(world_ptr);
+
+            if (latency_trace)
+            {
+                latency_trace->set_ai_tick_done_s(getLatencyTraceTimeSeconds());
+            }
+
+            TbotsProto::PlayInfo play_info_msg = ai.getPlayInfo();
+
+            LOG(VISUALIZE) << play_info_msg;
+
+            Subject<TbotsProto::PlayInfo>::sendValueToObservers(play_info_msg);
+
+            // Every primitive carries the trace so the robots can echo it back
+            if (latency_trace)
+            {
+                latency_trace->set_primitive_set_sent_s(getLatencyTraceTimeSeconds());
+                *new_primitives->mutable_latency_trace() = *latency_trace;
+                for (auto& [robot_id, primitive] :
+                     *new_primitives->mutable_robot_primitives())
+                {
+                    *primitive.mutable_latency_trace() = *latency_trace;
+                }
+            }
+
+            Subject<TbotsProto::PrimitiveSet>::sendValueToObservers(*new_primitives);
+        }
+
+        // Rebuild the plays used this tick now that the primitives are sent
+        ai.refillPlayPool();
     }
 }
@@ -9,6 +9,7 @@
 #include "shared/constants.h"
 #include "software/constants.h"
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
 #include "software/multithreading/subject.hpp"
 #include "software/util/generic_factory/generic_factory.h"
 
@@ -75,6 +76,9 @@ UnixSimulatorBackend::UnixSimulatorBackend(
     dynamic_parameter_update_respone_sender.reset(
         new ThreadedProtoUnixSender<TbotsProto::ThunderbotsConfig>(
             runtime_dir + DYNAMIC_PARAMETER_UPDATE_RESPONSE_PATH, proto_logger));
+
+    metrics_output.reset(new ThreadedProtoUnixSender<TbotsProto::MetricsSnapshot>(
+        runtime_dir + METRICS_PATH, proto_logger));
 }
 
 void UnixSimulatorBackend::receiveThunderbotsConfig(TbotsProto::ThunderbotsConfig request)
@@ -88,7 +92,11 @@ void UnixSimulatorBackend::receiveThunderbotsConfig(TbotsProto::ThunderbotsConfi
 
 void UnixSimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    static MetricsCounter& primitive_sets_sent =
+        MetricsRegistry::global().getCounter("backend.primitive_sets_sent");
+
     primitive_output->sendProto(primitives);
+    primitive_sets_sent.increment();
 
     LOG(VISUALIZE) << *createNamedValue(
         "Primitive Hz",
@@ -98,7 +106,11 @@ void UnixSimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 
 void UnixSimulatorBackend::onValueReceived(World world)
 {
+    static MetricsCounter& worlds_sent =
+        MetricsRegistry::global().getCounter("backend.worlds_sent");
+
     world_output->sendProto(*createWorldWithSequenceNumber(world, sequence_number++));
+    worlds_sent.increment();
 
     LOG(VISUALIZE) << *createNamedValue(
         "World Hz",
@@ -106,6 +118,57 @@ void UnixSimulatorBackend::onValueReceived(World world)
             FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond()));
 
     last_world_time_sec.store(world.getMostRecentTimestamp().toSeconds());
+
+    publishMetricsIfDue();
+}
+
+void UnixSimulatorBackend::publishMetricsIfDue()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<double>(now - last_metrics_publish_time).count() <
+        METRICS_PUBLISH_PERIOD_S)
+    {
+        return;
+    }
+    last_metrics_publish_time = now;
+
+    if (proto_logger)
+    {
+        updateProtoLoggerMetrics();
+    }
+    metrics_output->sendProto(*MetricsRegistry::global().createMetricsSnapshot());
+}
+
+void UnixSimulatorBackend::updateProtoLoggerMetrics()
+{
+    static MetricsGauge& queue_depth =
+        MetricsRegistry::global().getGauge("proto_logger.queue_depth");
+    static MetricsGauge& pending_chunks =
+        MetricsRegistry::global().getGauge("proto_logger.pending_chunks");
+    static MetricsCounter& entries_logged =
+        MetricsRegistry::global().getCounter("proto_logger.entries_logged");
+    static MetricsCounter& chunks_written =
+        MetricsRegistry::global().getCounter("proto_logger.chunks_written");
+    static std::array<MetricsCounter*, NUM_PROTO_LOG_PRIORITIES> entries_dropped = {
+        &MetricsRegistry::global().getCounter("proto_logger.entries_dropped.low"),
+        &MetricsRegistry::global().getCounter("proto_logger.entries_dropped.normal"),
+        &MetricsRegistry::global().getCounter("proto_logger.entries_dropped.high"),
+    };
+
+    ProtoLogger::Stats stats = proto_logger->getStats();
+    queue_depth.set(static_cast<double>(stats.queue_depth));
+    pending_chunks.set(static_cast<double>(stats.pending_chunks));
+    entries_logged.increment(stats.entries_logged -
+                             last_proto_logger_stats.entries_logged);
+    chunks_written.increment(stats.chunks_written -
+                             last_proto_logger_stats.chunks_written);
+    for (std::size_t i = 0; i < NUM_PROTO_LOG_PRIORITIES; i++)
+    {
+        entries_dropped[i]->increment(stats.entries_dropped[i] -
+                                      last_proto_logger_stats.entries_dropped[i]);
+    }
+
+    last_proto_logger_stats = stats;
 }
 
 double UnixSimulatorBackend::getLastWorldTimeSec()
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <mutex>
 
+#include "proto/metrics.pb.h"
 #include "proto/parameters.pb.h"
 #include "proto/replay_bookmark.pb.h"
 #include "proto/robot_crash_msg.pb.h"
@@ -32,11 +34,25 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
      */
     double getLastWorldTimeSec();
 
+    // How often a snapshot of the process metrics is published
+    static constexpr double METRICS_PUBLISH_PERIOD_S = 1.0;
+
    private:
     void receiveThunderbotsConfig(TbotsProto::ThunderbotsConfig request);
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
     void onValueReceived(World world) override;
 
+    /**
+     * Publishes a snapshot of the process metrics if at least METRICS_PUBLISH_PERIOD_S
+     * passed since the last snapshot was published
+     */
+    void publishMetricsIfDue();
+
+    /**
+     * Updates the process metrics with the statistics of the ProtoLogger
+     */
+    void updateProtoLoggerMetrics();
+
     // ThreadedProtoUnix** to communicate with Thunderscope
     // Inputs
     std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::VirtualObstacles>>
@@ -62,6 +78,7 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
     std::unique_ptr<ThreadedProtoUnixSender<TbotsProto::PrimitiveSet>> primitive_output;
     std::unique_ptr<ThreadedProtoUnixSender<TbotsProto::ThunderbotsConfig>>
         dynamic_parameter_update_respone_sender;
+    std::unique_ptr<ThreadedProtoUnixSender<TbotsProto::MetricsSnapshot>> metrics_output;
 
     std::shared_ptr<ProtoLogger> proto_logger;
 
@@ -70,4 +87,11 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
 
     // The timestamp of the last world received
     std::atomic<double> last_world_time_sec = 0;
+
+    // The time the last metrics snapshot was published
+    std::chrono::steady_clock::time_point last_metrics_publish_time;
+
+    // The ProtoLogger statistics when the metrics were last updated, since the
+    // statistics are totals but the counters are incremented
+    ProtoLogger::Stats last_proto_logger_stats = {};
 };
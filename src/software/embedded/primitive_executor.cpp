@@ -8,6 +8,7 @@
 #include "proto/visualization.pb.h"
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
+#include "software/metrics/latency_trace.h"
 #include "software/physics/velocity_conversion_util.h"
 
 PrimitiveExecutor::PrimitiveExecutor(const Duration time_step,
@@ -26,6 +27,11 @@ void PrimitiveExecutor::updatePrimitive(const TbotsProto::Primitive &primitive_m
 {
     current_primitive_ = primitive_msg;
 
+    if (current_primitive_.has_latency_trace())
+    {
+        latency_trace_ = current_primitive_.latency_trace();
+    }
+
     if (current_primitive_.has_move())
     {
         trajectory_path_ = createTrajectoryPathFromParams(
@@ -94,6 +100,11 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
     time_since_trajectory_creation_ += time_step_;
     status.set_running_primitive(true);
 
+    if (latency_trace_ && latency_trace_->robot_primitive_stepped_s() == 0.0)
+    {
+        latency_trace_->set_robot_primitive_stepped_s(getLatencyTraceTimeSeconds());
+    }
+
     switch (current_primitive_.primitive_case())
     {
         case TbotsProto::Primitive::kStop:
@@ -151,3 +162,8 @@ void PrimitiveExecutor::setRobotId(const RobotId robot_id)
 {
     robot_id_ = robot_id;
 }
+
+const std::optional<TbotsProto::LatencyTrace> &PrimitiveExecutor::getLatencyTrace() const
+{
+    return latency_trace_;
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "proto/latency_trace.pb.h"
 #include "proto/primitive.pb.h"
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
@@ -62,6 +63,14 @@ class PrimitiveExecutor
     std::unique_ptr<TbotsProto::DirectControlPrimitive> stepPrimitive(
         TbotsProto::PrimitiveExecutorStatus &status);
 
+    /**
+     * Gets the latency trace of the last primitive that was received with one, stamped
+     * with when it was first stepped
+     *
+     * @return the latency trace, or std::nullopt if no primitive had a latency trace
+     */
+    const std::optional<TbotsProto::LatencyTrace> &getLatencyTrace() const;
+
    private:
     /*
      * Compute the next target linear _local_ velocity the robot should be at.
@@ -85,6 +94,7 @@ class PrimitiveExecutor
     RobotConstants_t robot_constants_;
     std::optional<TrajectoryPath> trajectory_path_;
     std::optional<BangBangTrajectory1DAngular> angular_trajectory_;
+    std::optional<TbotsProto::LatencyTrace> latency_trace_;
 
     // TODO (#2855): Add dynamic time_step to `stepPrimitive` and remove this constant
     // time step to be used, in Seconds
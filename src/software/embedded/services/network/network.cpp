@@ -1,6 +1,7 @@
 #include "software/embedded/services/network/network.h"
 
 #include "software/logger/network_logger.h"
+#include "software/metrics/latency_trace.h"
 #include "software/networking/tbots_network_exception.h"
 
 NetworkService::NetworkService(const RobotId& robot_id, const std::string& ip_address,
@@ -100,6 +101,11 @@ TbotsProto::Primitive NetworkService::poll(TbotsProto::RobotStatus& robot_status
     {
         last_breakbeam_state_sent = robot_status.power_status().breakbeam_tripped();
         updatePrimitiveLog(robot_status);
+        if (robot_status.has_latency_trace())
+        {
+            robot_status.mutable_latency_trace()->set_robot_status_sent_s(
+                getLatencyTraceTimeSeconds());
+        }
         sendRobotStatus(robot_status);
         network_ticks = (network_ticks + 1) % ROBOT_STATUS_BROADCAST_RATE_HZ;
     }
@@ -156,6 +162,11 @@ void NetworkService::primitiveCallback(const TbotsProto::Primitive& input)
     if (primitive_tracker.isLastValid())
     {
         primitive_msg = input;
+        if (primitive_msg.has_latency_trace())
+        {
+            primitive_msg.mutable_latency_trace()->set_robot_primitive_received_s(
+                getLatencyTraceTimeSeconds());
+        }
     }
 }
 
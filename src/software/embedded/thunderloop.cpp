@@ -1,6 +1,12 @@
 #include "software/embedded/thunderloop.h"
 
+#include <pthread.h>
+#include <sched.h>
+
 #include <Tracy.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
 
 #include "proto/message_translation/tbots_protobuf.h"
@@ -13,6 +19,8 @@
 #include "software/embedded/services/motor.h"
 #include "software/logger/logger.h"
 #include "software/logger/network_logger.h"
+#include "software/metrics/metrics_registry.h"
+#include "software/metrics/scoped_metrics_timer.h"
 #include "software/networking/tbots_network_exception.h"
 #include "software/tracy/tracy_constants.h"
 #include "software/util/scoped_timespec_timer/scoped_timespec_timer.h"
@@ -69,7 +77,8 @@ extern "C"
 }
 
 Thunderloop::Thunderloop(const RobotConstants_t& robot_constants, bool enable_log_merging,
-                         const int loop_hz)
+                         const int loop_hz,
+                         const ThunderloopRealtimeConfig& realtime_config)
     // TODO (#2495): Set the friendly team colour
     : redis_client_(
           std::make_unique<RedisClient>(REDIS_DEFAULT_HOST, REDIS_DEFAULT_PORT)),
@@ -79,6 +88,9 @@ Thunderloop::Thunderloop(const RobotConstants_t& robot_constants, bool enable_lo
       channel_id_(std::stoi(redis_client_->getSync(ROBOT_MULTICAST_CHANNEL_REDIS_KEY))),
       network_interface_(redis_client_->getSync(ROBOT_NETWORK_INTERFACE_REDIS_KEY)),
       loop_hz_(loop_hz),
+      realtime_config_(realtime_config),
+      num_iterations_(0),
+      num_missed_deadlines_(0),
       kick_coeff_(std::stod(redis_client_->getSync(ROBOT_KICK_EXP_COEFF_REDIS_KEY))),
       kick_constant_(std::stoi(redis_client_->getSync(ROBOT_KICK_CONSTANT_REDIS_KEY))),
       chip_pulse_width_(
@@ -152,6 +164,7 @@ void Thunderloop::runLoop()
     struct timespec last_chipper_fired;
     struct timespec last_kicker_fired;
     struct timespec prev_iter_start_time;
+    struct timespec wakeup_latency;
 
     // Input buffer
     TbotsProto::Primitive new_primitive;
@@ -183,6 +196,39 @@ void Thunderloop::runLoop()
     robot_status_.set_thunderloop_version(thunderloop_hash);
     robot_status_.set_thunderloop_date_flashed(thunderloop_date_flashed);
 
+    // Real-time mode must be configured from the thread running the loop
+    if (realtime_config_.enabled)
+    {
+        thunderloop_status_.set_realtime_enabled(configureRealtimeScheduling());
+        prefaultStack();
+    }
+
+    // Size the histogram fields once up front so that updating them in the loop
+    // never allocates
+    thunderloop_status_.mutable_wakeup_latency_histogram()->Resize(
+        NUM_WAKEUP_LATENCY_STATUS_BUCKETS, 0);
+    thunderloop_status_.mutable_wakeup_latency_bucket_upper_bounds_us()->Resize(
+        NUM_WAKEUP_LATENCY_STATUS_BUCKETS, 0);
+    for (std::size_t i = 0; i < NUM_WAKEUP_LATENCY_STATUS_BUCKETS; i++)
+    {
+        // The last bucket is unbounded and reports its lower bound instead
+        thunderloop_status_.set_wakeup_latency_bucket_upper_bounds_us(
+            static_cast<int>(i),
+            1ull << std::min(i, NUM_WAKEUP_LATENCY_STATUS_BUCKETS - 2));
+    }
+
+    // Look up the metrics once so that recording them in the loop never locks
+    MetricsHistogram& iteration_duration =
+        MetricsRegistry::global().getHistogram("thunderloop.iteration_duration_ns");
+    MetricsHistogram& network_poll_duration =
+        MetricsRegistry::global().getHistogram("thunderloop.network_poll_duration_ns");
+    MetricsHistogram& wakeup_latency_histogram =
+        MetricsRegistry::global().getHistogram("thunderloop.wakeup_latency_ns");
+
+    // Reset the deadline now that setup is done, so that setup time is not
+    // counted as a missed deadline
+    clock_gettime(CLOCK_MONOTONIC, &next_shot);
+
     for (;;)
     {
         struct timespec time_since_prev_iter;
@@ -199,7 +245,13 @@ void Thunderloop::runLoop()
 
             FrameMarkStart(TracyConstants::THUNDERLOOP_FRAME_MARKER);
 
+            clock_gettime(CLOCK_MONOTONIC, &current_time);
+            ScopedTimespecTimer::timespecDiff(&current_time, &next_shot,
+                                              &wakeup_latency);
+            updateWakeupLatencyStatus(wakeup_latency, wakeup_latency_histogram);
+
             ScopedTimespecTimer iteration_timer(&iteration_time);
+            ScopedMetricsTimer iteration_metrics_timer(iteration_duration);
 
             // Collect jetson status
             jetson_status_.set_cpu_temperature(getCpuTemperature());
@@ -208,6 +260,7 @@ void Thunderloop::runLoop()
             // robot status
             {
                 ScopedTimespecTimer timer(&poll_time);
+                ScopedMetricsTimer metrics_timer(network_poll_duration);
 
                 ZoneNamedN(_tracy_network_poll, "Thunderloop: Poll NetworkService", true);
 
@@ -349,6 +402,11 @@ void Thunderloop::runLoop()
             *(robot_status_.mutable_chipper_kicker_status()) = chipper_kicker_status_;
             *(robot_status_.mutable_primitive_executor_status()) =
                 primitive_executor_status_;
+            if (primitive_executor_.getLatencyTrace())
+            {
+                *(robot_status_.mutable_latency_trace()) =
+                    primitive_executor_.getLatencyTrace().value();
+            }
 
             // Update Redis
             {
@@ -373,10 +431,110 @@ void Thunderloop::runLoop()
         next_shot.tv_nsec += interval;
         timespecNorm(next_shot);
 
+        // If the iteration finished after the next shot was due, we missed our deadline
+        clock_gettime(CLOCK_MONOTONIC, &current_time);
+        num_iterations_++;
+        if (current_time.tv_sec > next_shot.tv_sec ||
+            (current_time.tv_sec == next_shot.tv_sec &&
+             current_time.tv_nsec > next_shot.tv_nsec))
+        {
+            num_missed_deadlines_++;
+        }
+        thunderloop_status_.set_num_iterations(num_iterations_);
+        thunderloop_status_.set_num_missed_deadlines(num_missed_deadlines_);
+
         FrameMarkEnd(TracyConstants::THUNDERLOOP_FRAME_MARKER);
     }
 }
 
+bool Thunderloop::configureRealtimeScheduling()
+{
+    if (realtime_config_.cpu_affinity >= 0)
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(realtime_config_.cpu_affinity, &cpu_set);
+
+        int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        if (error != 0)
+        {
+            LOG(WARNING) << "THUNDERLOOP: Failed to pin loop to CPU "
+                         << realtime_config_.cpu_affinity << ": " << strerror(error);
+        }
+        else
+        {
+            LOG(INFO) << "THUNDERLOOP: Pinned loop to CPU "
+                      << realtime_config_.cpu_affinity;
+        }
+    }
+
+    struct sched_param param;
+    param.sched_priority = realtime_config_.priority;
+
+    int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0)
+    {
+        LOG(WARNING) << "THUNDERLOOP: Failed to set SCHED_FIFO priority "
+                     << realtime_config_.priority << ": " << strerror(error)
+                     << ". Running with the default scheduler (missing CAP_SYS_NICE?)";
+        return false;
+    }
+
+    LOG(INFO) << "THUNDERLOOP: Running with SCHED_FIFO priority "
+              << realtime_config_.priority;
+    return true;
+}
+
+void Thunderloop::prefaultStack()
+{
+    // https://rt.wiki.kernel.org/index.php/Threaded_RT-application_with_memory_locking_and_stack_handling_example
+    volatile unsigned char dummy[PREFAULT_STACK_SIZE_BYTES];
+    memset(const_cast<unsigned char*>(dummy), 0, PREFAULT_STACK_SIZE_BYTES);
+}
+
+void Thunderloop::updateWakeupLatencyStatus(const struct timespec& wakeup_latency,
+                                            MetricsHistogram& wakeup_latency_histogram)
+{
+    auto latency_ns = getNanoseconds(wakeup_latency);
+    wakeup_latency_histogram.record(static_cast<int64_t>(latency_ns));
+
+    thunderloop_status_.set_wakeup_latency_ms(latency_ns / NANOSECONDS_PER_MILLISECOND);
+    thunderloop_status_.set_max_wakeup_latency_ms(
+        static_cast<double>(wakeup_latency_histogram.getMax()) /
+        NANOSECONDS_PER_MILLISECOND);
+    thunderloop_status_.set_mean_wakeup_latency_ms(wakeup_latency_histogram.getMean() /
+                                                   NANOSECONDS_PER_MILLISECOND);
+
+    // Merge the buckets of the histogram into the power of two microsecond buckets of
+    // the status. Each histogram bucket is counted in the status bucket holding its
+    // lower bound, so the counts are accurate to the width of a histogram bucket
+    std::array<uint64_t, NUM_WAKEUP_LATENCY_STATUS_BUCKETS> status_bucket_counts{};
+    for (std::size_t i = 0; i < MetricsHistogram::NUM_BUCKETS; i++)
+    {
+        uint64_t count = wakeup_latency_histogram.getBucketCount(i);
+        if (count == 0)
+        {
+            continue;
+        }
+
+        uint64_t lower_bound_us   = MetricsHistogram::getBucketLowerBound(i) / 1000;
+        std::size_t status_bucket = 0;
+        while (lower_bound_us > 0 &&
+               status_bucket < NUM_WAKEUP_LATENCY_STATUS_BUCKETS - 1)
+        {
+            lower_bound_us >>= 1;
+            status_bucket++;
+        }
+        status_bucket_counts[status_bucket] += count;
+    }
+
+    for (std::size_t i = 0; i < NUM_WAKEUP_LATENCY_STATUS_BUCKETS; i++)
+    {
+        thunderloop_status_.set_wakeup_latency_histogram(static_cast<int>(i),
+                                                         status_bucket_counts[i]);
+    }
+}
+
 double Thunderloop::getMilliseconds(timespec time)
 {
     return (static_cast<double>(time.tv_sec) * MILLISECONDS_PER_SECOND) +
@@ -15,6 +15,22 @@
 #include "software/embedded/services/network/network.h"
 #include "software/embedded/services/power.h"
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_histogram.h"
+
+/**
+ * Configuration for running Thunderloop with real-time scheduling
+ */
+struct ThunderloopRealtimeConfig
+{
+    // Whether to run the loop with SCHED_FIFO scheduling
+    bool enabled = false;
+
+    // SCHED_FIFO priority of the loop thread, between 1 (lowest) and 99 (highest)
+    int priority = 80;
+
+    // The CPU to pin the loop thread to, or a negative value to not pin it
+    int cpu_affinity = -1;
+};
 
 class Thunderloop
 {
@@ -48,9 +64,12 @@ class Thunderloop
      * @param robot_constants The robot constants
      * @param enable_log_merging Whether to merge repeated log message or not
      * @param loop_hz The rate to run the loop
+     * @param realtime_config The real-time scheduling configuration of the loop
      */
     Thunderloop(const RobotConstants_t &robot_constants, bool enable_log_merging,
-                const int loop_hz);
+                const int loop_hz,
+                const ThunderloopRealtimeConfig &realtime_config =
+                    ThunderloopRealtimeConfig());
 
     ~Thunderloop();
 
@@ -123,6 +142,32 @@ class Thunderloop
      */
     void waitForNetworkUp();
 
+    /**
+     * Switches the calling thread to SCHED_FIFO with the configured priority and
+     * pins it to the configured CPU. Failures are logged and the loop continues
+     * with the default scheduler.
+     *
+     * @return true if the thread is running with real-time scheduling
+     */
+    bool configureRealtimeScheduling();
+
+    /**
+     * Touches a block of stack memory so that the pages backing the loop's stack
+     * are faulted in (and locked by mlockall) before the loop starts
+     */
+    static void prefaultStack();
+
+    /**
+     * Records the wakeup latency of the current iteration in the given histogram and
+     * updates the jitter statistics in the thunderloop status from it. Does not
+     * allocate.
+     *
+     * @param wakeup_latency How late the loop woke up relative to its deadline
+     * @param wakeup_latency_histogram The histogram of wakeup latencies in nanoseconds
+     */
+    void updateWakeupLatencyStatus(const struct timespec &wakeup_latency,
+                                   MetricsHistogram &wakeup_latency_histogram);
+
 
     // Input Msg Buffers
     TbotsProto::World world_;
@@ -147,6 +192,11 @@ class Thunderloop
     int channel_id_;
     std::string network_interface_;
     int loop_hz_;
+    ThunderloopRealtimeConfig realtime_config_;
+
+    // Jitter telemetry
+    uint64_t num_iterations_;
+    uint64_t num_missed_deadlines_;
 
     // Calibrated power service constants
     double kick_coeff_;
@@ -157,6 +207,10 @@ class Thunderloop
     PrimitiveExecutor primitive_executor_;
 
     // 500 millisecond timeout on receiving primitives before we stop the robots
+    // The number of wakeup latency buckets in the thunderloop status. Bucket i holds
+    // latencies below 2^i microseconds, and the last bucket holds every latency above
+    // the bucket before it
+    static constexpr std::size_t NUM_WAKEUP_LATENCY_STATUS_BUCKETS = 20;
     const double PACKET_TIMEOUT_NS = 500.0 * NANOSECONDS_PER_MILLISECOND;
 
     // Timeout after a failed ping request
@@ -164,6 +218,9 @@ class Thunderloop
 
     const std::string PATH_TO_RINGBUFFER_LOG = "/var/log/dmesg";
 
+    // Size of the stack to fault in before entering the real-time loop
+    static constexpr std::size_t PREFAULT_STACK_SIZE_BYTES = 512 * 1024;
+
     std::ifstream log_file = std::ifstream(PATH_TO_RINGBUFFER_LOG);
 };
 
@@ -91,6 +91,9 @@ int main(int argc, char** argv)
     struct CommandLineArgs
     {
         bool enable_log_merging = true;
+        bool enable_realtime    = false;
+        int realtime_priority   = 80;
+        int cpu_affinity        = -1;
     };
 
     CommandLineArgs args;
@@ -99,6 +102,15 @@ int main(int argc, char** argv)
     desc.add_options()("enable_log_merging",
                        boost::program_options::value<bool>(&args.enable_log_merging),
                        "merging repeated log messages");
+    desc.add_options()("enable_realtime",
+                       boost::program_options::value<bool>(&args.enable_realtime),
+                       "run the loop with SCHED_FIFO real-time scheduling");
+    desc.add_options()("realtime_priority",
+                       boost::program_options::value<int>(&args.realtime_priority),
+                       "SCHED_FIFO priority (1-99) used when real-time is enabled");
+    desc.add_options()("cpu_affinity",
+                       boost::program_options::value<int>(&args.cpu_affinity),
+                       "CPU to pin the loop to when real-time is enabled, -1 to not pin");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -111,8 +123,13 @@ int main(int argc, char** argv)
     const int pre_allocation_size = 20 * 1024 * 1024;
     reserveProcessMemory(pre_allocation_size);
 
-    auto thunderloop =
-        Thunderloop(create2021RobotConstants(), args.enable_log_merging, THUNDERLOOP_HZ);
+    ThunderloopRealtimeConfig realtime_config;
+    realtime_config.enabled      = args.enable_realtime;
+    realtime_config.priority     = args.realtime_priority;
+    realtime_config.cpu_affinity = args.cpu_affinity;
+
+    auto thunderloop = Thunderloop(create2021RobotConstants(), args.enable_log_merging,
+                                   THUNDERLOOP_HZ, realtime_config);
     thunderloop.runLoop();
 
     return 0;
@@ -19,6 +19,13 @@ int main(int argc, char **argv)
         std::string runtime_dir = "/tmp/tbots";
         std::string division    = "div_b";
         bool enable_realism     = false;  // realism flag
+        // Vision packets are generated on every tick if the camera frame rate is 0
+        double camera_frame_rate_hz    = 0;
+        double geometry_packet_rate_hz = 0;
+        bool multithreaded_physics     = false;
+        bool latency_tracing           = false;
+        // The random number generators are seeded from the current time if 0
+        uint32_t seed = 0;
     };
 
     CommandLineArgs args;
@@ -35,6 +42,28 @@ int main(int argc, char **argv)
     desc.add_options()("enable_realism",
                        boost::program_options::bool_switch(&args.enable_realism),
                        "realism simulator");  // install terminal flag
+    desc.add_options()(
+        "camera_frame_rate_hz",
+        boost::program_options::value<double>(&args.camera_frame_rate_hz),
+        "The rate at which each camera captures frames, independent of the tick rate. "
+        "0 to send a frame from every camera on every tick");
+    desc.add_options()(
+        "geometry_packet_rate_hz",
+        boost::program_options::value<double>(&args.geometry_packet_rate_hz),
+        "The rate at which the field geometry is sent when the camera frame rate is "
+        "set. 0 to send the geometry with every frame");
+    desc.add_options()("multithreaded_physics",
+                       boost::program_options::bool_switch(&args.multithreaded_physics),
+                       "Step the physics on multiple threads. Runs with the same "
+                       "seed are then no longer identical");
+    desc.add_options()("latency_tracing",
+                       boost::program_options::bool_switch(&args.latency_tracing),
+                       "Echo the latency traces of the primitives back in the robot "
+                       "statuses like the real robots do. Use with the full system's "
+                       "--loopback_latency_tracing");
+    desc.add_options()("seed", boost::program_options::value<uint32_t>(&args.seed),
+                       "Seed for the simulated noise and packet loss, so that runs "
+                       "with the same inputs are identical. 0 to seed from the time");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -84,18 +113,27 @@ int main(int argc, char **argv)
         {
             realism_config = ErForceSimulator::createDefaultRealismConfig();
         }
+        realism_config->set_seed(args.seed);
 
         if (args.division == "div_a")
         {
             er_force_sim = std::make_shared<ErForceSimulator>(
-                TbotsProto::FieldType::DIV_A, create2021RobotConstants(), realism_config);
+                TbotsProto::FieldType::DIV_A, create2021RobotConstants(), realism_config,
+                false, DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK,
+                args.multithreaded_physics);
         }
         else
         {
             er_force_sim = std::make_shared<ErForceSimulator>(
-                TbotsProto::FieldType::DIV_B, create2021RobotConstants(), realism_config);
+                TbotsProto::FieldType::DIV_B, create2021RobotConstants(), realism_config,
+                false, DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK,
+                args.multithreaded_physics);
         }
 
+        er_force_sim->setVisionPacketRates(args.camera_frame_rate_hz,
+                                           args.geometry_packet_rate_hz);
+        er_force_sim->setLatencyTracingEnabled(args.latency_tracing);
+
         std::mutex simulator_mutex;
 
         // World Buffer
@@ -13,56 +13,40 @@ std::optional<Point> endInObstacleSample(const std::vector<ObstaclePtr> &obstacl
                                          int initial_count, double radius_step,
                                          int samples_per_radius_step,
                                          double max_search_radius)
+{
+    return endInObstacleSample(ObstacleSet(obstacles), point, navigable_area,
+                               initial_count, radius_step, samples_per_radius_step,
+                               max_search_radius);
+}
+
+std::optional<Point> endInObstacleSample(const ObstacleSet &obstacles, const Point &point,
+                                         const Rectangle &navigable_area,
+                                         int initial_count, double radius_step,
+                                         int samples_per_radius_step,
+                                         double max_search_radius)
 {
     // first, check if point is inside an obstacle or outside the navigable area
     bool point_in_obstacle = false;
     if (contains(navigable_area, point))
     {
-        for (auto const &obstacle : obstacles)
+        ObstaclePtr obstacle = obstacles.findContainingObstacle(point);
+        if (obstacle)
         {
-            if (obstacle->contains(point))
-            {
-                point_in_obstacle = true;
+            point_in_obstacle = true;
 
-                // if point is inside obstacle, perform a second check to see if the
-                // closest point outside the first encroached obstacle is inside another
-                // obstacle
-                Point closest_point = obstacle->closestPoint(point);
-                closest_point += (closest_point - point)
-                                     .normalize(OBSTACLE_AVOIDANCE_BUFFER_CENTIMETERS);
-                bool closest_point_in_obstacle = false;
+            // if point is inside obstacle, perform a second check to see if the
+            // closest point outside the first encroached obstacle is inside another
+            // obstacle or outside the navigable area
+            Point closest_point = obstacle->closestPoint(point);
+            closest_point +=
+                (closest_point - point).normalize(OBSTACLE_AVOIDANCE_BUFFER_CENTIMETERS);
 
-                // break out of loop if closest point outside first encroached obstacle is
-                // outside navigable area
-                if (contains(navigable_area, closest_point))
-                {
-                    for (auto const &obstacle : obstacles)
-                    {
-                        // break out of loop if closest point outside first encroached
-                        // obstacle happens to be inside another obstacle
-                        if (obstacle->contains(closest_point))
-                        {
-                            closest_point_in_obstacle = true;
-                            break;
-                        }
-                    }
-                }
-                else
-                {
-                    closest_point_in_obstacle = true;
-                    break;
-                }
-
-                if (closest_point_in_obstacle)
-                {
-                    break;
-                }
-                else
-                {
-                    // if the closest point outside the first encroached obstacle is not
-                    // inside any other obstacle, then return it
-                    return closest_point;
-                }
+            // if the closest point outside the first encroached obstacle is not
+            // inside any other obstacle, then return it
+            if (contains(navigable_area, closest_point) &&
+                !obstacles.contains(closest_point))
+            {
+                return closest_point;
             }
         }
     }
@@ -89,26 +73,9 @@ std::optional<Point> endInObstacleSample(const std::vector<ObstaclePtr> &obstacl
             Angle angle        = Angle::fromDegrees(static_cast<double>(i) * increment);
             Vector direction   = Vector::createFromAngle(angle);
             Point sample_point = point + direction * radius;
-            bool sample_point_in_obstacle = false;
             // check if candidate sample point is in an obstacle or outside navigable area
-            if (contains(navigable_area, sample_point))
-            {
-                for (auto const &obstacle : obstacles)
-                {
-                    if (obstacle->contains(sample_point) ||
-                        !contains(navigable_area, sample_point))
-                    {
-                        sample_point_in_obstacle = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                sample_point_in_obstacle = true;
-            }
-
-            if (!sample_point_in_obstacle)
+            if (contains(navigable_area, sample_point) &&
+                !obstacles.contains(sample_point))
             {
                 return sample_point;
             }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_set.h"
 #include "software/geom/point.h"
 #include "software/geom/rectangle.h"
 
@@ -10,7 +11,7 @@
  * inside an obstacle, and that point will be returned. Otherwise, the originally provided
  * point will just be returned
  *
- * @param obstacles a list of obstacles to test the point against
+ * @param obstacles a list or set of obstacles to test the point against
  * @param point the destination point
  * @param navigable_area the rectangular region which the returned point must be inside of
  * @param initial_count the number of points to sample for the initial radius in the case
@@ -30,3 +31,8 @@ std::optional<Point> endInObstacleSample(const std::vector<ObstaclePtr>& obstacl
                                          int initial_count = 6, double radius_step = 0.15,
                                          int samples_per_radius_step = 2,
                                          double max_search_radius    = 4.0);
+std::optional<Point> endInObstacleSample(const ObstacleSet& obstacles, const Point& point,
+                                         const Rectangle& navigable_area,
+                                         int initial_count = 6, double radius_step = 0.15,
+                                         int samples_per_radius_step = 2,
+                                         double max_search_radius    = 4.0);
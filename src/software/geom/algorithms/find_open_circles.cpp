@@ -68,7 +68,7 @@ std::vector<Circle> findOpenCircles(const Rectangle &bounding_box,
                     halfPoint -
                         (perpVec *
                          (furthestPoint(bounding_box, halfPoint) - halfPoint).length())));
-        std::vector<Point> corners = bounding_box.getPoints();
+        const Polygon::Points &corners = bounding_box.getPoints();
         std::copy(corners.begin(), corners.end(),
                   std::inserter(intersections, intersections.end()));
         for (const Point &intersect : intersections)
@@ -6,7 +6,7 @@
 
 Point furthestPoint(const Rectangle &a, const Point &b)
 {
-    std::vector<Point> corners = a.getPoints();
+    const Polygon::Points &corners = a.getPoints();
 
     return *std::max_element(corners.begin(), corners.end(),
                              [&](const Point &corner1, const Point &corner2)
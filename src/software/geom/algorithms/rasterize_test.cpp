@@ -29,7 +29,7 @@ void checkPointsCloseToEachOther(std::vector<Point> all_points, double max_dist)
 
 void checkPolygonPointsInsideBoundingBox(Polygon polygon, std::vector<Point> all_points)
 {
-    const std::vector<Point>& polygon_vertices = polygon.getPoints();
+    const Polygon::Points& polygon_vertices = polygon.getPoints();
     auto max_point_y = [](const Point& a, const Point& b) { return a.y() < b.y(); };
 
     auto max_point_x = [](const Point& a, const Point& b) { return a.x() < b.x(); };
@@ -33,7 +33,7 @@ double signedDistance(const Point &first, const Rectangle &second)
 
 double signedDistance(const Polygon &first, const Point &second)
 {
-    std::vector<Point> points = first.getPoints();
+    const Polygon::Points &points = first.getPoints();
 
     double min_length = (second - points[0]).lengthSquared();
     double s          = 1.0;
@@ -144,7 +144,7 @@ double ConvexPolygon::area() const
     // A = (1/2) * [(x1*y2 + x2y3 + x3y4 + ... + xny1) - (y1x2 + y2x3 + y3x4 + ... +
     // ynx1)] Coordinates must be taken in counterclockwise order around the polygon,
     // beginning and ending in the same point.
-    std::vector<Point> reversePoints = points_;
+    Points reversePoints = points_;
     std::reverse(reversePoints.begin(), reversePoints.end());
 
     double first_term  = 0;
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/intersects.h"
+#include "software/geom/polygon.h"
+#include "software/geom/rectangle.h"
+
+namespace
+{
+// The number of heap allocations made by this test binary
+std::atomic<std::size_t> num_allocations{0};
+
+/**
+ * Counts the heap allocations made by a function
+ *
+ * @param function The function to run
+ *
+ * @return the number of heap allocations made while running the function
+ */
+template <typename Function>
+std::size_t countAllocations(Function function)
+{
+    const std::size_t num_allocations_before = num_allocations;
+    function();
+    return num_allocations - num_allocations_before;
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    num_allocations++;
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+TEST(GeomAllocationTest, creating_copying_and_expanding_rectangle_does_not_allocate)
+{
+    std::size_t allocations = countAllocations(
+        []()
+        {
+            Rectangle rectangle(Point(-1, -2), Point(3, 4));
+            Rectangle rectangle_copy = rectangle;
+            Rectangle expanded       = rectangle_copy.expand(0.5);
+            EXPECT_DOUBLE_EQ(5, expanded.xLength());
+        });
+
+    EXPECT_EQ(0, allocations);
+}
+
+TEST(GeomAllocationTest, creating_and_expanding_polygon_from_segment_does_not_allocate)
+{
+    std::size_t allocations = countAllocations(
+        []()
+        {
+            Polygon polygon  = Polygon::fromSegment(Segment(Point(0, 0), Point(2, 0)), 1);
+            Polygon expanded = polygon.expand(0.5);
+            EXPECT_EQ(4, expanded.getPoints().size());
+        });
+
+    EXPECT_EQ(0, allocations);
+}
+
+TEST(GeomAllocationTest, polygon_algorithms_do_not_allocate)
+{
+    Polygon polygon({Point(0, 0), Point(2, 0), Point(3, 1), Point(2, 2), Point(0, 2)});
+
+    std::size_t allocations = countAllocations(
+        [&polygon]()
+        {
+            EXPECT_TRUE(contains(polygon, Point(1, 1)));
+            EXPECT_TRUE(intersects(polygon, Segment(Point(-1, 1), Point(1, 1))));
+            EXPECT_EQ(5, polygon.getSegments().size());
+            EXPECT_GT(polygon.perimeter(), 0);
+        });
+
+    EXPECT_EQ(0, allocations);
+}
+
+TEST(GeomAllocationTest, polygon_with_more_points_than_inline_storage_allocates)
+{
+    std::size_t allocations = countAllocations(
+        []()
+        {
+            Polygon::Points points;
+            for (std::size_t i = 0; i <= Polygon::MAX_INLINE_POINTS; i++)
+            {
+                const Angle angle =
+                    Angle::full() * static_cast<double>(i) /
+                    static_cast<double>(Polygon::MAX_INLINE_POINTS + 1);
+                points.emplace_back(Point(Vector::createFromAngle(angle)));
+            }
+            Polygon polygon(points);
+            EXPECT_EQ(Polygon::MAX_INLINE_POINTS + 1, polygon.getPoints().size());
+        });
+
+    EXPECT_GT(allocations, 0);
+}
@@ -3,25 +3,16 @@
 #include <numeric>
 #include <unordered_set>
 
-Polygon::Polygon(const std::vector<Point>& points) : points_(points)
+Polygon::Polygon(const std::vector<Point>& points) : points_(points.begin(), points.end())
 {
-    // we pre-compute the segments_ in the constructor to improve performance
-    initSegments();
 }
 
-Polygon::Polygon(const std::initializer_list<Point>& points)
-    : Polygon(std::vector(points))
+Polygon::Polygon(const std::initializer_list<Point>& points) : points_(points)
 {
 }
 
-void Polygon::initSegments()
+Polygon::Polygon(const Points& points) : points_(points)
 {
-    for (unsigned i = 0; i < points_.size(); i++)
-    {
-        // add a segment between consecutive points, but wrap index
-        // to draw a segment from the last point to first point.
-        segments_.emplace_back(Segment{points_[i], points_[(i + 1) % points_.size()]});
-    }
 }
 
 Point Polygon::centroid() const
@@ -56,17 +47,18 @@ Polygon Polygon::expand(double expansion_amount) const
             "Polygon::expand: expansion_amount must be non-negative");
     }
     Point centroid_point = centroid();
-    std::vector<Point> expanded_points;
+    Segments segments    = getSegments();
+    Points expanded_points;
     expanded_points.reserve(points_.size());
 
     Vector last_expansion =
-        (segments_[0].midPoint() - centroid_point).normalize(expansion_amount);
-    Point first_point = segments_[0].getStart() + last_expansion;
-    for (size_t i = 1; i < segments_.size(); i++)
+        (segments[0].midPoint() - centroid_point).normalize(expansion_amount);
+    Point first_point = segments[0].getStart() + last_expansion;
+    for (size_t i = 1; i < segments.size(); i++)
     {
         Vector current_expansion =
-            (segments_[i].midPoint() - centroid_point).normalize(expansion_amount);
-        expanded_points.emplace_back(segments_[i].getStart() + current_expansion +
+            (segments[i].midPoint() - centroid_point).normalize(expansion_amount);
+        expanded_points.emplace_back(segments[i].getStart() + current_expansion +
                                      last_expansion);
         last_expansion = current_expansion;
     }
@@ -132,19 +124,28 @@ Polygon Polygon::fromSegment(const Segment& segment, const double length_radius,
     });
 }
 
-const std::vector<Segment>& Polygon::getSegments() const
+Polygon::Segments Polygon::getSegments() const
 {
-    return segments_;
+    Segments segments;
+    segments.reserve(points_.size());
+    for (unsigned i = 0; i < points_.size(); i++)
+    {
+        // add a segment between consecutive points, but wrap index
+        // to draw a segment from the last point to first point.
+        segments.emplace_back(Segment{points_[i], points_[(i + 1) % points_.size()]});
+    }
+    return segments;
 }
 
-const std::vector<Point>& Polygon::getPoints() const
+const Polygon::Points& Polygon::getPoints() const
 {
     return points_;
 }
 
 double Polygon::perimeter() const
 {
-    return (std::accumulate(segments_.begin(), segments_.end(), 0.0,
+    const Segments segments = getSegments();
+    return (std::accumulate(segments.begin(), segments.end(), 0.0,
                             [](double acc, const Segment& seg)
                             { return acc + seg.length(); }));
 }
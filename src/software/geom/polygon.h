@@ -1,5 +1,6 @@
 #pragma once
 
+#include <boost/container/small_vector.hpp>
 #include <vector>
 
 #include "software/geom/segment.h"
@@ -7,10 +8,19 @@
 
 /**
  * A shape composed of line segments.
+ *
+ * The points are stored inline for polygons with up to MAX_INLINE_POINTS points, such
+ * as rectangles and the polygons created from segments, so creating and copying them
+ * does not allocate. The segments are not stored, and are built when they are needed.
  */
 class Polygon : public virtual Shape
 {
    public:
+    static constexpr std::size_t MAX_INLINE_POINTS = 8;
+
+    using Points   = boost::container::small_vector<Point, MAX_INLINE_POINTS>;
+    using Segments = boost::container::small_vector<Segment, MAX_INLINE_POINTS>;
+
     Polygon() = delete;
     /**
      * Construct a polygon by drawing line segments between consecutive
@@ -26,6 +36,13 @@ class Polygon : public virtual Shape
      */
     explicit Polygon(const std::initializer_list<Point>& points);
 
+    /**
+     * Construct a polygon by drawing line segments between consecutive
+     * Points, and then from the last Point to the first Point.
+     * @param points Points that form a polygon
+     */
+    explicit Polygon(const Points& points);
+
     /**
      * Returns the centroid of this polygon
      *
@@ -51,16 +68,17 @@ class Polygon : public virtual Shape
     double perimeter() const;
 
     /**
-     * Returns the line segments that form this polygon.
+     * Returns the line segments that form this polygon. The segments are built from
+     * the points on every call.
      * @return the line segments that form this polygon.
      */
-    const std::vector<Segment>& getSegments() const;
+    Segments getSegments() const;
 
     /**
      * Returns the points that form the polygon.
      * @return the points that form the polygon.
      */
-    const std::vector<Point>& getPoints() const;
+    const Points& getPoints() const;
 
     /**
      * Creates a rectangular polygon that is oriented along the segment.
@@ -78,13 +96,7 @@ class Polygon : public virtual Shape
     static Polygon fromSegment(const Segment& segment, double radius);
 
    protected:
-    /**
-     * Initializes the segments_ vector
-     */
-    void initSegments();
-
-    std::vector<Point> points_;
-    std::vector<Segment> segments_;
+    Points points_;
 };
 
 bool operator==(const Polygon& poly1, const Polygon& poly2);
@@ -78,8 +78,13 @@ double Rectangle::yMin() const
 
 Rectangle Rectangle::expand(double expansion_amount) const
 {
-    auto points = Polygon::expand(expansion_amount).getPoints();
-    return Rectangle(points[0], points[2]);
+    if (expansion_amount < 0)
+    {
+        throw std::invalid_argument(
+            "Rectangle::expand: expansion_amount must be non-negative");
+    }
+    const Vector expansion(expansion_amount, expansion_amount);
+    return Rectangle(negXNegYCorner() - expansion, posXPosYCorner() + expansion);
 }
 
 bool Rectangle::operator==(const Rectangle &p) const
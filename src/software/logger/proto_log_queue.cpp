@@ -0,0 +1,97 @@
+#include "software/logger/proto_log_queue.h"
+
+#include <chrono>
+
+ProtoLogQueue::ProtoLogQueue(std::size_t capacity)
+    : capacity(capacity), num_queued(0), next_sequence_number(0), num_dropped({})
+{
+}
+
+void ProtoLogQueue::push(SerializedProtoLog log, ProtoLogPriority priority)
+{
+    const auto priority_index = static_cast<std::size_t>(priority);
+
+    {
+        std::scoped_lock lock(queue_mutex);
+
+        if (num_queued >= capacity)
+        {
+            // Drop the oldest message of the lowest priority that is not more
+            // important than the new message
+            std::optional<std::size_t> priority_to_drop;
+            for (std::size_t i = 0; i <= priority_index; i++)
+            {
+                if (!queues[i].empty())
+                {
+                    priority_to_drop = i;
+                    break;
+                }
+            }
+
+            if (!priority_to_drop)
+            {
+                num_dropped[priority_index]++;
+                return;
+            }
+
+            queues[*priority_to_drop].pop_front();
+            num_dropped[*priority_to_drop]++;
+            num_queued--;
+        }
+
+        queues[priority_index].push_back({
+            .sequence_number = next_sequence_number++,
+            .log             = std::move(log),
+        });
+        num_queued++;
+    }
+
+    queue_not_empty_cv.notify_one();
+}
+
+std::optional<SerializedProtoLog> ProtoLogQueue::pop(Duration max_wait_time)
+{
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    queue_not_empty_cv.wait_for(
+        lock, std::chrono::duration<double>(max_wait_time.toSeconds()),
+        [this] { return num_queued > 0; });
+
+    if (num_queued == 0)
+    {
+        return std::nullopt;
+    }
+
+    // The least recently pushed message is at the front of one of the queues
+    std::deque<QueuedProtoLog>* oldest_queue = nullptr;
+    for (auto& queue : queues)
+    {
+        if (!queue.empty() &&
+            (!oldest_queue ||
+             queue.front().sequence_number < oldest_queue->front().sequence_number))
+        {
+            oldest_queue = &queue;
+        }
+    }
+
+    SerializedProtoLog log = std::move(oldest_queue->front().log);
+    oldest_queue->pop_front();
+    num_queued--;
+    return log;
+}
+
+std::size_t ProtoLogQueue::size() const
+{
+    std::scoped_lock lock(queue_mutex);
+    return num_queued;
+}
+
+bool ProtoLogQueue::empty() const
+{
+    return size() == 0;
+}
+
+uint64_t ProtoLogQueue::getNumDropped(ProtoLogPriority priority) const
+{
+    std::scoped_lock lock(queue_mutex);
+    return num_dropped[static_cast<std::size_t>(priority)];
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "software/time/duration.h"
+
+/**
+ * A serialized protobuf message to be written to a replay log
+ */
+struct SerializedProtoLog
+{
+    std::string protobuf_type_full_name;
+    std::string serialized_proto;
+    double receive_time_sec;
+};
+
+/**
+ * How important it is to keep a message in a replay log when the logger can not keep
+ * up and has to drop messages. Messages of a lower priority are dropped first.
+ */
+enum class ProtoLogPriority : unsigned int
+{
+    LOW    = 0,
+    NORMAL = 1,
+    HIGH   = 2,
+};
+
+static constexpr std::size_t NUM_PROTO_LOG_PRIORITIES = 3;
+
+/**
+ * A bounded, thread-safe queue of messages to be logged, which returns the messages in
+ * the order they were pushed.
+ *
+ * When the queue is full, pushing a message drops the oldest queued message with the
+ * lowest priority that is not higher than the priority of the new message. If every
+ * queued message has a higher priority, the new message is dropped instead. The number
+ * of messages dropped is counted for each priority.
+ */
+class ProtoLogQueue
+{
+   public:
+    /**
+     * Creates a new ProtoLogQueue
+     *
+     * @param capacity The maximum number of messages in the queue
+     */
+    explicit ProtoLogQueue(std::size_t capacity);
+
+    ProtoLogQueue()                                = delete;
+    ProtoLogQueue(const ProtoLogQueue&)            = delete;
+    ProtoLogQueue& operator=(const ProtoLogQueue&) = delete;
+
+    /**
+     * Adds a message to the queue, dropping a message if the queue is full
+     *
+     * @param log The message to add
+     * @param priority The priority of the message
+     */
+    void push(SerializedProtoLog log, ProtoLogPriority priority);
+
+    /**
+     * Removes the message least recently pushed to the queue and returns it. If the
+     * queue is empty, this blocks until a message is pushed or the given amount of time
+     * is exceeded.
+     *
+     * @param max_wait_time The maximum duration to wait for a message
+     *
+     * @return The least recently pushed message, or std::nullopt if none is available
+     */
+    std::optional<SerializedProtoLog> pop(
+        Duration max_wait_time = Duration::fromSeconds(0));
+
+    /**
+     * Gets the number of messages in the queue
+     *
+     * @return the number of messages in the queue
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns whether the queue is empty
+     *
+     * @return true if the queue is empty, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * Gets the number of messages of a priority that were dropped because the queue
+     * was full
+     *
+     * @param priority The priority of the messages
+     *
+     * @return the number of messages of the priority that were dropped
+     */
+    uint64_t getNumDropped(ProtoLogPriority priority) const;
+
+   private:
+    /**
+     * A message in the queue, with the order it was pushed in
+     */
+    struct QueuedProtoLog
+    {
+        uint64_t sequence_number;
+        SerializedProtoLog log;
+    };
+
+    const std::size_t capacity;
+
+    mutable std::mutex queue_mutex;
+    std::condition_variable queue_not_empty_cv;
+
+    // The messages of each priority, indexed by priority, each in the order they
+    // were pushed
+    std::array<std::deque<QueuedProtoLog>, NUM_PROTO_LOG_PRIORITIES> queues;
+    std::size_t num_queued;
+    uint64_t next_sequence_number;
+    std::array<uint64_t, NUM_PROTO_LOG_PRIORITIES> num_dropped;
+};
@@ -0,0 +1,106 @@
+#include "software/logger/proto_log_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+SerializedProtoLog createLog(const std::string& serialized_proto)
+{
+    return {
+        .protobuf_type_full_name = "TbotsProto.Test",
+        .serialized_proto        = serialized_proto,
+        .receive_time_sec        = 0,
+    };
+}
+
+TEST(ProtoLogQueueTest, pop_from_empty_queue_times_out)
+{
+    ProtoLogQueue queue(2);
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(std::nullopt, queue.pop(Duration::fromMilliseconds(10)));
+}
+
+TEST(ProtoLogQueueTest, pops_logs_in_the_order_they_were_pushed)
+{
+    ProtoLogQueue queue(4);
+    queue.push(createLog("a"), ProtoLogPriority::LOW);
+    queue.push(createLog("b"), ProtoLogPriority::HIGH);
+    queue.push(createLog("c"), ProtoLogPriority::NORMAL);
+    queue.push(createLog("d"), ProtoLogPriority::LOW);
+
+    EXPECT_EQ(4, queue.size());
+    for (const std::string& expected : {"a", "b", "c", "d"})
+    {
+        std::optional<SerializedProtoLog> log = queue.pop();
+        ASSERT_TRUE(log);
+        EXPECT_EQ(expected, log->serialized_proto);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ProtoLogQueueTest, full_queue_drops_oldest_log_with_lowest_priority)
+{
+    ProtoLogQueue queue(3);
+    queue.push(createLog("high"), ProtoLogPriority::HIGH);
+    queue.push(createLog("low_1"), ProtoLogPriority::LOW);
+    queue.push(createLog("low_2"), ProtoLogPriority::LOW);
+    queue.push(createLog("normal"), ProtoLogPriority::NORMAL);
+
+    EXPECT_EQ(3, queue.size());
+    EXPECT_EQ(1, queue.getNumDropped(ProtoLogPriority::LOW));
+    EXPECT_EQ(0, queue.getNumDropped(ProtoLogPriority::NORMAL));
+    EXPECT_EQ("high", queue.pop()->serialized_proto);
+    EXPECT_EQ("low_2", queue.pop()->serialized_proto);
+    EXPECT_EQ("normal", queue.pop()->serialized_proto);
+}
+
+TEST(ProtoLogQueueTest, full_queue_drops_new_log_with_lowest_priority)
+{
+    ProtoLogQueue queue(2);
+    queue.push(createLog("high"), ProtoLogPriority::HIGH);
+    queue.push(createLog("normal"), ProtoLogPriority::NORMAL);
+    queue.push(createLog("low"), ProtoLogPriority::LOW);
+
+    EXPECT_EQ(1, queue.getNumDropped(ProtoLogPriority::LOW));
+    EXPECT_EQ("high", queue.pop()->serialized_proto);
+    EXPECT_EQ("normal", queue.pop()->serialized_proto);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ProtoLogQueueTest, high_priority_logs_are_kept_while_lower_priority_logs_are_queued)
+{
+    ProtoLogQueue queue(10);
+    for (unsigned int i = 0; i < 100; i++)
+    {
+        queue.push(createLog("low"), ProtoLogPriority::LOW);
+        if (i % 10 == 0)
+        {
+            queue.push(createLog("high"), ProtoLogPriority::HIGH);
+        }
+    }
+
+    EXPECT_EQ(0, queue.getNumDropped(ProtoLogPriority::HIGH));
+    EXPECT_EQ(100, queue.getNumDropped(ProtoLogPriority::LOW));
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ("high", queue.pop()->serialized_proto);
+    }
+}
+
+TEST(ProtoLogQueueTest, pop_waits_for_push)
+{
+    ProtoLogQueue queue(2);
+    std::thread pusher(
+        [&queue]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            queue.push(createLog("a"), ProtoLogPriority::NORMAL);
+        });
+
+    std::optional<SerializedProtoLog> log = queue.pop(Duration::fromSeconds(5));
+    pusher.join();
+
+    ASSERT_TRUE(log);
+    EXPECT_EQ("a", log->serialized_proto);
+}
@@ -9,9 +9,16 @@
 #include <fstream>
 #include <iomanip>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include "base64.h"
+#include "proto/parameters.pb.h"
+#include "proto/replay_bookmark.pb.h"
+#include "proto/ssl_gc_referee_message.pb.h"
+#include "proto/tbots_software_msgs.pb.h"
+#include "proto/visualization.pb.h"
+#include "proto/world.pb.h"
 #include "shared/constants.h"
 
 ProtoLogger::ProtoLogger(const std::string& log_path,
@@ -21,7 +28,10 @@ ProtoLogger::ProtoLogger(const std::string& log_path,
       time_provider_(time_provider),
       friendly_colour_yellow_(friendly_colour_yellow),
       stop_logging_(false),
-      buffer_(PROTOBUF_BUFFER_SIZE, true)
+      destructor_called_time_sec_(0),
+      buffer_(PROTOBUF_BUFFER_SIZE),
+      entries_logged_(0),
+      chunks_written_(0)
 {
     start_time_ = time_provider_();
 
@@ -33,7 +43,11 @@ ProtoLogger::ProtoLogger(const std::string& log_path,
     log_folder_ = log_path_ + "/" + REPLAY_FILE_PREFIX + ss.str() + "/";
     std::experimental::filesystem::create_directories(log_folder_);
 
-    // Start logging in a separate thread
+    // Start logging in separate threads
+    for (unsigned int i = 0; i < NUM_COMPRESSION_THREADS; i++)
+    {
+        compression_threads_.emplace_back(&ProtoLogger::compressChunks, this);
+    }
     log_thread_ = std::thread(&ProtoLogger::logProtobufs, this);
 }
 
@@ -45,48 +59,42 @@ ProtoLogger::~ProtoLogger()
 void ProtoLogger::saveSerializedProto(const std::string& protobuf_type_full_name,
                                       const std::string& serialized_proto)
 {
-    buffer_.push({
-        .protobuf_type_full_name = protobuf_type_full_name,
-        .serialized_proto        = serialized_proto,
-        .receive_time_sec        = time_provider_() - start_time_,
-    });
+    buffer_.push(
+        {
+            .protobuf_type_full_name = protobuf_type_full_name,
+            .serialized_proto        = serialized_proto,
+            .receive_time_sec        = time_provider_() - start_time_,
+        },
+        getProtoLogPriority(protobuf_type_full_name));
 }
 
 void ProtoLogger::logProtobufs()
 {
     unsigned int replay_index = 0;
 
+    // Start every replay file with the metadata, which includes the file format
+    // version. This allows us to keep backwards compatibility as the replay file
+    // format evolves.
+    const std::string file_metadata =
+        REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_FILE_VERSION) + "\n";
+
     while (!shouldStopLogging())
     {
-        std::string log_file_path =
-            log_folder_ + std::to_string(replay_index) + "." + REPLAY_FILE_EXTENSION;
-
-        gzFile gz_file = gzopen(log_file_path.c_str(), "wb");
-        if (!gz_file)
-        {
-            std::cerr << "ProtoLogger: Failed to open gzip log file: " << log_file_path
-                      << " Error: " + std::string(strerror(errno))
-                      << "\nStopping ProtoLogger logger thread!" << std::endl;
-            return;
-        }
+        std::string chunk_data = file_metadata;
+        std::optional<std::chrono::steady_clock::time_point> chunk_start_time;
 
-        // Start every replay file with the metadata, which includes the file format
-        // version. This allows us to keep backwards compatibility as the replay file
-        // format evolves.
-        std::string file_metadata =
-            REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_FILE_VERSION) + "\n";
-        int num_bytes_written = gzwrite(gz_file, file_metadata.c_str(),
-                                        static_cast<unsigned>(file_metadata.size()));
-        if (num_bytes_written != static_cast<int>(file_metadata.size()))
+        auto chunk_is_full = [&]()
         {
-            std::cerr << "ProtoLogger: Failed to write metadata to log file: "
-                      << log_file_path << std::endl;
-        }
+            return chunk_data.size() >= REPLAY_MAX_CHUNK_SIZE_BYTES ||
+                   (chunk_start_time &&
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                  *chunk_start_time)
+                            .count() >= REPLAY_MAX_CHUNK_DURATION_SEC);
+        };
 
-        while (!shouldStopLogging())
+        while (!shouldStopLogging() && !chunk_is_full())
         {
-            auto serialized_proto_opt =
-                buffer_.popLeastRecentlyAddedValue(BUFFER_BLOCK_TIMEOUT);
+            auto serialized_proto_opt = buffer_.pop(BUFFER_BLOCK_TIMEOUT);
             if (!serialized_proto_opt.has_value())
             {
                 // Timed out without getting a new value
@@ -96,42 +104,154 @@ void ProtoLogger::logProtobufs()
             const auto& [proto_full_name, serialized_proto, receive_time_sec] =
                 serialized_proto_opt.value();
 
-            // Write the log entry to the file with the format:
-            std::string log_entry =
+            chunk_data +=
                 createLogEntry(proto_full_name, serialized_proto, receive_time_sec);
-            num_bytes_written = gzwrite(gz_file, log_entry.c_str(),
-                                        static_cast<unsigned>(log_entry.size()));
+            entries_logged_++;
 
-            // Check if write was successful
-            if (num_bytes_written != static_cast<int>(log_entry.size()))
+            if (!chunk_start_time)
             {
-                // Only log every FAILED_LOG_PRINT_FREQUENCY times to avoid
-                // spamming the console if the error persists.
-                if (failed_logs_frequency_counter_ == 0)
-                {
-                    std::cerr << "ProtoLogger: Failed to write " << proto_full_name
-                              << " to log file: " << log_file_path << " "
-                              << std::to_string(failed_logs_frequency_counter_)
-                              << " times" << std::endl;
-                }
-                failed_logs_frequency_counter_ =
-                    (failed_logs_frequency_counter_ + 1) % FAILED_LOG_PRINT_FREQUENCY;
+                chunk_start_time = std::chrono::steady_clock::now();
             }
+        }
 
-            // Limit the size of each replay chunk
-            if (gzoffset(gz_file) > REPLAY_MAX_CHUNK_SIZE_BYTES)
+        // Chunks without entries are not written, so no files are created while
+        // nothing is being logged
+        if (chunk_start_time)
+        {
+            submitChunk({.replay_index = replay_index, .data = std::move(chunk_data)});
+            replay_index++;
+        }
+    }
+
+    {
+        std::scoped_lock lock(pending_chunks_mutex_);
+        no_more_chunks_ = true;
+    }
+    pending_chunks_cv_.notify_all();
+}
+
+void ProtoLogger::submitChunk(PendingChunk chunk)
+{
+    {
+        std::unique_lock<std::mutex> lock(pending_chunks_mutex_);
+        // Block while the compression threads are behind. The entries queue up in the
+        // meantime, and the least important entries are dropped if the queue fills up.
+        pending_chunks_cv_.wait(lock,
+                                [this]
+                                {
+                                    return pending_chunks_.size() +
+                                               num_chunks_compressing_ <
+                                           MAX_PENDING_CHUNKS;
+                                });
+        pending_chunks_.push_back(std::move(chunk));
+    }
+    pending_chunks_cv_.notify_all();
+}
+
+void ProtoLogger::compressChunks()
+{
+    while (true)
+    {
+        PendingChunk chunk;
+        {
+            std::unique_lock<std::mutex> lock(pending_chunks_mutex_);
+            pending_chunks_cv_.wait(
+                lock, [this] { return !pending_chunks_.empty() || no_more_chunks_; });
+            if (pending_chunks_.empty())
             {
-                break;
+                return;
             }
+
+            chunk = std::move(pending_chunks_.front());
+            pending_chunks_.pop_front();
+            num_chunks_compressing_++;
+        }
+
+        std::optional<std::string> compressed_data = compressChunk(chunk.data);
+        if (!compressed_data)
+        {
+            std::cerr << "ProtoLogger: Failed to compress replay chunk "
+                      << chunk.replay_index << std::endl;
         }
+        writeChunkInOrder(chunk.replay_index, std::move(compressed_data));
+
+        {
+            std::scoped_lock lock(pending_chunks_mutex_);
+            num_chunks_compressing_--;
+        }
+        pending_chunks_cv_.notify_all();
+    }
+}
+
+std::optional<std::string> ProtoLogger::compressChunk(const std::string& data)
+{
+    z_stream stream{};
+    // Adding 16 to the window bits writes a gzip header and trailer, so the chunk is
+    // the same as a file written with gzopen
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return std::nullopt;
+    }
+
+    std::string compressed_data(deflateBound(&stream, data.size()), '\0');
+    stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in  = static_cast<uInt>(data.size());
+    stream.next_out  = reinterpret_cast<Bytef*>(compressed_data.data());
+    stream.avail_out = static_cast<uInt>(compressed_data.size());
+
+    int result = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END)
+    {
+        return std::nullopt;
+    }
 
-        int result = gzclose(gz_file);
-        if (result != Z_OK)
+    compressed_data.resize(stream.total_out);
+    return compressed_data;
+}
+
+void ProtoLogger::writeChunkInOrder(unsigned int replay_index,
+                                    std::optional<std::string> compressed_data)
+{
+    std::scoped_lock lock(write_mutex_);
+    compressed_chunks_.emplace(replay_index, std::move(compressed_data));
+
+    while (!compressed_chunks_.empty() &&
+           compressed_chunks_.begin()->first == next_replay_index_to_write_)
+    {
+        const auto& [chunk_replay_index, chunk] = *compressed_chunks_.begin();
+        std::string log_file_path = log_folder_ + std::to_string(chunk_replay_index) +
+                                    "." + REPLAY_FILE_EXTENSION;
+        // Write to a temporary file first, so that a partially written chunk is never
+        // read
+        std::string temp_file_path = log_file_path + ".tmp";
+
+        if (chunk)
         {
-            std::cerr << "ProtoLogger: Failed to close log file: " << log_file_path
-                      << " with error " << result << std::endl;
+            std::ofstream log_file(temp_file_path, std::ios::binary);
+            log_file.write(chunk->data(), static_cast<std::streamsize>(chunk->size()));
+            log_file.close();
+
+            std::error_code error_code;
+            if (log_file)
+            {
+                std::experimental::filesystem::rename(temp_file_path, log_file_path,
+                                                      error_code);
+            }
+            if (!log_file || error_code)
+            {
+                std::cerr << "ProtoLogger: Failed to write log file: " << log_file_path
+                          << " Error: " + std::string(strerror(errno)) << std::endl;
+            }
+            else
+            {
+                chunks_written_++;
+            }
         }
-        replay_index++;
+
+        compressed_chunks_.erase(compressed_chunks_.begin());
+        next_replay_index_to_write_++;
     }
 }
 
@@ -146,6 +266,63 @@ std::string ProtoLogger::createLogEntry(const std::string& proto_full_name,
     return log_entry_ss.str();
 }
 
+ProtoLogPriority ProtoLogger::getProtoLogPriority(
+    const std::string& protobuf_type_full_name)
+{
+    // The World, the Referee and the primitives are needed to replay what the AI saw
+    // and did, while visualizations are only needed to debug it
+    static const std::unordered_map<std::string, ProtoLogPriority> PROTO_LOG_PRIORITIES =
+        {
+            {TbotsProto::World::descriptor()->full_name(), ProtoLogPriority::HIGH},
+            {SSLProto::Referee::descriptor()->full_name(), ProtoLogPriority::HIGH},
+            {TbotsProto::PrimitiveSet::descriptor()->full_name(), ProtoLogPriority::HIGH},
+            {TbotsProto::ThunderbotsConfig::descriptor()->full_name(),
+             ProtoLogPriority::HIGH},
+            {TbotsProto::ReplayBookmark::descriptor()->full_name(),
+             ProtoLogPriority::HIGH},
+            {TbotsProto::DebugShapes::descriptor()->full_name(), ProtoLogPriority::LOW},
+            {TbotsProto::PathVisualization::descriptor()->full_name(),
+             ProtoLogPriority::LOW},
+            {TbotsProto::PassVisualization::descriptor()->full_name(),
+             ProtoLogPriority::LOW},
+            {TbotsProto::AttackerVisualization::descriptor()->full_name(),
+             ProtoLogPriority::LOW},
+            {TbotsProto::BallPlacementVisualization::descriptor()->full_name(),
+             ProtoLogPriority::LOW},
+            {TbotsProto::CostVisualization::descriptor()->full_name(),
+             ProtoLogPriority::LOW},
+            {TbotsProto::ObstacleList::descriptor()->full_name(), ProtoLogPriority::LOW},
+            {TbotsProto::NamedValue::descriptor()->full_name(), ProtoLogPriority::LOW},
+            {TbotsProto::PlotJugglerValue::descriptor()->full_name(),
+             ProtoLogPriority::LOW},
+        };
+
+    auto priority_iter = PROTO_LOG_PRIORITIES.find(protobuf_type_full_name);
+    if (priority_iter == PROTO_LOG_PRIORITIES.end())
+    {
+        return ProtoLogPriority::NORMAL;
+    }
+    return priority_iter->second;
+}
+
+ProtoLogger::Stats ProtoLogger::getStats() const
+{
+    Stats stats;
+    stats.queue_depth = buffer_.size();
+    {
+        std::scoped_lock lock(pending_chunks_mutex_);
+        stats.pending_chunks = pending_chunks_.size() + num_chunks_compressing_;
+    }
+    stats.entries_logged = entries_logged_.load();
+    for (std::size_t i = 0; i < NUM_PROTO_LOG_PRIORITIES; i++)
+    {
+        stats.entries_dropped[i] =
+            buffer_.getNumDropped(static_cast<ProtoLogPriority>(i));
+    }
+    stats.chunks_written = chunks_written_.load();
+    return stats;
+}
+
 void ProtoLogger::updateTimeProvider(std::function<double()> time_provider)
 {
     time_provider_ = time_provider;
@@ -178,6 +355,15 @@ void ProtoLogger::flushAndStopLogging()
     {
         log_thread_.join();
     }
+    // The compression threads finish once the logging thread has submitted its
+    // last chunk
+    for (std::thread& compression_thread : compression_threads_)
+    {
+        if (compression_thread.joinable())
+        {
+            compression_thread.join();
+        }
+    }
 
     // In blue, print the command to run to watch the replay
     if (friendly_colour_yellow_)
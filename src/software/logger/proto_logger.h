@@ -2,11 +2,20 @@
 
 #include <google/protobuf/message.h>
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
+#include <vector>
 
-#include "software/multithreading/thread_safe_buffer.hpp"
+#include "software/logger/proto_log_queue.h"
 
 /**
  * Logs incoming Protobufs to a folder to be played back later.
@@ -26,24 +35,37 @@
  *  2. Seek to a specific time (random access)
  *
  * To seek to a specific time, we need to load the entire log file into memory.
- * To make this feasible, we store the data in chunks. Each chunk contains
- * REPLAY_MAX_CHUNK_SIZE_BYTES of serialized protos.
+ * To make this feasible, we store the data in chunks. Each chunk contains at most
+ * REPLAY_MAX_CHUNK_SIZE_BYTES of serialized protos, received over at most
+ * REPLAY_MAX_CHUNK_DURATION_SEC.
  * We can load each chunk into memory and perform search operations to find the
  * appropriate entry. Or we can just play the chunks in order.
+ *
+ * The logging thread formats the entries into chunks, which are compressed in parallel
+ * by a pool of compression threads and then written to the chunk files in order. If
+ * the logger falls behind, entries are dropped from its queue by priority (see
+ * getProtoLogPriority), so that the World, the Referee and the primitives are only
+ * dropped after all queued visualizations. The number of dropped entries is reported
+ * by getStats.
  */
 class ProtoLogger
 {
+   public:
     /**
-     * A struct to store a serialized protobuf message for the purpose of replay logging
+     * Statistics of the logger, with the totals since it was created
      */
-    struct SerializedProtoLog
+    struct Stats
     {
-        std::string protobuf_type_full_name;
-        std::string serialized_proto;
-        double receive_time_sec;
+        // The number of entries waiting to be added to a chunk
+        std::size_t queue_depth;
+        // The number of chunks waiting to be compressed or written
+        std::size_t pending_chunks;
+        uint64_t entries_logged;
+        // The number of entries dropped, indexed by ProtoLogPriority
+        std::array<uint64_t, NUM_PROTO_LOG_PRIORITIES> entries_dropped;
+        uint64_t chunks_written;
     };
 
-   public:
     /**
      * Constructor
      * @param log_path The path to the directory where the logs will be saved
@@ -118,12 +140,71 @@ class ProtoLogger
                                       const std::string& serialized_proto,
                                       double receive_time_sec);
 
+    /**
+     * Gets the priority of a protobuf message type in the log
+     *
+     * @param protobuf_type_full_name The full name of the protobuf message type
+     *
+     * @return the priority of messages of the type
+     */
+    static ProtoLogPriority getProtoLogPriority(
+        const std::string& protobuf_type_full_name);
+
+    /**
+     * Gets the current statistics of the logger
+     *
+     * @return the statistics of the logger
+     */
+    Stats getStats() const;
+
    private:
     /**
-     * The loop which will be continuously logging the protobufs
+     * A chunk of formatted log entries waiting to be compressed
+     */
+    struct PendingChunk
+    {
+        unsigned int replay_index;
+        std::string data;
+    };
+
+    /**
+     * The loop which will be continuously formatting the protobufs into chunks
      */
     void logProtobufs();
 
+    /**
+     * Queues a chunk to be compressed, blocking while too many chunks are pending
+     *
+     * @param chunk The chunk to compress
+     */
+    void submitChunk(PendingChunk chunk);
+
+    /**
+     * The loop of a compression thread, which compresses the pending chunks until
+     * logging stops and no chunks are left
+     */
+    void compressChunks();
+
+    /**
+     * Compresses a chunk into a gzip file
+     *
+     * @param data The chunk to compress
+     *
+     * @return the gzip file contents, or std::nullopt if compression failed
+     */
+    static std::optional<std::string> compressChunk(const std::string& data);
+
+    /**
+     * Writes a compressed chunk to its chunk file once every chunk before it has been
+     * written, along with any later chunks that were waiting for it
+     *
+     * @param replay_index The index of the chunk
+     * @param compressed_data The compressed chunk, or std::nullopt if the chunk could
+     * not be compressed and is skipped
+     */
+    void writeChunkInOrder(unsigned int replay_index,
+                           std::optional<std::string> compressed_data);
+
     /**
      * Helper function to determine if the logging thread should stop
      * @return True if the logging thread should stop, false otherwise
@@ -135,18 +216,41 @@ class ProtoLogger
     std::function<double()> time_provider_;
     double start_time_;
     bool friendly_colour_yellow_;
-    unsigned int failed_logs_frequency_counter_ = 0;
 
     std::thread log_thread_;
+    std::vector<std::thread> compression_threads_;
     std::atomic<bool> stop_logging_;
-    double destructor_called_time_sec_;
+    std::atomic<double> destructor_called_time_sec_;
+
+    ProtoLogQueue buffer_;
+
+    // Chunks waiting for a compression thread
+    mutable std::mutex pending_chunks_mutex_;
+    std::condition_variable pending_chunks_cv_;
+    std::deque<PendingChunk> pending_chunks_;
+    unsigned int num_chunks_compressing_ = 0;
+    bool no_more_chunks_                 = false;
+
+    // Compressed chunks waiting for the chunks before them to be written
+    std::mutex write_mutex_;
+    std::map<unsigned int, std::optional<std::string>> compressed_chunks_;
+    unsigned int next_replay_index_to_write_ = 0;
 
-    ThreadSafeBuffer<SerializedProtoLog> buffer_;
+    std::atomic<uint64_t> entries_logged_;
+    std::atomic<uint64_t> chunks_written_;
 
     const Duration BUFFER_BLOCK_TIMEOUT                = Duration::fromSeconds(0.1);
     const std::string REPLAY_FILE_PREFIX               = "proto_";
     const std::string REPLAY_FILE_TIME_FORMAT          = "%Y_%m_%d_%H_%M_%S";
     static constexpr unsigned int PROTOBUF_BUFFER_SIZE = 1000;
+    // Chunks are compressed in memory, so their size is limited before compression
     static constexpr unsigned int REPLAY_MAX_CHUNK_SIZE_BYTES = 1024 * 1024;  // 1 MB
-    static constexpr unsigned int FAILED_LOG_PRINT_FREQUENCY  = 100;
+    // Nothing in a chunk reaches the disk until the chunk is written, so chunks are
+    // written once they are this old, even if they are not full. This limits the most
+    // recent data lost if the process does not exit cleanly, which is the data most
+    // needed to find out why it didn't
+    static constexpr double REPLAY_MAX_CHUNK_DURATION_SEC = 0.5;
+    // The logging thread blocks when this many chunks are waiting to be compressed
+    static constexpr unsigned int NUM_COMPRESSION_THREADS = 2;
+    static constexpr unsigned int MAX_PENDING_CHUNKS      = 2 * NUM_COMPRESSION_THREADS;
 };
@@ -0,0 +1,132 @@
+#include "software/logger/proto_logger.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include "proto/tbots_timestamp_msg.pb.h"
+#include "proto/visualization.pb.h"
+#include "proto/world.pb.h"
+#include "software/logger/replay_reader.h"
+
+class ProtoLoggerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        log_path = std::filesystem::temp_directory_path() /
+                   ("proto_logger_test_" + std::to_string(getpid()));
+        std::filesystem::remove_all(log_path);
+        std::filesystem::create_directories(log_path);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(log_path);
+    }
+
+    /**
+     * Gets the folder the ProtoLogger created in log_path
+     *
+     * @return the log folder
+     */
+    std::string getLogFolder() const
+    {
+        for (const auto& entry : std::filesystem::directory_iterator(log_path))
+        {
+            return entry.path().string();
+        }
+        return "";
+    }
+
+    std::filesystem::path log_path;
+};
+
+TEST_F(ProtoLoggerTest, logged_protos_are_replayed_in_order)
+{
+    constexpr unsigned int NUM_PROTOS = 500;
+
+    double time_sec = 0;
+    ProtoLogger proto_logger(
+        log_path.string(), [&time_sec]() { return time_sec; }, true);
+    for (unsigned int i = 0; i < NUM_PROTOS; i++)
+    {
+        time_sec = i;
+        TbotsProto::Timestamp timestamp;
+        timestamp.set_epoch_timestamp_seconds(i);
+        proto_logger.saveSerializedProto<TbotsProto::Timestamp>(
+            timestamp.SerializeAsString());
+    }
+    proto_logger.flushAndStopLogging();
+
+    ProtoLogger::Stats stats = proto_logger.getStats();
+    EXPECT_EQ(0, stats.queue_depth);
+    EXPECT_EQ(0, stats.pending_chunks);
+    EXPECT_EQ(NUM_PROTOS, stats.entries_logged);
+    EXPECT_EQ(1, stats.chunks_written);
+    for (uint64_t entries_dropped : stats.entries_dropped)
+    {
+        EXPECT_EQ(0, entries_dropped);
+    }
+
+    ReplayReader reader(getLogFolder());
+    ASSERT_EQ(1, reader.getChunkPaths().size());
+    std::vector<ReplayReader::ReplayEntry> entries = reader.readChunk(0);
+    ASSERT_EQ(NUM_PROTOS, entries.size());
+    for (unsigned int i = 0; i < NUM_PROTOS; i++)
+    {
+        EXPECT_DOUBLE_EQ(i, entries[i].timestamp_sec);
+        EXPECT_EQ("TbotsProto.Timestamp", entries[i].protobuf_type_full_name);
+
+        TbotsProto::Timestamp timestamp;
+        ASSERT_TRUE(timestamp.ParseFromString(entries[i].serialized_proto));
+        EXPECT_DOUBLE_EQ(i, timestamp.epoch_timestamp_seconds());
+    }
+}
+
+TEST_F(ProtoLoggerTest, no_chunks_are_written_without_protos)
+{
+    ProtoLogger proto_logger(
+        log_path.string(), []() { return 0.0; }, true);
+    proto_logger.flushAndStopLogging();
+
+    EXPECT_EQ(0, proto_logger.getStats().chunks_written);
+    EXPECT_TRUE(std::filesystem::is_empty(getLogFolder()));
+}
+
+TEST_F(ProtoLoggerTest, logged_protos_are_written_within_a_second_while_logging)
+{
+    ProtoLogger proto_logger(
+        log_path.string(), []() { return 0.0; }, true);
+    TbotsProto::Timestamp timestamp;
+    timestamp.set_epoch_timestamp_seconds(1);
+    proto_logger.saveSerializedProto<TbotsProto::Timestamp>(
+        timestamp.SerializeAsString());
+
+    // The chunk should be written once it is old enough, without waiting for it to
+    // fill up or for logging to stop
+    auto start_time = std::chrono::steady_clock::now();
+    while (proto_logger.getStats().chunks_written == 0 &&
+           std::chrono::steady_clock::now() - start_time < std::chrono::seconds(1))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(1, proto_logger.getStats().chunks_written);
+    proto_logger.flushAndStopLogging();
+}
+
+TEST(ProtoLoggerPriorityTest, visualizations_have_lower_priority_than_world)
+{
+    EXPECT_EQ(ProtoLogPriority::HIGH, ProtoLogger::getProtoLogPriority(
+                                          TbotsProto::World::descriptor()->full_name()));
+    EXPECT_EQ(ProtoLogPriority::LOW,
+              ProtoLogger::getProtoLogPriority(
+                  TbotsProto::DebugShapes::descriptor()->full_name()));
+    EXPECT_EQ(ProtoLogPriority::NORMAL,
+              ProtoLogger::getProtoLogPriority(
+                  TbotsProto::Timestamp::descriptor()->full_name()));
+}
@@ -0,0 +1,456 @@
+#include "software/logger/replay_reader.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <thread>
+
+#include "base64.h"
+#include "shared/constants.h"
+
+ReplayReader::ReplayReader(const std::string& log_folder_path)
+    : log_folder_path(log_folder_path)
+{
+    // Chunks are named <chunk index>.replay, and are sorted by their chunk index
+    std::vector<std::pair<unsigned long, std::string>> chunks;
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(log_folder_path, error))
+    {
+        const std::string stem = file.path().stem().string();
+        if (file.path().extension() == "." + REPLAY_FILE_EXTENSION && !stem.empty() &&
+            std::all_of(stem.begin(), stem.end(),
+                        [](unsigned char c) { return std::isdigit(c); }))
+        {
+            chunks.emplace_back(std::stoul(stem), file.path().string());
+        }
+    }
+
+    if (chunks.empty())
+    {
+        throw std::invalid_argument("No replay files found in \"" + log_folder_path +
+                                    "\", make sure that the path to the folder "
+                                    "containing the replay files is provided.");
+    }
+
+    std::sort(chunks.begin(), chunks.end());
+    for (const auto& [_, chunk_path] : chunks)
+    {
+        chunk_paths.push_back(chunk_path);
+    }
+    chunk_indices.resize(chunk_paths.size());
+
+    std::vector<bool> chunks_loaded = loadIndexFile();
+    std::vector<std::size_t> chunks_to_index;
+    for (std::size_t chunk_index = 0; chunk_index < chunk_paths.size(); ++chunk_index)
+    {
+        if (!chunks_loaded[chunk_index])
+        {
+            chunks_to_index.push_back(chunk_index);
+        }
+    }
+
+    if (!chunks_to_index.empty())
+    {
+        indexChunks(chunks_to_index);
+        saveIndexFile();
+    }
+
+    for (const ChunkIndex& chunk_index : chunk_indices)
+    {
+        chunk_first_entries.push_back(entry_times.size());
+        entry_times.insert(entry_times.end(), chunk_index.entry_times.begin(),
+                           chunk_index.entry_times.end());
+    }
+}
+
+const std::vector<std::string>& ReplayReader::getChunkPaths() const
+{
+    return chunk_paths;
+}
+
+std::size_t ReplayReader::getNumEntries(std::size_t chunk_index) const
+{
+    return chunk_indices.at(chunk_index).entry_times.size();
+}
+
+std::optional<double> ReplayReader::getChunkStartTime(std::size_t chunk_index) const
+{
+    const std::vector<double>& chunk_entry_times =
+        chunk_indices.at(chunk_index).entry_times;
+    if (chunk_entry_times.empty())
+    {
+        return std::nullopt;
+    }
+    return chunk_entry_times.front();
+}
+
+double ReplayReader::getEndTime() const
+{
+    return entry_times.empty() ? 0.0 : entry_times.back();
+}
+
+std::vector<double> ReplayReader::getBookmarkTimes() const
+{
+    std::vector<double> bookmark_times;
+    for (const ChunkIndex& chunk_index : chunk_indices)
+    {
+        bookmark_times.insert(bookmark_times.end(), chunk_index.bookmark_times.begin(),
+                              chunk_index.bookmark_times.end());
+    }
+    return bookmark_times;
+}
+
+ReplayReader::ReplayEntryPosition ReplayReader::seek(double time_sec) const
+{
+    if (entry_times.empty())
+    {
+        return ReplayEntryPosition{0, 0};
+    }
+
+    std::size_t entry = static_cast<std::size_t>(
+        std::lower_bound(entry_times.begin(), entry_times.end(), time_sec) -
+        entry_times.begin());
+    entry = std::min(entry, entry_times.size() - 1);
+
+    // Empty chunks start at the same entry as the chunk after them, so the last chunk
+    // starting at or before the entry is the chunk that contains it
+    std::size_t chunk_index =
+        static_cast<std::size_t>(std::upper_bound(chunk_first_entries.begin(),
+                                                  chunk_first_entries.end(), entry) -
+                                 chunk_first_entries.begin()) -
+        1;
+
+    return ReplayEntryPosition{chunk_index, entry - chunk_first_entries[chunk_index]};
+}
+
+std::vector<ReplayReader::ReplayEntry> ReplayReader::readChunk(
+    std::size_t chunk_index) const
+{
+    return readChunkFile(chunk_paths.at(chunk_index));
+}
+
+std::vector<ReplayReader::ReplayEntry> ReplayReader::readChunkFile(
+    const std::string& chunk_path)
+{
+    std::vector<ReplayEntry> entries;
+
+    gzFile gz_file = gzopen(chunk_path.c_str(), "rb");
+    if (gz_file == nullptr)
+    {
+        std::cerr << "ReplayReader: Failed to open replay file: " << chunk_path
+                  << std::endl;
+        return entries;
+    }
+
+    // A chunk that is still being written to may end partway through a gzip block,
+    // in which case everything that could be decompressed is kept
+    std::string chunk_data;
+    std::vector<char> buffer(CHUNK_READ_BUFFER_SIZE_BYTES);
+    int num_bytes_read;
+    while ((num_bytes_read = gzread(gz_file, buffer.data(),
+                                    static_cast<unsigned>(buffer.size()))) > 0)
+    {
+        chunk_data.append(buffer.data(), static_cast<std::size_t>(num_bytes_read));
+    }
+    gzclose(gz_file);
+
+    // Starting version 2, the first line of the chunk contains the replay file
+    // version. Chunks without a version line are version 1.
+    unsigned int version   = 1;
+    std::size_t line_start = 0;
+    if (chunk_data.compare(0, REPLAY_FILE_VERSION_PREFIX.size(),
+                           REPLAY_FILE_VERSION_PREFIX) == 0)
+    {
+        std::size_t line_end = chunk_data.find('\n');
+        if (line_end == std::string::npos)
+        {
+            return entries;
+        }
+        version = static_cast<unsigned int>(
+            std::strtoul(chunk_data.c_str() + REPLAY_FILE_VERSION_PREFIX.size(),
+                         nullptr, 10));
+        line_start = line_end + 1;
+    }
+
+    // The last line is dropped if it was not completely written
+    std::size_t line_end;
+    std::size_t num_corrupt_entries = 0;
+    while ((line_end = chunk_data.find('\n', line_start)) != std::string::npos)
+    {
+        std::optional<ReplayEntry> entry =
+            parseLogEntry(chunk_data.substr(line_start, line_end - line_start), version);
+        if (entry)
+        {
+            entries.push_back(std::move(*entry));
+        }
+        else
+        {
+            ++num_corrupt_entries;
+        }
+        line_start = line_end + 1;
+    }
+
+    if (num_corrupt_entries > 0)
+    {
+        std::cerr << "ReplayReader: Ignored " << num_corrupt_entries
+                  << " corrupted log entries in " << chunk_path << std::endl;
+    }
+
+    return entries;
+}
+
+ReplayReader::ChunkIndex ReplayReader::indexChunk(const std::string& chunk_path)
+{
+    ChunkIndex chunk_index;
+    chunk_index.file_name = std::filesystem::path(chunk_path).filename().string();
+
+    // The size is taken before reading so that a chunk that grows while it is read
+    // is indexed again the next time
+    std::error_code error;
+    chunk_index.file_size = std::filesystem::file_size(chunk_path, error);
+
+    for (const ReplayEntry& entry : readChunkFile(chunk_path))
+    {
+        chunk_index.entry_times.push_back(entry.timestamp_sec);
+        if (entry.protobuf_type_full_name == REPLAY_BOOKMARK_TYPE_NAME)
+        {
+            chunk_index.bookmark_times.push_back(entry.timestamp_sec);
+        }
+    }
+
+    return chunk_index;
+}
+
+std::optional<ReplayReader::ReplayEntry> ReplayReader::parseLogEntry(
+    const std::string& line, unsigned int version)
+{
+    // <time>,<protobuf_type_full_name>,<base64_encoded_serialized_proto>
+    std::size_t type_start = line.find(REPLAY_METADATA_DELIMITER);
+    if (type_start == std::string::npos)
+    {
+        return std::nullopt;
+    }
+    type_start += REPLAY_METADATA_DELIMITER.size();
+
+    std::size_t data_start = line.find(REPLAY_METADATA_DELIMITER, type_start);
+    if (data_start == std::string::npos ||
+        line.find(REPLAY_METADATA_DELIMITER, data_start + 1) != std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    ReplayEntry entry;
+
+    // The whole timestamp must be parsed, ending right before the delimiter
+    const std::size_t timestamp_length = type_start - REPLAY_METADATA_DELIMITER.size();
+    char* timestamp_end                = nullptr;
+    entry.timestamp_sec                = std::strtod(line.c_str(), &timestamp_end);
+    if (timestamp_length == 0 || timestamp_end != line.c_str() + timestamp_length)
+    {
+        return std::nullopt;
+    }
+
+    entry.protobuf_type_full_name = line.substr(type_start, data_start - type_start);
+    if (entry.protobuf_type_full_name.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::string data = line.substr(data_start + REPLAY_METADATA_DELIMITER.size());
+    if (version == 1)
+    {
+        // Version 1 chunks store the base64 data as a Python bytes literal: b'<data>'
+        if (data.size() < 3 || data.compare(0, 2, "b'") != 0 || data.back() != '\'')
+        {
+            return std::nullopt;
+        }
+        data = data.substr(2, data.size() - 3);
+    }
+    else if (version != REPLAY_FILE_VERSION)
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        entry.serialized_proto = base64_decode(data);
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+
+    return entry;
+}
+
+std::vector<bool> ReplayReader::loadIndexFile()
+{
+    std::vector<bool> chunks_loaded(chunk_paths.size(), false);
+
+    const std::filesystem::path index_path =
+        std::filesystem::path(log_folder_path) / REPLAY_INDEX_FILENAME;
+    std::error_code error;
+    const std::uintmax_t index_file_size = std::filesystem::file_size(index_path, error);
+    std::ifstream index_file(index_path, std::ios::binary);
+    if (error || !index_file)
+    {
+        return chunks_loaded;
+    }
+
+    auto read_value = [&index_file](auto& value)
+    {
+        index_file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return static_cast<bool>(index_file);
+    };
+
+    // Sizes are checked against the size of the index file so that a corrupt index
+    // file can't make us allocate more memory than the file could contain
+    auto read_times = [&](std::vector<double>& times)
+    {
+        std::uint64_t num_times;
+        if (!read_value(num_times) || num_times > index_file_size / sizeof(double))
+        {
+            return false;
+        }
+        times.resize(num_times);
+        index_file.read(reinterpret_cast<char*>(times.data()),
+                        static_cast<std::streamsize>(num_times * sizeof(double)));
+        return static_cast<bool>(index_file);
+    };
+
+    std::uint32_t index_file_version;
+    std::uint64_t num_chunks;
+    if (!read_value(index_file_version) ||
+        index_file_version != REPLAY_INDEX_FILE_VERSION || !read_value(num_chunks))
+    {
+        return chunks_loaded;
+    }
+
+    std::map<std::string, std::size_t> chunk_indices_by_file_name;
+    for (std::size_t chunk_index = 0; chunk_index < chunk_paths.size(); ++chunk_index)
+    {
+        chunk_indices_by_file_name[std::filesystem::path(chunk_paths[chunk_index])
+                                       .filename()
+                                       .string()] = chunk_index;
+    }
+
+    for (std::uint64_t i = 0; i < num_chunks; ++i)
+    {
+        ChunkIndex chunk_index;
+        std::uint64_t file_name_length;
+        if (!read_value(file_name_length) || file_name_length > index_file_size)
+        {
+            break;
+        }
+        chunk_index.file_name.resize(file_name_length);
+        index_file.read(chunk_index.file_name.data(),
+                        static_cast<std::streamsize>(file_name_length));
+        if (!index_file || !read_value(chunk_index.file_size) ||
+            !read_times(chunk_index.entry_times) ||
+            !read_times(chunk_index.bookmark_times))
+        {
+            break;
+        }
+
+        auto iter = chunk_indices_by_file_name.find(chunk_index.file_name);
+        if (iter == chunk_indices_by_file_name.end() ||
+            std::filesystem::file_size(chunk_paths[iter->second], error) !=
+                chunk_index.file_size ||
+            error)
+        {
+            continue;
+        }
+
+        chunk_indices[iter->second] = std::move(chunk_index);
+        chunks_loaded[iter->second] = true;
+    }
+
+    return chunks_loaded;
+}
+
+void ReplayReader::indexChunks(const std::vector<std::size_t>& chunks_to_index)
+{
+    // Each thread takes the next chunk that has not been indexed until all chunks
+    // are indexed, since chunks can take very different amounts of time to read
+    const std::size_t num_threads =
+        std::min(chunks_to_index.size(),
+                 static_cast<std::size_t>(
+                     std::max(1u, std::thread::hardware_concurrency())));
+    std::atomic<std::size_t> next_chunk(0);
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                std::size_t chunk;
+                while ((chunk = next_chunk++) < chunks_to_index.size())
+                {
+                    const std::size_t chunk_index = chunks_to_index[chunk];
+                    chunk_indices[chunk_index]    = indexChunk(chunk_paths[chunk_index]);
+                }
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void ReplayReader::saveIndexFile() const
+{
+    // The index is written to a temporary file first so that a reader never loads a
+    // partially written index
+    const std::filesystem::path index_path =
+        std::filesystem::path(log_folder_path) / REPLAY_INDEX_FILENAME;
+    std::filesystem::path temporary_index_path = index_path;
+    temporary_index_path += ".tmp";
+
+    std::ofstream index_file(temporary_index_path, std::ios::binary | std::ios::trunc);
+
+    auto write_value = [&index_file](const auto& value)
+    { index_file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+    auto write_times = [&](const std::vector<double>& times)
+    {
+        write_value(static_cast<std::uint64_t>(times.size()));
+        index_file.write(reinterpret_cast<const char*>(times.data()),
+                         static_cast<std::streamsize>(times.size() * sizeof(double)));
+    };
+
+    write_value(REPLAY_INDEX_FILE_VERSION);
+    write_value(static_cast<std::uint64_t>(chunk_indices.size()));
+    for (const ChunkIndex& chunk_index : chunk_indices)
+    {
+        write_value(static_cast<std::uint64_t>(chunk_index.file_name.size()));
+        index_file.write(chunk_index.file_name.data(),
+                         static_cast<std::streamsize>(chunk_index.file_name.size()));
+        write_value(chunk_index.file_size);
+        write_times(chunk_index.entry_times);
+        write_times(chunk_index.bookmark_times);
+    }
+    index_file.close();
+
+    std::error_code error;
+    if (index_file)
+    {
+        std::filesystem::rename(temporary_index_path, index_path, error);
+    }
+
+    if (!index_file || error)
+    {
+        std::cerr << "ReplayReader: Failed to save replay index for " << log_folder_path
+                  << std::endl;
+        std::filesystem::remove(temporary_index_path, error);
+    }
+}
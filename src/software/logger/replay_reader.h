@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Reads the replay logs written by ProtoLogger.
+ *
+ * When a log folder is opened, the timestamp of every entry in every replay chunk is
+ * read into a time index, which is used to seek to a time with a binary search instead
+ * of decompressing the chunks. The chunks are indexed in parallel, and the index is
+ * saved to REPLAY_INDEX_FILENAME in the log folder so that opening the log again only
+ * indexes the chunks that were added or changed since.
+ *
+ * The entries of a chunk are returned with the protobufs already decoded from base64,
+ * so they can be deserialized directly.
+ */
+class ReplayReader
+{
+   public:
+    /**
+     * An entry in a replay chunk
+     */
+    struct ReplayEntry
+    {
+        double timestamp_sec;
+        std::string protobuf_type_full_name;
+        std::string serialized_proto;
+    };
+
+    /**
+     * The position of an entry in the log, as the index of its chunk and the index of
+     * the entry in the chunk
+     */
+    struct ReplayEntryPosition
+    {
+        std::size_t chunk_index;
+        std::size_t entry_index;
+    };
+
+    /**
+     * Opens a replay log folder, loading the time index from the folder and indexing
+     * the chunks that are missing from it
+     *
+     * @param log_folder_path The path to the folder containing the replay chunks
+     *
+     * @throws std::invalid_argument if there are no replay chunks in the folder
+     */
+    explicit ReplayReader(const std::string& log_folder_path);
+
+    /**
+     * Gets the paths of the replay chunks, in the order they were written
+     *
+     * @return the paths of the replay chunks
+     */
+    const std::vector<std::string>& getChunkPaths() const;
+
+    /**
+     * Gets the number of entries in a replay chunk
+     *
+     * @param chunk_index The index of the chunk
+     *
+     * @return the number of entries in the chunk
+     */
+    std::size_t getNumEntries(std::size_t chunk_index) const;
+
+    /**
+     * Gets the timestamp of the first entry of a replay chunk
+     *
+     * @param chunk_index The index of the chunk
+     *
+     * @return the timestamp of the first entry of the chunk, or std::nullopt if the
+     * chunk has no entries
+     */
+    std::optional<double> getChunkStartTime(std::size_t chunk_index) const;
+
+    /**
+     * Gets the timestamp of the last entry in the log
+     *
+     * @return the timestamp of the last entry in the log, or 0 if the log has no entries
+     */
+    double getEndTime() const;
+
+    /**
+     * Gets the timestamps of the ReplayBookmarks in the log
+     *
+     * @return the timestamps of the bookmarks, in the order they were logged
+     */
+    std::vector<double> getBookmarkTimes() const;
+
+    /**
+     * Finds the first entry logged at or after the given time, assuming the entries were
+     * logged chronologically. This does not read any chunks.
+     *
+     * @param time_sec The time to seek to
+     *
+     * @return the position of the first entry at or after the given time, or of the
+     * last entry if every entry is before the given time
+     */
+    ReplayEntryPosition seek(double time_sec) const;
+
+    /**
+     * Reads the entries of a replay chunk. Corrupt entries are skipped, the same as
+     * when the chunk is indexed.
+     *
+     * @param chunk_index The index of the chunk
+     *
+     * @return the entries of the chunk
+     */
+    std::vector<ReplayEntry> readChunk(std::size_t chunk_index) const;
+
+    /**
+     * Reads the entries of a replay chunk file, skipping corrupt entries
+     *
+     * @param chunk_path The path to the replay chunk
+     *
+     * @return the entries of the chunk
+     */
+    static std::vector<ReplayEntry> readChunkFile(const std::string& chunk_path);
+
+    static constexpr const char* REPLAY_INDEX_FILENAME       = "replay.index";
+    static constexpr std::uint32_t REPLAY_INDEX_FILE_VERSION = 1;
+
+   private:
+    /**
+     * The time index of a replay chunk
+     */
+    struct ChunkIndex
+    {
+        std::string file_name;
+        // The size of the chunk file when it was indexed, used to detect that a chunk
+        // was still being written to
+        std::uint64_t file_size;
+        std::vector<double> entry_times;
+        std::vector<double> bookmark_times;
+    };
+
+    /**
+     * Indexes a replay chunk
+     *
+     * @param chunk_path The path to the replay chunk
+     *
+     * @return the index of the chunk
+     */
+    static ChunkIndex indexChunk(const std::string& chunk_path);
+
+    /**
+     * Parses a line of a replay chunk into an entry
+     *
+     * @param line The line, without the newline
+     * @param version The format version of the replay chunk
+     *
+     * @return the entry, or std::nullopt if the line is corrupt
+     */
+    static std::optional<ReplayEntry> parseLogEntry(const std::string& line,
+                                                    unsigned int version);
+
+    /**
+     * Loads the indices of the chunks from the index file in the log folder, keeping
+     * only the indices of chunks that have not changed since they were indexed
+     *
+     * @return whether the index of each chunk was loaded
+     */
+    std::vector<bool> loadIndexFile();
+
+    /**
+     * Indexes the given chunks in parallel
+     *
+     * @param chunks_to_index The indices of the chunks to index
+     */
+    void indexChunks(const std::vector<std::size_t>& chunks_to_index);
+
+    /**
+     * Saves the indices of the chunks to the index file in the log folder
+     */
+    void saveIndexFile() const;
+
+    std::string log_folder_path;
+    std::vector<std::string> chunk_paths;
+    std::vector<ChunkIndex> chunk_indices;
+
+    // The timestamps of the entries of all chunks, and the index in entry_times of the
+    // first entry of each chunk
+    std::vector<double> entry_times;
+    std::vector<std::size_t> chunk_first_entries;
+
+    static constexpr unsigned int CHUNK_READ_BUFFER_SIZE_BYTES = 64 * 1024;
+
+    static constexpr const char* REPLAY_BOOKMARK_TYPE_NAME = "TbotsProto.ReplayBookmark";
+};
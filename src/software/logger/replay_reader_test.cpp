@@ -0,0 +1,258 @@
+#include "software/logger/replay_reader.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "proto/replay_bookmark.pb.h"
+#include "proto/tbots_timestamp_msg.pb.h"
+#include "shared/constants.h"
+#include "software/logger/proto_logger.h"
+
+class ReplayReaderTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        log_folder = std::filesystem::temp_directory_path() /
+                     ("replay_reader_test_" + std::to_string(getpid()));
+        std::filesystem::remove_all(log_folder);
+        std::filesystem::create_directories(log_folder);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(log_folder);
+    }
+
+    /**
+     * Writes a replay chunk in the format ProtoLogger writes, with a Timestamp proto
+     * logged at each of the given times
+     *
+     * @param chunk_index The index of the chunk
+     * @param times The times to log a proto at
+     * @param extra_lines Lines to write after the entries
+     */
+    void writeChunk(unsigned int chunk_index, const std::vector<double>& times,
+                    const std::string& extra_lines = "")
+    {
+        std::string chunk_data =
+            REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_FILE_VERSION) + "\n";
+        for (double time : times)
+        {
+            chunk_data += ProtoLogger::createLogEntry(
+                TbotsProto::Timestamp::descriptor()->full_name(),
+                createTimestamp(time).SerializeAsString(), time);
+        }
+        chunk_data += extra_lines;
+        writeChunkData(chunk_index, chunk_data);
+    }
+
+    void writeChunkData(unsigned int chunk_index, const std::string& chunk_data)
+    {
+        const std::string chunk_path = (log_folder / (std::to_string(chunk_index) + "." +
+                                                      REPLAY_FILE_EXTENSION))
+                                           .string();
+        gzFile gz_file = gzopen(chunk_path.c_str(), "wb");
+        ASSERT_NE(nullptr, gz_file);
+        gzwrite(gz_file, chunk_data.data(), static_cast<unsigned>(chunk_data.size()));
+        gzclose(gz_file);
+    }
+
+    static TbotsProto::Timestamp createTimestamp(double time)
+    {
+        TbotsProto::Timestamp timestamp;
+        timestamp.set_epoch_timestamp_seconds(time);
+        return timestamp;
+    }
+
+    std::filesystem::path log_folder;
+};
+
+TEST_F(ReplayReaderTest, throws_if_there_are_no_chunks)
+{
+    EXPECT_THROW(ReplayReader reader(log_folder.string()), std::invalid_argument);
+}
+
+TEST_F(ReplayReaderTest, reads_entries_written_by_proto_logger)
+{
+    writeChunk(0, {1.5, 2.5, 3.5});
+
+    ReplayReader reader(log_folder.string());
+    std::vector<ReplayReader::ReplayEntry> entries = reader.readChunk(0);
+
+    ASSERT_EQ(3, entries.size());
+    ASSERT_EQ(3, reader.getNumEntries(0));
+    for (unsigned int i = 0; i < entries.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(1.5 + i, entries[i].timestamp_sec);
+        EXPECT_EQ("TbotsProto.Timestamp", entries[i].protobuf_type_full_name);
+
+        TbotsProto::Timestamp timestamp;
+        ASSERT_TRUE(timestamp.ParseFromString(entries[i].serialized_proto));
+        EXPECT_DOUBLE_EQ(1.5 + i, timestamp.epoch_timestamp_seconds());
+    }
+}
+
+TEST_F(ReplayReaderTest, sorts_chunks_by_chunk_index)
+{
+    writeChunk(10, {10.0});
+    writeChunk(2, {2.0});
+    writeChunk(1, {1.0});
+
+    ReplayReader reader(log_folder.string());
+
+    ASSERT_EQ(3, reader.getChunkPaths().size());
+    EXPECT_EQ("1.replay",
+              std::filesystem::path(reader.getChunkPaths()[0]).filename().string());
+    EXPECT_EQ("2.replay",
+              std::filesystem::path(reader.getChunkPaths()[1]).filename().string());
+    EXPECT_EQ("10.replay",
+              std::filesystem::path(reader.getChunkPaths()[2]).filename().string());
+    EXPECT_DOUBLE_EQ(10.0, reader.getEndTime());
+}
+
+TEST_F(ReplayReaderTest, skips_corrupt_and_incomplete_entries)
+{
+    writeChunk(0, {1.0, 2.0},
+               "3.0TbotsProto.Timestamp,AAAA\n"
+               "abc,TbotsProto.Timestamp,AAAA\n"
+               "4.0,TbotsProto.Timestamp,AA,AA\n" +
+                   ProtoLogger::createLogEntry("TbotsProto.Timestamp", "", 5.0) +
+                   "6.0,TbotsProto.Timestamp,AAAA");
+
+    ReplayReader reader(log_folder.string());
+    std::vector<ReplayReader::ReplayEntry> entries = reader.readChunk(0);
+
+    ASSERT_EQ(3, entries.size());
+    EXPECT_DOUBLE_EQ(1.0, entries[0].timestamp_sec);
+    EXPECT_DOUBLE_EQ(2.0, entries[1].timestamp_sec);
+    EXPECT_DOUBLE_EQ(5.0, entries[2].timestamp_sec);
+    EXPECT_EQ(3, reader.getNumEntries(0));
+    EXPECT_DOUBLE_EQ(5.0, reader.getEndTime());
+}
+
+TEST_F(ReplayReaderTest, reads_version_1_chunks)
+{
+    std::string serialized_proto = createTimestamp(7.0).SerializeAsString();
+    std::string log_entry =
+        ProtoLogger::createLogEntry("TbotsProto.Timestamp", serialized_proto, 7.0);
+    // Version 1 entries wrap the base64 data in a Python bytes literal
+    std::size_t data_start = log_entry.rfind(REPLAY_METADATA_DELIMITER) + 1;
+    std::size_t data_end   = log_entry.size() - 1;
+    writeChunkData(0, log_entry.substr(0, data_start) + "b'" +
+                          log_entry.substr(data_start, data_end - data_start) + "'\n");
+
+    ReplayReader reader(log_folder.string());
+    std::vector<ReplayReader::ReplayEntry> entries = reader.readChunk(0);
+
+    ASSERT_EQ(1, entries.size());
+    EXPECT_DOUBLE_EQ(7.0, entries[0].timestamp_sec);
+    EXPECT_EQ(serialized_proto, entries[0].serialized_proto);
+}
+
+TEST_F(ReplayReaderTest, seek_finds_first_entry_at_or_after_time)
+{
+    writeChunk(0, {0.0, 1.0, 2.0});
+    writeChunk(1, {});
+    writeChunk(2, {3.0, 4.0});
+
+    ReplayReader reader(log_folder.string());
+
+    EXPECT_EQ(std::nullopt, reader.getChunkStartTime(1));
+    EXPECT_EQ(3.0, reader.getChunkStartTime(2));
+
+    auto expect_seek = [&](double time_sec, std::size_t chunk_index,
+                           std::size_t entry_index)
+    {
+        ReplayReader::ReplayEntryPosition position = reader.seek(time_sec);
+        EXPECT_EQ(chunk_index, position.chunk_index) << "at t=" << time_sec;
+        EXPECT_EQ(entry_index, position.entry_index) << "at t=" << time_sec;
+    };
+
+    expect_seek(-1.0, 0, 0);
+    expect_seek(0.0, 0, 0);
+    expect_seek(1.5, 0, 2);
+    expect_seek(2.0, 0, 2);
+    expect_seek(2.5, 2, 0);
+    expect_seek(4.0, 2, 1);
+    expect_seek(100.0, 2, 1);
+}
+
+TEST_F(ReplayReaderTest, indexes_bookmarks)
+{
+    TbotsProto::ReplayBookmark bookmark;
+    writeChunk(0, {1.0},
+               ProtoLogger::createLogEntry("TbotsProto.ReplayBookmark",
+                                           bookmark.SerializeAsString(), 1.5));
+    writeChunk(1, {2.0},
+               ProtoLogger::createLogEntry("TbotsProto.ReplayBookmark",
+                                           bookmark.SerializeAsString(), 2.5));
+
+    ReplayReader reader(log_folder.string());
+
+    EXPECT_EQ(std::vector<double>({1.5, 2.5}), reader.getBookmarkTimes());
+}
+
+TEST_F(ReplayReaderTest, saves_and_reuses_index)
+{
+    writeChunk(0, {0.0, 1.0});
+    writeChunk(1, {2.0, 3.0});
+
+    {
+        ReplayReader reader(log_folder.string());
+    }
+    ASSERT_TRUE(
+        std::filesystem::exists(log_folder / ReplayReader::REPLAY_INDEX_FILENAME));
+
+    // Overwrite a chunk with zeros without changing the size of its file, so the
+    // chunk only has entries if its saved index is used instead of reading it
+    std::filesystem::path chunk_path = log_folder / "0.replay";
+    std::uintmax_t chunk_file_size   = std::filesystem::file_size(chunk_path);
+    std::filesystem::resize_file(chunk_path, 0);
+    std::filesystem::resize_file(chunk_path, chunk_file_size);
+
+    ReplayReader reader(log_folder.string());
+
+    EXPECT_EQ(2, reader.getNumEntries(0));
+    EXPECT_EQ(0.0, reader.getChunkStartTime(0));
+    EXPECT_EQ(2.0, reader.getChunkStartTime(1));
+    EXPECT_DOUBLE_EQ(3.0, reader.getEndTime());
+}
+
+TEST_F(ReplayReaderTest, indexes_chunks_that_changed_since_index_was_saved)
+{
+    writeChunk(0, {0.0, 1.0});
+    writeChunk(1, {2.0});
+
+    {
+        ReplayReader reader(log_folder.string());
+        EXPECT_DOUBLE_EQ(2.0, reader.getEndTime());
+    }
+
+    // The last chunk of a log that is still being written grows, and new chunks are
+    // added
+    writeChunk(1, {2.0, 3.0, 4.0, 5.0});
+    writeChunk(2, {6.0});
+
+    ReplayReader reader(log_folder.string());
+
+    EXPECT_EQ(2, reader.getNumEntries(0));
+    EXPECT_EQ(4, reader.getNumEntries(1));
+    EXPECT_EQ(1, reader.getNumEntries(2));
+    EXPECT_DOUBLE_EQ(6.0, reader.getEndTime());
+}
+
+TEST_F(ReplayReaderTest, ignores_corrupt_index_file)
+{
+    writeChunk(0, {0.0, 1.0});
+    std::ofstream(log_folder / ReplayReader::REPLAY_INDEX_FILENAME) << "not an index";
+
+    ReplayReader reader(log_folder.string());
+
+    EXPECT_EQ(2, reader.getNumEntries(0));
+    EXPECT_DOUBLE_EQ(1.0, reader.getEndTime());
+}
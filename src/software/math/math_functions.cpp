@@ -60,3 +60,22 @@ double percent_difference(double a, double b)
     }
     return std::abs(a - b) / ((std::abs(a) + std::abs(b)) / 2);
 }
+
+double radicalInverse(unsigned int index, unsigned int base)
+{
+    double result       = 0;
+    double digit_weight = 1.0 / base;
+    while (index > 0)
+    {
+        result += digit_weight * (index % base);
+        index /= base;
+        digit_weight /= base;
+    }
+    return result;
+}
+
+Point haltonPoint(const Rectangle& rectangle, unsigned int index)
+{
+    return Point(rectangle.xMin() + radicalInverse(index, 2) * rectangle.xLength(),
+                 rectangle.yMin() + radicalInverse(index, 3) * rectangle.yLength());
+}
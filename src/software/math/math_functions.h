@@ -104,3 +104,28 @@ T normalizeValueToRange(T value, const T& value_min, const T& value_max,
  * @return The percent difference between the two values
  */
 double percent_difference(double a, double b);
+
+/**
+ * Calculates the radical inverse of an index in the given base, which mirrors the
+ * digits of the index in the base around the radix point. The radical inverses of
+ * consecutive indices form a van der Corput sequence, which covers [0, 1) more evenly
+ * than uniformly random values do.
+ *
+ * @param index The index in the sequence
+ * @param base The base of the sequence. Must be at least 2
+ *
+ * @return The radical inverse of the index, in [0, 1)
+ */
+double radicalInverse(unsigned int index, unsigned int base);
+
+/**
+ * Gets a point of the 2D Halton sequence, with bases 2 and 3, scaled to the given
+ * rectangle. Points with consecutive indices are a low-discrepancy sample of the
+ * rectangle, so any number of them covers it evenly.
+ *
+ * @param rectangle The rectangle to sample
+ * @param index The index in the sequence
+ *
+ * @return The point of the Halton sequence with the given index in the rectangle
+ */
+Point haltonPoint(const Rectangle& rectangle, unsigned int index);
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 TEST(LinearUtilFunctionTest, testZeroCase)
 {
     double out = linear(0, 0, 2);
@@ -284,3 +286,49 @@ TEST(PercentDifferenceTest, test_same_negative_numbers)
     double result = percent_difference(-3, -3);
     EXPECT_EQ(result, 0);
 }
+
+TEST(RadicalInverseTest, test_base_2)
+{
+    EXPECT_DOUBLE_EQ(0.0, radicalInverse(0, 2));
+    EXPECT_DOUBLE_EQ(0.5, radicalInverse(1, 2));
+    EXPECT_DOUBLE_EQ(0.25, radicalInverse(2, 2));
+    EXPECT_DOUBLE_EQ(0.75, radicalInverse(3, 2));
+    EXPECT_DOUBLE_EQ(0.125, radicalInverse(4, 2));
+}
+
+TEST(RadicalInverseTest, test_base_3)
+{
+    EXPECT_DOUBLE_EQ(1.0 / 3, radicalInverse(1, 3));
+    EXPECT_DOUBLE_EQ(2.0 / 3, radicalInverse(2, 3));
+    EXPECT_DOUBLE_EQ(1.0 / 9, radicalInverse(3, 3));
+    EXPECT_DOUBLE_EQ(4.0 / 9, radicalInverse(4, 3));
+}
+
+TEST(HaltonPointTest, test_points_are_in_rectangle)
+{
+    Rectangle rectangle(Point(-1, 2), Point(3, 5));
+    for (unsigned int i = 0; i < 100; i++)
+    {
+        Point point = haltonPoint(rectangle, i);
+        EXPECT_GE(point.x(), -1);
+        EXPECT_LT(point.x(), 3);
+        EXPECT_GE(point.y(), 2);
+        EXPECT_LT(point.y(), 5);
+    }
+}
+
+TEST(HaltonPointTest, test_points_cover_every_quadrant)
+{
+    Rectangle rectangle(Point(0, 0), Point(2, 2));
+    std::array<int, 4> num_points_in_quadrant = {0, 0, 0, 0};
+    for (unsigned int i = 1; i <= 8; i++)
+    {
+        Point point = haltonPoint(rectangle, i);
+        num_points_in_quadrant[(point.x() >= 1 ? 1 : 0) + (point.y() >= 1 ? 2 : 0)]++;
+    }
+
+    for (int num_points : num_points_in_quadrant)
+    {
+        EXPECT_EQ(2, num_points);
+    }
+}
@@ -0,0 +1,31 @@
+#include "software/metrics/latency_trace.h"
+
+#include <time.h>
+
+#include <chrono>
+
+#include "shared/constants.h"
+
+double getLatencyTraceTimeSeconds()
+{
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+    return static_cast<double>(current_time.tv_sec) +
+           static_cast<double>(current_time.tv_nsec) / NANOSECONDS_PER_SECOND;
+}
+
+TbotsProto::LatencyTrace createLatencyTrace(
+    const SSLProto::SSL_DetectionFrame& detection_frame, double vision_received_s)
+{
+    TbotsProto::LatencyTrace latency_trace;
+    latency_trace.set_frame_id(
+        (static_cast<uint64_t>(detection_frame.camera_id()) << 32) |
+        static_cast<uint64_t>(detection_frame.frame_number()));
+    latency_trace.set_t_capture_epoch_s(detection_frame.t_capture());
+    latency_trace.set_vision_received_epoch_s(
+        std::chrono::duration<double>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    latency_trace.set_vision_received_s(vision_received_s);
+    return latency_trace;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "proto/latency_trace.pb.h"
+#include "proto/ssl_vision_detection.pb.h"
+
+/**
+ * Gets the current time of the monotonic clock that latency traces are timestamped
+ * with. This is CLOCK_MONOTONIC, which is shared by every process on a computer
+ *
+ * @return the current time of the monotonic clock, in seconds
+ */
+double getLatencyTraceTimeSeconds();
+
+/**
+ * Starts the latency trace of a vision frame that was just received by the AI computer
+ *
+ * @param detection_frame The vision frame
+ * @param vision_received_s The time the frame was received, from
+ * getLatencyTraceTimeSeconds
+ *
+ * @return the latency trace of the vision frame
+ */
+TbotsProto::LatencyTrace createLatencyTrace(
+    const SSLProto::SSL_DetectionFrame& detection_frame, double vision_received_s);
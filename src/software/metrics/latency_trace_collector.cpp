@@ -0,0 +1,81 @@
+#include "software/metrics/latency_trace_collector.h"
+
+#include "shared/constants.h"
+
+LatencyTraceCollector::LatencyTraceCollector(bool loopback, MetricsRegistry& registry)
+    : loopback(loopback),
+      capture_to_receive(registry.getHistogram("latency.capture_to_receive_ns")),
+      sensor_fusion(registry.getHistogram("latency.sensor_fusion_ns")),
+      sensor_fusion_to_ai_tick(
+          registry.getHistogram("latency.sensor_fusion_to_ai_tick_ns")),
+      ai_tick(registry.getHistogram("latency.ai_tick_ns")),
+      ai_tick_to_send(registry.getHistogram("latency.ai_tick_to_send_ns")),
+      send_to_robot(registry.getHistogram("latency.send_to_robot_ns")),
+      robot_receive_to_step(registry.getHistogram("latency.robot_receive_to_step_ns")),
+      receive_to_actuation(registry.getHistogram("latency.receive_to_actuation_ns"))
+{
+}
+
+void LatencyTraceCollector::addRobotStatus(const TbotsProto::RobotStatus& robot_status,
+                                           double robot_status_received_s)
+{
+    if (!robot_status.has_latency_trace())
+    {
+        return;
+    }
+
+    const TbotsProto::LatencyTrace& trace = robot_status.latency_trace();
+    if (trace.robot_primitive_stepped_s() == 0 || trace.primitive_set_sent_s() == 0)
+    {
+        return;
+    }
+
+    // Robots echo the same trace in every status until they step a new primitive
+    auto last_recorded_frame_id = last_recorded_frame_ids.find(robot_status.robot_id());
+    if (last_recorded_frame_id != last_recorded_frame_ids.end() &&
+        last_recorded_frame_id->second == trace.frame_id())
+    {
+        return;
+    }
+    last_recorded_frame_ids[robot_status.robot_id()] = trace.frame_id();
+
+    double send_to_robot_s;
+    if (loopback)
+    {
+        send_to_robot_s =
+            trace.robot_primitive_received_s() - trace.primitive_set_sent_s();
+    }
+    else
+    {
+        const double round_trip_s =
+            robot_status_received_s - trace.primitive_set_sent_s();
+        const double time_on_robot_s =
+            trace.robot_status_sent_s() - trace.robot_primitive_received_s();
+        send_to_robot_s = (round_trip_s - time_on_robot_s) / 2;
+    }
+    const double robot_receive_to_step_s =
+        trace.robot_primitive_stepped_s() - trace.robot_primitive_received_s();
+
+    // Simulated vision frames are captured in simulation time instead of epoch time
+    if (!loopback)
+    {
+        recordLatency(capture_to_receive,
+                      trace.vision_received_epoch_s() - trace.t_capture_epoch_s());
+    }
+    recordLatency(sensor_fusion,
+                  trace.sensor_fusion_done_s() - trace.vision_received_s());
+    recordLatency(sensor_fusion_to_ai_tick,
+                  trace.ai_tick_start_s() - trace.sensor_fusion_done_s());
+    recordLatency(ai_tick, trace.ai_tick_done_s() - trace.ai_tick_start_s());
+    recordLatency(ai_tick_to_send, trace.primitive_set_sent_s() - trace.ai_tick_done_s());
+    recordLatency(send_to_robot, send_to_robot_s);
+    recordLatency(robot_receive_to_step, robot_receive_to_step_s);
+    recordLatency(receive_to_actuation, trace.primitive_set_sent_s() -
+                                            trace.vision_received_s() +
+                                            send_to_robot_s + robot_receive_to_step_s);
+}
+
+void LatencyTraceCollector::recordLatency(MetricsHistogram& histogram, double latency_s)
+{
+    histogram.record(static_cast<int64_t>(latency_s * NANOSECONDS_PER_SECOND));
+}
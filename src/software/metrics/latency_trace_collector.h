@@ -0,0 +1,75 @@
+#pragma once
+
+#include <map>
+
+#include "proto/robot_status_msg.pb.h"
+#include "software/metrics/metrics_registry.h"
+
+/**
+ * Records the latency of each hop between a camera capturing a vision frame and a
+ * robot stepping the primitive computed from it, from the latency traces robots echo
+ * back in their RobotStatus messages. Each hop is recorded into a histogram, in
+ * nanoseconds, named "latency.<hop>_ns":
+ *  - capture_to_receive: from the camera capture to the AI computer receiving the
+ *    frame, using the epoch clocks of the vision and AI computers
+ *  - sensor_fusion: processing the frame in SensorFusion
+ *  - sensor_fusion_to_ai_tick: waiting for the AI to tick on the new World
+ *  - ai_tick: ticking the AI
+ *  - ai_tick_to_send: from the end of the AI tick to sending the primitives
+ *  - send_to_robot: from sending the primitives to the robot receiving them
+ *  - robot_receive_to_step: from the robot receiving its primitive to stepping it
+ *  - receive_to_actuation: from the AI computer receiving the frame to the robot
+ *    stepping the primitive
+ *
+ * The AI computer and the robots have different monotonic clocks, so send_to_robot is
+ * estimated as half of the round trip to the robot and back, excluding the time spent
+ * on the robot. In loopback mode, the robots run on the AI computer (e.g. in the
+ * simulator), so every hop is measured with the same clock instead.
+ */
+class LatencyTraceCollector
+{
+   public:
+    /**
+     * Creates a new LatencyTraceCollector
+     *
+     * @param loopback Whether the robots run on the same computer as the AI
+     * @param registry The registry to record the latency histograms into
+     */
+    explicit LatencyTraceCollector(bool loopback,
+                                   MetricsRegistry& registry = MetricsRegistry::global());
+
+    /**
+     * Records the latencies of the trace echoed back in a robot status. Each trace is
+     * only recorded once per robot, and traces of primitives the robot has not stepped
+     * yet are ignored
+     *
+     * @param robot_status The robot status
+     * @param robot_status_received_s The time the robot status was received, from
+     * getLatencyTraceTimeSeconds
+     */
+    void addRobotStatus(const TbotsProto::RobotStatus& robot_status,
+                        double robot_status_received_s);
+
+   private:
+    /**
+     * Records a latency into a histogram
+     *
+     * @param histogram The histogram to record into
+     * @param latency_s The latency, in seconds
+     */
+    static void recordLatency(MetricsHistogram& histogram, double latency_s);
+
+    const bool loopback;
+
+    MetricsHistogram& capture_to_receive;
+    MetricsHistogram& sensor_fusion;
+    MetricsHistogram& sensor_fusion_to_ai_tick;
+    MetricsHistogram& ai_tick;
+    MetricsHistogram& ai_tick_to_send;
+    MetricsHistogram& send_to_robot;
+    MetricsHistogram& robot_receive_to_step;
+    MetricsHistogram& receive_to_actuation;
+
+    // The frame id of the last trace recorded for each robot
+    std::map<unsigned int, uint64_t> last_recorded_frame_ids;
+};
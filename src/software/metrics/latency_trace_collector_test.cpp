@@ -0,0 +1,104 @@
+#include "software/metrics/latency_trace_collector.h"
+
+#include <gtest/gtest.h>
+
+class LatencyTraceCollectorTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates a robot status echoing a trace whose hops take 4, 1, 2, 5, 1, 2 and 1
+     * milliseconds, with the robot's clock offset from the AI computer's clock
+     */
+    static TbotsProto::RobotStatus createRobotStatus(unsigned int robot_id,
+                                                     uint64_t frame_id,
+                                                     double robot_clock_offset_s)
+    {
+        TbotsProto::RobotStatus robot_status;
+        robot_status.set_robot_id(robot_id);
+
+        TbotsProto::LatencyTrace& trace = *robot_status.mutable_latency_trace();
+        trace.set_frame_id(frame_id);
+        trace.set_t_capture_epoch_s(1000.0);
+        trace.set_vision_received_epoch_s(1000.004);
+        trace.set_vision_received_s(10.0);
+        trace.set_sensor_fusion_done_s(10.001);
+        trace.set_ai_tick_start_s(10.003);
+        trace.set_ai_tick_done_s(10.008);
+        trace.set_primitive_set_sent_s(10.009);
+        trace.set_robot_primitive_received_s(10.011 + robot_clock_offset_s);
+        trace.set_robot_primitive_stepped_s(10.012 + robot_clock_offset_s);
+        trace.set_robot_status_sent_s(10.013 + robot_clock_offset_s);
+        return robot_status;
+    }
+
+    static void expectLatencyMs(MetricsRegistry& registry, const std::string& name,
+                                double expected_latency_ms)
+    {
+        MetricsHistogram& histogram = registry.getHistogram("latency." + name + "_ns");
+        ASSERT_EQ(1, histogram.getNumSamples()) << name;
+        EXPECT_NEAR(expected_latency_ms * 1e6, histogram.getMean(), 1e3) << name;
+    }
+};
+
+TEST_F(LatencyTraceCollectorTest, records_every_hop_in_loopback_mode)
+{
+    MetricsRegistry registry;
+    LatencyTraceCollector collector(true, registry);
+
+    collector.addRobotStatus(createRobotStatus(1, 5, 0.0), 10.015);
+
+    EXPECT_EQ(0, registry.getHistogram("latency.capture_to_receive_ns").getNumSamples());
+    expectLatencyMs(registry, "sensor_fusion", 1);
+    expectLatencyMs(registry, "sensor_fusion_to_ai_tick", 2);
+    expectLatencyMs(registry, "ai_tick", 5);
+    expectLatencyMs(registry, "ai_tick_to_send", 1);
+    expectLatencyMs(registry, "send_to_robot", 2);
+    expectLatencyMs(registry, "robot_receive_to_step", 1);
+    expectLatencyMs(registry, "receive_to_actuation", 12);
+}
+
+TEST_F(LatencyTraceCollectorTest, estimates_send_to_robot_from_round_trip)
+{
+    MetricsRegistry registry;
+    LatencyTraceCollector collector(false, registry);
+
+    // The robot's clock is unrelated to the AI computer's clock. The status takes as
+    // long to come back as the primitive took to get to the robot
+    collector.addRobotStatus(createRobotStatus(1, 5, 1234.0), 10.015);
+
+    expectLatencyMs(registry, "capture_to_receive", 4);
+    expectLatencyMs(registry, "send_to_robot", 2);
+    expectLatencyMs(registry, "robot_receive_to_step", 1);
+    expectLatencyMs(registry, "receive_to_actuation", 12);
+}
+
+TEST_F(LatencyTraceCollectorTest, records_each_trace_once_per_robot)
+{
+    MetricsRegistry registry;
+    LatencyTraceCollector collector(true, registry);
+    MetricsHistogram& ai_tick = registry.getHistogram("latency.ai_tick_ns");
+
+    collector.addRobotStatus(createRobotStatus(1, 5, 0.0), 10.015);
+    collector.addRobotStatus(createRobotStatus(1, 5, 0.0), 10.025);
+    EXPECT_EQ(1, ai_tick.getNumSamples());
+
+    collector.addRobotStatus(createRobotStatus(2, 5, 0.0), 10.015);
+    collector.addRobotStatus(createRobotStatus(1, 6, 0.0), 10.035);
+    EXPECT_EQ(3, ai_tick.getNumSamples());
+}
+
+TEST_F(LatencyTraceCollectorTest, ignores_statuses_without_stepped_trace)
+{
+    MetricsRegistry registry;
+    LatencyTraceCollector collector(true, registry);
+
+    TbotsProto::RobotStatus robot_status;
+    robot_status.set_robot_id(1);
+    collector.addRobotStatus(robot_status, 10.0);
+
+    robot_status = createRobotStatus(1, 5, 0.0);
+    robot_status.mutable_latency_trace()->clear_robot_primitive_stepped_s();
+    collector.addRobotStatus(robot_status, 10.0);
+
+    EXPECT_EQ(0, registry.getHistogram("latency.ai_tick_ns").getNumSamples());
+}
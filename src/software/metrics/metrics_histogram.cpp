@@ -0,0 +1,138 @@
+#include "software/metrics/metrics_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/logger/logger.h"
+
+MetricsHistogram::MetricsHistogram() : num_samples_(0), total_(0), max_(0)
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricsHistogram::record(int64_t value)
+{
+    const uint64_t sample = static_cast<uint64_t>(std::max<int64_t>(value, 0));
+
+    buckets_[getBucketIndex(sample)].fetch_add(1, std::memory_order_relaxed);
+    num_samples_.fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(sample, std::memory_order_relaxed);
+
+    uint64_t max = max_.load(std::memory_order_relaxed);
+    while (sample > max &&
+           !max_.compare_exchange_weak(max, sample, std::memory_order_relaxed))
+    {
+    }
+}
+
+void MetricsHistogram::reset()
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    num_samples_.store(0, std::memory_order_relaxed);
+    total_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t MetricsHistogram::getNumSamples() const
+{
+    return num_samples_.load(std::memory_order_relaxed);
+}
+
+uint64_t MetricsHistogram::getMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+double MetricsHistogram::getMean() const
+{
+    uint64_t num_samples = getNumSamples();
+    if (num_samples == 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(total_.load(std::memory_order_relaxed)) /
+           static_cast<double>(num_samples);
+}
+
+uint64_t MetricsHistogram::getValueAtPercentile(double percentile) const
+{
+    CHECK(percentile >= 0.0 && percentile <= 100.0)
+        << "Percentile must be in the range [0, 100], got " << percentile;
+
+    // Sum the buckets instead of using num_samples_, which may be out of sync with
+    // the buckets while values are being recorded
+    uint64_t num_samples = 0;
+    for (const auto& bucket : buckets_)
+    {
+        num_samples += bucket.load(std::memory_order_relaxed);
+    }
+    if (num_samples == 0)
+    {
+        return 0;
+    }
+
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(
+               std::ceil(percentile / 100.0 * static_cast<double>(num_samples))));
+
+    uint64_t num_samples_seen = 0;
+    for (std::size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        num_samples_seen += buckets_[i].load(std::memory_order_relaxed);
+        if (num_samples_seen >= rank)
+        {
+            uint64_t bucket_max = (i + 1 < NUM_BUCKETS) ? getBucketLowerBound(i + 1) - 1
+                                                         : MAX_TRACKABLE_VALUE;
+            return std::min(bucket_max, getMax());
+        }
+    }
+    return getMax();
+}
+
+uint64_t MetricsHistogram::getBucketCount(std::size_t bucket_index) const
+{
+    CHECK(bucket_index < NUM_BUCKETS)
+        << "Bucket index " << bucket_index << " is out of range";
+    return buckets_[bucket_index].load(std::memory_order_relaxed);
+}
+
+uint64_t MetricsHistogram::getBucketLowerBound(std::size_t bucket_index)
+{
+    CHECK(bucket_index < NUM_BUCKETS)
+        << "Bucket index " << bucket_index << " is out of range";
+
+    if (bucket_index < SUB_BUCKET_COUNT)
+    {
+        return bucket_index;
+    }
+
+    // Each power of two range after the first SUB_BUCKET_COUNT values is split into
+    // SUB_BUCKET_COUNT buckets that are 2^shift wide
+    const uint64_t shift      = bucket_index / SUB_BUCKET_COUNT - 1;
+    const uint64_t sub_bucket = bucket_index % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + sub_bucket) << shift;
+}
+
+std::size_t MetricsHistogram::getBucketIndex(uint64_t value)
+{
+    if (value >= MAX_TRACKABLE_VALUE)
+    {
+        return NUM_BUCKETS - 1;
+    }
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return static_cast<std::size_t>(value);
+    }
+
+    // The position of the highest set bit, at least SUB_BUCKET_BITS
+    const unsigned int magnitude = 63 - static_cast<unsigned int>(__builtin_clzll(value));
+    const unsigned int shift     = magnitude - SUB_BUCKET_BITS;
+    const uint64_t sub_bucket    = (value >> shift) - SUB_BUCKET_COUNT;
+    return static_cast<std::size_t>((shift + 1) * SUB_BUCKET_COUNT + sub_bucket);
+}
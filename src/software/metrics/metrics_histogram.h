@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A histogram of non-negative integer values (typically latencies in nanoseconds)
+ * that can be recorded to from any number of threads without locking.
+ *
+ * Buckets are laid out like an HDR histogram: values below SUB_BUCKET_COUNT each get
+ * their own bucket, and every following power of two range is split into
+ * SUB_BUCKET_COUNT equally sized buckets. Every bucket is therefore at most
+ * 1 / SUB_BUCKET_COUNT of the values it holds wide, which bounds the relative error of
+ * the reported percentiles regardless of the magnitude of the values. Values of
+ * MAX_TRACKABLE_VALUE and above are all recorded in the last bucket.
+ *
+ * All storage is inline and recording a value is a handful of relaxed atomic
+ * operations, so histograms can be recorded to from real-time loops.
+ */
+class MetricsHistogram
+{
+   public:
+    static constexpr unsigned int SUB_BUCKET_BITS = 4;
+    static constexpr uint64_t SUB_BUCKET_COUNT    = 1ull << SUB_BUCKET_BITS;
+    // Values are tracked up to 2^40 (about 18 minutes in nanoseconds)
+    static constexpr unsigned int MAX_VALUE_BITS  = 40;
+    static constexpr uint64_t MAX_TRACKABLE_VALUE = 1ull << MAX_VALUE_BITS;
+
+    static constexpr std::size_t NUM_BUCKETS =
+        (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    MetricsHistogram();
+
+    /**
+     * Records a value
+     *
+     * @param value the value to record, negative values are treated as 0
+     */
+    void record(int64_t value);
+
+    /**
+     * Clears all recorded values
+     *
+     * @note Values recorded while the histogram is being reset may be partially
+     * cleared
+     */
+    void reset();
+
+    /**
+     * Gets the number of values recorded
+     *
+     * @return the number of values recorded
+     */
+    uint64_t getNumSamples() const;
+
+    /**
+     * Gets the largest value recorded
+     *
+     * @return the largest value recorded, or 0 if no values were recorded
+     */
+    uint64_t getMax() const;
+
+    /**
+     * Gets the mean of all recorded values
+     *
+     * @return the mean of the recorded values, or 0 if no values were recorded
+     */
+    double getMean() const;
+
+    /**
+     * Gets the value at the given percentile of the recorded values. The value is the
+     * largest value that falls in the same bucket as the percentile, so it is never
+     * smaller than the exact percentile and at most one bucket width larger.
+     *
+     * @param percentile the percentile to get, in the range [0, 100]
+     *
+     * @return the value at the percentile, or 0 if no values were recorded
+     */
+    uint64_t getValueAtPercentile(double percentile) const;
+
+    /**
+     * Gets the number of values recorded in the given bucket
+     *
+     * @param bucket_index the index of the bucket, must be less than NUM_BUCKETS
+     *
+     * @return the number of values in the bucket
+     */
+    uint64_t getBucketCount(std::size_t bucket_index) const;
+
+    /**
+     * Gets the inclusive lower bound of the values in the given bucket
+     *
+     * @param bucket_index the index of the bucket, must be less than NUM_BUCKETS
+     *
+     * @return the smallest value in the bucket
+     */
+    static uint64_t getBucketLowerBound(std::size_t bucket_index);
+
+    /**
+     * Gets the index of the bucket that the given value is recorded in
+     *
+     * @param value the value
+     *
+     * @return the index of the bucket holding the value
+     */
+    static std::size_t getBucketIndex(uint64_t value);
+
+   private:
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_;
+    std::atomic<uint64_t> num_samples_;
+    std::atomic<uint64_t> total_;
+    std::atomic<uint64_t> max_;
+};
@@ -0,0 +1,120 @@
+#include "software/metrics/metrics_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(MetricsHistogramTest, empty_histogram)
+{
+    MetricsHistogram histogram;
+
+    EXPECT_EQ(0, histogram.getNumSamples());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_DOUBLE_EQ(0.0, histogram.getMean());
+    EXPECT_EQ(0, histogram.getValueAtPercentile(50.0));
+}
+
+TEST(MetricsHistogramTest, small_values_are_exact)
+{
+    MetricsHistogram histogram;
+    for (int64_t value = 0; value < 10; value++)
+    {
+        histogram.record(value);
+    }
+
+    EXPECT_EQ(10, histogram.getNumSamples());
+    EXPECT_EQ(9, histogram.getMax());
+    EXPECT_DOUBLE_EQ(4.5, histogram.getMean());
+    EXPECT_EQ(0, histogram.getValueAtPercentile(0.0));
+    EXPECT_EQ(4, histogram.getValueAtPercentile(50.0));
+    EXPECT_EQ(9, histogram.getValueAtPercentile(99.0));
+    EXPECT_EQ(9, histogram.getValueAtPercentile(100.0));
+}
+
+TEST(MetricsHistogramTest, negative_values_are_recorded_as_zero)
+{
+    MetricsHistogram histogram;
+    histogram.record(-100);
+
+    EXPECT_EQ(1, histogram.getBucketCount(0));
+    EXPECT_EQ(0, histogram.getMax());
+}
+
+TEST(MetricsHistogramTest, bucket_lower_bounds_match_bucket_indices)
+{
+    for (std::size_t i = 0; i < MetricsHistogram::NUM_BUCKETS; i++)
+    {
+        uint64_t lower_bound = MetricsHistogram::getBucketLowerBound(i);
+        EXPECT_EQ(i, MetricsHistogram::getBucketIndex(lower_bound));
+        if (i > 0)
+        {
+            EXPECT_EQ(i - 1, MetricsHistogram::getBucketIndex(lower_bound - 1));
+        }
+    }
+}
+
+TEST(MetricsHistogramTest, values_past_max_trackable_value_are_in_last_bucket)
+{
+    EXPECT_EQ(MetricsHistogram::NUM_BUCKETS - 1,
+              MetricsHistogram::getBucketIndex(MetricsHistogram::MAX_TRACKABLE_VALUE));
+    EXPECT_EQ(MetricsHistogram::NUM_BUCKETS - 1,
+              MetricsHistogram::getBucketIndex(UINT64_MAX));
+}
+
+TEST(MetricsHistogramTest, percentiles_within_bucket_precision)
+{
+    MetricsHistogram histogram;
+    // 1 to 100000 microseconds, in nanoseconds
+    for (int64_t value = 1; value <= 100000; value++)
+    {
+        histogram.record(value * 1000);
+    }
+
+    const double max_relative_error = 1.0 / MetricsHistogram::SUB_BUCKET_COUNT;
+    for (double percentile : {50.0, 99.0, 99.9})
+    {
+        double expected = percentile / 100.0 * 100000 * 1000;
+        auto value      = static_cast<double>(histogram.getValueAtPercentile(percentile));
+        EXPECT_GE(value, expected) << "at p" << percentile;
+        EXPECT_LE(value, expected * (1 + max_relative_error)) << "at p" << percentile;
+    }
+    EXPECT_EQ(100000 * 1000, histogram.getValueAtPercentile(100.0));
+}
+
+TEST(MetricsHistogramTest, reset)
+{
+    MetricsHistogram histogram;
+    histogram.record(123456);
+    histogram.reset();
+
+    EXPECT_EQ(0, histogram.getNumSamples());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0, histogram.getBucketCount(MetricsHistogram::getBucketIndex(123456)));
+}
+
+TEST(MetricsHistogramTest, record_from_multiple_threads)
+{
+    MetricsHistogram histogram;
+    const int num_threads        = 4;
+    const int samples_per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++)
+    {
+        threads.emplace_back(
+            [&histogram, i]()
+            {
+                for (int j = 0; j < samples_per_thread; j++)
+                {
+                    histogram.record(i * samples_per_thread + j);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(num_threads * samples_per_thread, histogram.getNumSamples());
+    EXPECT_EQ(num_threads * samples_per_thread - 1, histogram.getMax());
+}
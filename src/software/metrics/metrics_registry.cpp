@@ -0,0 +1,121 @@
+#include "software/metrics/metrics_registry.h"
+
+#include <chrono>
+
+MetricsCounter::MetricsCounter() : value_(0) {}
+
+void MetricsCounter::increment(uint64_t amount)
+{
+    value_.fetch_add(amount, std::memory_order_relaxed);
+}
+
+uint64_t MetricsCounter::getValue() const
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+MetricsGauge::MetricsGauge() : value_(0.0) {}
+
+void MetricsGauge::set(double value)
+{
+    value_.store(value, std::memory_order_relaxed);
+}
+
+double MetricsGauge::getValue() const
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+MetricsRegistry& MetricsRegistry::global()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+/**
+ * Gets the metric with the given name from the map, creating it if it does not exist
+ *
+ * @param metrics the map of metrics to look in
+ * @param name the name of the metric
+ *
+ * @return the metric with the given name
+ */
+template <typename MetricType>
+static MetricType& getOrCreateMetric(
+    std::map<std::string, std::unique_ptr<MetricType>>& metrics, const std::string& name)
+{
+    auto iter = metrics.find(name);
+    if (iter == metrics.end())
+    {
+        iter = metrics.emplace(name, std::make_unique<MetricType>()).first;
+    }
+    return *iter->second;
+}
+
+MetricsCounter& MetricsRegistry::getCounter(const std::string& name)
+{
+    std::scoped_lock lock(metrics_mutex);
+    return getOrCreateMetric(counters, name);
+}
+
+MetricsGauge& MetricsRegistry::getGauge(const std::string& name)
+{
+    std::scoped_lock lock(metrics_mutex);
+    return getOrCreateMetric(gauges, name);
+}
+
+MetricsHistogram& MetricsRegistry::getHistogram(const std::string& name)
+{
+    std::scoped_lock lock(metrics_mutex);
+    return getOrCreateMetric(histograms, name);
+}
+
+std::unique_ptr<TbotsProto::MetricsSnapshot> MetricsRegistry::createMetricsSnapshot()
+    const
+{
+    auto snapshot = std::make_unique<TbotsProto::MetricsSnapshot>();
+    snapshot->mutable_time_sent()->set_epoch_timestamp_seconds(
+        std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+
+    std::scoped_lock lock(metrics_mutex);
+
+    for (const auto& [name, counter] : counters)
+    {
+        TbotsProto::CounterMetric* counter_msg = snapshot->add_counters();
+        counter_msg->set_name(name);
+        counter_msg->set_value(counter->getValue());
+    }
+
+    for (const auto& [name, gauge] : gauges)
+    {
+        TbotsProto::GaugeMetric* gauge_msg = snapshot->add_gauges();
+        gauge_msg->set_name(name);
+        gauge_msg->set_value(gauge->getValue());
+    }
+
+    for (const auto& [name, histogram] : histograms)
+    {
+        TbotsProto::HistogramMetric* histogram_msg = snapshot->add_histograms();
+        histogram_msg->set_name(name);
+        histogram_msg->set_num_samples(histogram->getNumSamples());
+        histogram_msg->set_mean(histogram->getMean());
+        histogram_msg->set_max(histogram->getMax());
+        histogram_msg->set_p50(histogram->getValueAtPercentile(50.0));
+        histogram_msg->set_p99(histogram->getValueAtPercentile(99.0));
+        histogram_msg->set_p999(histogram->getValueAtPercentile(99.9));
+
+        for (std::size_t i = 0; i < MetricsHistogram::NUM_BUCKETS; i++)
+        {
+            uint64_t count = histogram->getBucketCount(i);
+            if (count > 0)
+            {
+                TbotsProto::HistogramBucket* bucket_msg = histogram_msg->add_buckets();
+                bucket_msg->set_lower_bound(MetricsHistogram::getBucketLowerBound(i));
+                bucket_msg->set_count(count);
+            }
+        }
+    }
+
+    return snapshot;
+}
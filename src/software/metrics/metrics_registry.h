@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "proto/metrics.pb.h"
+#include "software/metrics/metrics_histogram.h"
+
+/**
+ * A monotonically increasing count, such as the number of packets received
+ */
+class MetricsCounter
+{
+   public:
+    MetricsCounter();
+
+    /**
+     * Adds to the count
+     *
+     * @param amount the amount to add
+     */
+    void increment(uint64_t amount = 1);
+
+    /**
+     * Gets the current count
+     *
+     * @return the current count
+     */
+    uint64_t getValue() const;
+
+   private:
+    std::atomic<uint64_t> value_;
+};
+
+/**
+ * A value that can go up and down, such as the size of a queue
+ */
+class MetricsGauge
+{
+   public:
+    MetricsGauge();
+
+    /**
+     * Sets the value of the gauge
+     *
+     * @param value the new value
+     */
+    void set(double value);
+
+    /**
+     * Gets the last value of the gauge
+     *
+     * @return the last value set, or 0 if it was never set
+     */
+    double getValue() const;
+
+   private:
+    std::atomic<double> value_;
+};
+
+/**
+ * A registry of named counters, gauges and histograms that can be exported as a
+ * TbotsProto::MetricsSnapshot.
+ *
+ * Looking up a metric takes a lock, but the returned metrics live as long as the
+ * registry and are updated without locking. Callers on hot paths should look up
+ * their metrics once and keep the references, for example in a function local static:
+ *
+ *     static MetricsHistogram& tick_duration =
+ *         MetricsRegistry::global().getHistogram("ai.tick_duration_ns");
+ */
+class MetricsRegistry
+{
+   public:
+    MetricsRegistry() = default;
+
+    MetricsRegistry(const MetricsRegistry&)            = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /**
+     * Gets the registry shared by the whole process
+     *
+     * @return the process wide registry
+     */
+    static MetricsRegistry& global();
+
+    /**
+     * Gets the metric with the given name, creating it if it does not exist yet
+     *
+     * @param name the name of the metric
+     *
+     * @return the metric, which stays valid for the lifetime of the registry
+     */
+    MetricsCounter& getCounter(const std::string& name);
+    MetricsGauge& getGauge(const std::string& name);
+    MetricsHistogram& getHistogram(const std::string& name);
+
+    /**
+     * Creates a snapshot of the current values of all metrics, sorted by name. Metrics
+     * updated while the snapshot is created may be only partially included.
+     *
+     * @return the snapshot of all metrics
+     */
+    std::unique_ptr<TbotsProto::MetricsSnapshot> createMetricsSnapshot() const;
+
+   private:
+    mutable std::mutex metrics_mutex;
+    std::map<std::string, std::unique_ptr<MetricsCounter>> counters;
+    std::map<std::string, std::unique_ptr<MetricsGauge>> gauges;
+    std::map<std::string, std::unique_ptr<MetricsHistogram>> histograms;
+};
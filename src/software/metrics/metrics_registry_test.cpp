@@ -0,0 +1,88 @@
+#include "software/metrics/metrics_registry.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "software/metrics/scoped_metrics_timer.h"
+
+TEST(MetricsRegistryTest, same_name_returns_same_metric)
+{
+    MetricsRegistry registry;
+
+    EXPECT_EQ(&registry.getCounter("packets"), &registry.getCounter("packets"));
+    EXPECT_NE(&registry.getCounter("packets"), &registry.getCounter("other_packets"));
+    EXPECT_EQ(&registry.getGauge("queue_size"), &registry.getGauge("queue_size"));
+    EXPECT_EQ(&registry.getHistogram("tick"), &registry.getHistogram("tick"));
+}
+
+TEST(MetricsRegistryTest, counter_and_gauge_values)
+{
+    MetricsRegistry registry;
+    MetricsCounter& counter = registry.getCounter("packets");
+    MetricsGauge& gauge     = registry.getGauge("queue_size");
+
+    counter.increment();
+    counter.increment(4);
+    gauge.set(3.0);
+    gauge.set(2.5);
+
+    EXPECT_EQ(5, counter.getValue());
+    EXPECT_DOUBLE_EQ(2.5, gauge.getValue());
+}
+
+TEST(MetricsRegistryTest, create_metrics_snapshot)
+{
+    MetricsRegistry registry;
+    registry.getCounter("b_counter").increment(2);
+    registry.getCounter("a_counter").increment(1);
+    registry.getGauge("gauge").set(-1.5);
+    MetricsHistogram& histogram = registry.getHistogram("histogram");
+    histogram.record(5);
+    histogram.record(5);
+    histogram.record(1000);
+
+    auto snapshot = registry.createMetricsSnapshot();
+
+    EXPECT_GT(snapshot->time_sent().epoch_timestamp_seconds(), 0.0);
+
+    ASSERT_EQ(2, snapshot->counters_size());
+    EXPECT_EQ("a_counter", snapshot->counters(0).name());
+    EXPECT_EQ(1, snapshot->counters(0).value());
+    EXPECT_EQ("b_counter", snapshot->counters(1).name());
+    EXPECT_EQ(2, snapshot->counters(1).value());
+
+    ASSERT_EQ(1, snapshot->gauges_size());
+    EXPECT_EQ("gauge", snapshot->gauges(0).name());
+    EXPECT_DOUBLE_EQ(-1.5, snapshot->gauges(0).value());
+
+    ASSERT_EQ(1, snapshot->histograms_size());
+    const TbotsProto::HistogramMetric& histogram_msg = snapshot->histograms(0);
+    EXPECT_EQ("histogram", histogram_msg.name());
+    EXPECT_EQ(3, histogram_msg.num_samples());
+    EXPECT_EQ(1000, histogram_msg.max());
+    EXPECT_EQ(5, histogram_msg.p50());
+    EXPECT_EQ(1000, histogram_msg.p999());
+    ASSERT_EQ(2, histogram_msg.buckets_size());
+    EXPECT_EQ(5, histogram_msg.buckets(0).lower_bound());
+    EXPECT_EQ(2, histogram_msg.buckets(0).count());
+    EXPECT_EQ(MetricsHistogram::getBucketLowerBound(
+                  MetricsHistogram::getBucketIndex(1000)),
+              histogram_msg.buckets(1).lower_bound());
+    EXPECT_EQ(1, histogram_msg.buckets(1).count());
+}
+
+TEST(MetricsRegistryTest, scoped_metrics_timer_records_elapsed_time)
+{
+    MetricsRegistry registry;
+    MetricsHistogram& histogram = registry.getHistogram("sleep");
+
+    {
+        ScopedMetricsTimer timer(histogram);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    EXPECT_EQ(1, histogram.getNumSamples());
+    EXPECT_GE(histogram.getMax(), 2000000);
+}
@@ -0,0 +1,18 @@
+#include "software/metrics/scoped_metrics_timer.h"
+
+#include "shared/constants.h"
+
+ScopedMetricsTimer::ScopedMetricsTimer(MetricsHistogram& histogram)
+    : histogram(histogram), time_elapsed{}
+{
+    timer.emplace(&time_elapsed);
+}
+
+ScopedMetricsTimer::~ScopedMetricsTimer()
+{
+    // Stop the timer so that time_elapsed is written before it is recorded
+    timer.reset();
+    histogram.record(static_cast<int64_t>(time_elapsed.tv_sec) *
+                         static_cast<int64_t>(NANOSECONDS_PER_SECOND) +
+                     static_cast<int64_t>(time_elapsed.tv_nsec));
+}
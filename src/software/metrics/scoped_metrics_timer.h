@@ -0,0 +1,32 @@
+#pragma once
+
+#include <optional>
+
+#include "software/metrics/metrics_histogram.h"
+#include "software/util/scoped_timespec_timer/scoped_timespec_timer.h"
+
+/**
+ * Records the time that passed between its construction and destruction, in
+ * nanoseconds, into a histogram
+ */
+class ScopedMetricsTimer
+{
+   public:
+    /**
+     * Constructs a scoped timer that records into the given histogram
+     *
+     * @param histogram the histogram to record the time elapsed into, must outlive
+     * the timer
+     */
+    explicit ScopedMetricsTimer(MetricsHistogram& histogram);
+
+    ScopedMetricsTimer(const ScopedMetricsTimer&)            = delete;
+    ScopedMetricsTimer& operator=(const ScopedMetricsTimer&) = delete;
+
+    ~ScopedMetricsTimer();
+
+   private:
+    MetricsHistogram& histogram;
+    struct timespec time_elapsed;
+    std::optional<ScopedTimespecTimer> timer;
+};
@@ -0,0 +1,75 @@
+#include "software/multithreading/worker_pool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t num_threads)
+{
+    num_threads = std::max<size_t>(num_threads, 1);
+    workers_.reserve(num_threads - 1);
+    for (size_t thread_index = 1; thread_index < num_threads; thread_index++)
+    {
+        workers_.emplace_back(&WorkerPool::runWorker, this, thread_index);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::scoped_lock lock(mutex_);
+        stop_ = true;
+    }
+    run_started_.notify_all();
+    for (std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(const std::function<void(size_t)>& function)
+{
+    std::scoped_lock run_lock(run_mutex_);
+    {
+        std::scoped_lock lock(mutex_);
+        function_            = &function;
+        num_workers_running_ = workers_.size();
+        run_number_++;
+    }
+    run_started_.notify_all();
+
+    function(0);
+
+    std::unique_lock lock(mutex_);
+    run_finished_.wait(lock, [this] { return num_workers_running_ == 0; });
+    function_ = nullptr;
+}
+
+size_t WorkerPool::numThreads() const
+{
+    return workers_.size() + 1;
+}
+
+void WorkerPool::runWorker(size_t thread_index)
+{
+    size_t last_run_number = 0;
+    std::unique_lock lock(mutex_);
+    while (true)
+    {
+        run_started_.wait(lock,
+                          [&] { return stop_ || run_number_ != last_run_number; });
+        if (stop_)
+        {
+            return;
+        }
+        last_run_number                             = run_number_;
+        const std::function<void(size_t)>* function = function_;
+
+        lock.unlock();
+        (*function)(thread_index);
+        lock.lock();
+
+        if (--num_workers_running_ == 0)
+        {
+            run_finished_.notify_one();
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A WorkerPool is a fixed set of threads that run a function in parallel. The threads
+ * are started once when the pool is created and wait for work between runs, so code
+ * that runs in parallel every tick does not create and join threads every tick.
+ *
+ * The calling thread takes part in every run, so a pool of one thread runs the function
+ * on the calling thread without starting any threads.
+ */
+class WorkerPool
+{
+   public:
+    /**
+     * Creates a WorkerPool and starts its threads
+     *
+     * @param num_threads The number of threads to run the function on, including the
+     * calling thread. At least one thread is always used
+     */
+    explicit WorkerPool(size_t num_threads);
+
+    WorkerPool()                             = delete;
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Stops and joins the threads of the pool
+     */
+    ~WorkerPool();
+
+    /**
+     * Calls the function once with each thread index from 0 to numThreads() - 1, in
+     * parallel, and waits for every call to return. Index 0 is called on the calling
+     * thread. Runs from different threads are run one after the other
+     *
+     * @param function The function to run, which must not throw
+     */
+    void run(const std::function<void(size_t)>& function);
+
+    /**
+     * Gets the number of threads the function is run on, including the calling thread
+     *
+     * @return the number of threads
+     */
+    size_t numThreads() const;
+
+   private:
+    /**
+     * Waits for runs and calls their function with the given thread index, until the
+     * pool is destroyed
+     *
+     * @param thread_index The index of the thread in the pool
+     */
+    void runWorker(size_t thread_index);
+
+    std::vector<std::thread> workers_;
+
+    // Held for the duration of a run, so runs from different threads don't overlap
+    std::mutex run_mutex_;
+
+    // Protects the state of the current run below
+    std::mutex mutex_;
+    std::condition_variable run_started_;
+    std::condition_variable run_finished_;
+    const std::function<void(size_t)>* function_ = nullptr;
+    // Incremented for every run, so each worker runs the function once per run
+    size_t run_number_          = 0;
+    size_t num_workers_running_ = 0;
+    bool stop_                  = false;
+};
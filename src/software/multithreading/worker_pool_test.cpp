@@ -0,0 +1,75 @@
+#include "software/multithreading/worker_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+TEST(WorkerPoolTest, runs_function_once_on_each_thread_every_run)
+{
+    WorkerPool pool(4);
+    std::vector<std::atomic<int>> num_calls(pool.numThreads());
+
+    for (int i = 0; i < 100; i++)
+    {
+        pool.run([&](size_t thread_index) { num_calls[thread_index]++; });
+    }
+
+    EXPECT_EQ(4, pool.numThreads());
+    for (const std::atomic<int>& num_thread_calls : num_calls)
+    {
+        EXPECT_EQ(100, num_thread_calls);
+    }
+}
+
+TEST(WorkerPoolTest, single_thread_pool_runs_on_calling_thread)
+{
+    WorkerPool pool(1);
+    std::thread::id thread_id;
+
+    pool.run([&](size_t thread_index) { thread_id = std::this_thread::get_id(); });
+
+    EXPECT_EQ(1, pool.numThreads());
+    EXPECT_EQ(std::this_thread::get_id(), thread_id);
+}
+
+TEST(WorkerPoolTest, pool_of_zero_threads_uses_calling_thread)
+{
+    WorkerPool pool(0);
+    int num_calls = 0;
+
+    pool.run([&](size_t thread_index) { num_calls++; });
+
+    EXPECT_EQ(1, pool.numThreads());
+    EXPECT_EQ(1, num_calls);
+}
+
+TEST(WorkerPoolTest, runs_from_different_threads_do_not_overlap)
+{
+    WorkerPool pool(3);
+    std::atomic<int> num_running_calls(0);
+    std::atomic<int> max_num_running_calls(0);
+    auto run_many_times = [&]()
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            pool.run(
+                [&](size_t thread_index)
+                {
+                    int num_running     = ++num_running_calls;
+                    int max_num_running = max_num_running_calls;
+                    while (num_running > max_num_running &&
+                           !max_num_running_calls.compare_exchange_weak(max_num_running,
+                                                                         num_running))
+                    {
+                    }
+                    num_running_calls--;
+                });
+        }
+    };
+
+    std::thread other_thread(run_many_times);
+    run_many_times();
+    other_thread.join();
+
+    EXPECT_LE(max_num_running_calls, 3);
+}
@@ -71,6 +71,7 @@ PYBIND11_MODULE(py_constants, m)
     m.attr("DYNAMIC_PARAMETER_UPDATE_RESPONSE_PATH") =
         DYNAMIC_PARAMETER_UPDATE_RESPONSE_PATH;
     m.attr("WORLD_STATE_RECEIVED_TRIGGER_PATH") = WORLD_STATE_RECEIVED_TRIGGER_PATH;
+    m.attr("METRICS_PATH")                      = METRICS_PATH;
 
     // Multicast Channels
     m.def("getRobotMulticastChannel",
@@ -1,5 +1,6 @@
 #include <pybind11/embed.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -19,11 +20,13 @@
 #include "proto/ssl_vision_wrapper.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "proto/team.pb.h"
+#include "proto/validation.pb.h"
 #include "proto/world.pb.h"
 #include "pybind11_protobuf/native_proto_caster.h"
 #include "shared/2021_robot_constants.h"
 #include "shared/robot_constants.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/pass_cost_map.h"
 #include "software/ai/passing/pass_generator.h"
 #include "software/ai/passing/pass_with_rating.h"
 #include "software/ai/passing/receiver_position_generator.hpp"
@@ -37,10 +40,12 @@
 #include "software/geom/rectangle.h"
 #include "software/geom/segment.h"
 #include "software/geom/vector.h"
+#include "software/logger/replay_reader.h"
 #include "software/math/math_functions.h"
 #include "software/networking/tbots_network_exception.h"
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
 #include "software/networking/udp/threaded_proto_udp_sender.hpp"
+#include "software/simulated_tests/validation/validation_engine.h"
 #include "software/uart/boost_uart_communication.h"
 #include "software/world/field.h"
 #include "software/world/robot.h"
@@ -183,8 +188,18 @@ PYBIND11_MODULE(python_bindings, m)
     py::class_<Polygon>(m, "Polygon")
         .def(py::init<std::vector<Point>>())
         .def("centroid", &Polygon::centroid)
-        .def("getPoints", &Polygon::getPoints)
-        .def("getSegments", &Polygon::getSegments)
+        .def("getPoints",
+             [](const Polygon& polygon)
+             {
+                 const Polygon::Points& points = polygon.getPoints();
+                 return std::vector<Point>(points.begin(), points.end());
+             })
+        .def("getSegments",
+             [](const Polygon& polygon)
+             {
+                 const Polygon::Segments segments = polygon.getSegments();
+                 return std::vector<Segment>(segments.begin(), segments.end());
+             })
         // Overloaded
         .def("__repr__",
              [](const Polygon& v)
@@ -397,6 +412,19 @@ PYBIND11_MODULE(python_bindings, m)
         .def("ball", &World::ball)
         .def("field", &World::field);
 
+    py::class_<ValidationEngine>(m, "ValidationEngine")
+        .def(py::init<TbotsProto::ValidationSpecSet>())
+        .def("validate", &ValidationEngine::validate, py::arg("world"))
+        .def("hasEventuallyValidations", &ValidationEngine::hasEventuallyValidations)
+        .def("allEventuallyValidationsPassed",
+             &ValidationEngine::allEventuallyValidationsPassed)
+        .def("getAlwaysValidationFailures",
+             &ValidationEngine::getAlwaysValidationFailures)
+        .def("getPendingEventuallyValidations",
+             &ValidationEngine::getPendingEventuallyValidations)
+        .def("createValidationProtoSet", &ValidationEngine::createValidationProtoSet,
+             py::arg("validation_type"), py::arg("test_name"));
+
     // Listeners
     declareThreadedProtoUdpListener<SSLProto::Referee>(m, "SSLReferee");
     declareThreadedProtoUdpListener<TbotsProto::RobotStatus>(m, "RobotStatus");
@@ -420,6 +448,40 @@ PYBIND11_MODULE(python_bindings, m)
     py::class_<ProtoLogger>(m, "ProtoLogger")
         .def_static("createLogEntry", &ProtoLogger::createLogEntry);
 
+    // Entries are returned as (timestamp, protobuf type full name, serialized proto)
+    // tuples, with the serialized proto as bytes that can be passed to FromString
+    py::class_<ReplayReader, std::shared_ptr<ReplayReader>>(m, "ReplayReader")
+        .def(py::init<const std::string&>(), py::call_guard<py::gil_scoped_release>())
+        .def("getChunkPaths", &ReplayReader::getChunkPaths)
+        .def("getNumEntries", &ReplayReader::getNumEntries)
+        .def("getChunkStartTime", &ReplayReader::getChunkStartTime)
+        .def("getEndTime", &ReplayReader::getEndTime)
+        .def("getBookmarkTimes", &ReplayReader::getBookmarkTimes)
+        .def("seek",
+             [](const ReplayReader& reader, double time_sec)
+             {
+                 ReplayReader::ReplayEntryPosition position = reader.seek(time_sec);
+                 return py::make_tuple(position.chunk_index, position.entry_index);
+             })
+        .def("readChunk",
+             [](const ReplayReader& reader, std::size_t chunk_index)
+             {
+                 std::vector<ReplayReader::ReplayEntry> entries;
+                 {
+                     py::gil_scoped_release release;
+                     entries = reader.readChunk(chunk_index);
+                 }
+
+                 py::list entry_tuples;
+                 for (const ReplayReader::ReplayEntry& entry : entries)
+                 {
+                     entry_tuples.append(py::make_tuple(
+                         entry.timestamp_sec, entry.protobuf_type_full_name,
+                         py::bytes(entry.serialized_proto)));
+                 }
+                 return entry_tuples;
+             });
+
     py::class_<EighteenZonePitchDivision, std::shared_ptr<EighteenZonePitchDivision>>(
         m, "EighteenZonePitchDivision")
         .def(py::init<Field>())
@@ -447,6 +509,64 @@ PYBIND11_MODULE(python_bindings, m)
                                       const TbotsProto::PassingConfig&>(
                         &Pass::fromDestReceiveSpeed));
 
+    py::enum_<PassCostComponent>(m, "PassCostComponent")
+        .value("STATIC_POSITION_QUALITY", PassCostComponent::STATIC_POSITION_QUALITY)
+        .value("PASS_FORWARD_QUALITY", PassCostComponent::PASS_FORWARD_QUALITY)
+        .value("PASS_NOT_TOO_CLOSE_QUALITY",
+               PassCostComponent::PASS_NOT_TOO_CLOSE_QUALITY)
+        .value("PASS_NOT_TOO_FAR_QUALITY", PassCostComponent::PASS_NOT_TOO_FAR_QUALITY)
+        .value("PASS_FRIENDLY_CAPABILITY", PassCostComponent::PASS_FRIENDLY_CAPABILITY)
+        .value("PASS_ENEMY_RISK", PassCostComponent::PASS_ENEMY_RISK)
+        .value("ENEMY_INTERCEPTION_RISK", PassCostComponent::ENEMY_INTERCEPTION_RISK)
+        .value("ENEMY_PROXIMITY_RISK", PassCostComponent::ENEMY_PROXIMITY_RISK)
+        .value("PASS_SHOOT_SCORE", PassCostComponent::PASS_SHOOT_SCORE)
+        .value("RECEIVER_POSITION_SCORE", PassCostComponent::RECEIVER_POSITION_SCORE)
+        .value("KEEP_AWAY_POSITION_SCORE", PassCostComponent::KEEP_AWAY_POSITION_SCORE)
+        .value("PASS_RATING", PassCostComponent::PASS_RATING)
+        .export_values();
+
+    // The costs are returned as read-only NumPy arrays of shape (num_cols, num_rows)
+    // that view the cost map's memory directly. The cost map is set as the base of
+    // each array so that it is kept alive for as long as the array is.
+    py::class_<PassCostMap, std::shared_ptr<PassCostMap>>(m, "PassCostMap")
+        .def(py::init<const World&, const TbotsProto::PassingConfig&, unsigned int,
+                      unsigned int, const std::vector<PassCostComponent>&,
+                      const std::optional<Pass>&, unsigned int>(),
+             py::arg("world"), py::arg("passing_config"), py::arg("num_cols"),
+             py::arg("num_rows"), py::arg("components") = PassCostMap::allComponents(),
+             py::arg("best_pass_so_far") = std::nullopt, py::arg("num_threads") = 0,
+             py::call_guard<py::gil_scoped_release>())
+        .def("numCols", &PassCostMap::numCols)
+        .def("numRows", &PassCostMap::numRows)
+        .def("cellCentre", &PassCostMap::cellCentre)
+        .def("hasComponent", &PassCostMap::hasComponent)
+        .def("getCosts",
+             [](py::object self, PassCostComponent component)
+             {
+                 const PassCostMap& cost_map      = self.cast<const PassCostMap&>();
+                 const std::vector<double>& costs = cost_map.getCosts(component);
+                 py::array_t<double> array(
+                     {cost_map.numCols(), cost_map.numRows()},
+                     {cost_map.numRows() * sizeof(double), sizeof(double)},
+                     costs.data(), self);
+                 array.attr("flags").attr("writeable") = false;
+                 return array;
+             })
+        .def("getCombinedCosts",
+             [](const PassCostMap& cost_map,
+                const std::vector<PassCostComponent>& components)
+             {
+                 // The combined costs are a new buffer, so the array takes ownership
+                 auto combined_costs = new std::vector<double>(
+                     cost_map.getCombinedCosts(components));
+                 py::capsule owner(combined_costs, [](void* costs)
+                                   { delete static_cast<std::vector<double>*>(costs); });
+                 return py::array_t<double>(
+                     {cost_map.numCols(), cost_map.numRows()},
+                     {cost_map.numRows() * sizeof(double), sizeof(double)},
+                     combined_costs->data(), owner);
+             });
+
     py::enum_<EighteenZoneId>(m, "EighteenZoneId")
         .value("ZONE_1", EighteenZoneId::ZONE_1)
         .value("ZONE_2", EighteenZoneId::ZONE_2)
@@ -6,6 +6,8 @@
 SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
     : sensor_fusion_config(sensor_fusion_config),
       field(std::nullopt),
+      field_geometry_fingerprint(std::nullopt),
+      field_version(0),
       ball(std::nullopt),
       friendly_team(),
       enemy_team(),
@@ -41,6 +43,7 @@ std::optional<World> SensorFusion::getWorld() const
         }
 
         new_world.setVirtualObstacles(virtual_obstacles_);
+        new_world.setFieldVersion(field_version);
         return new_world;
     }
     else
@@ -63,6 +66,69 @@ void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
 
     updateWorld(sensor_msg.robot_status_msgs());
 
+    assignGoalies();
+}
+
+void SensorFusion::processGroundTruth(
+    const Field &new_field, const Ball &new_ball, const std::vector<Robot> &yellow_robots,
+    const std::vector<Robot> &blue_robots,
+    const google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus> &robot_status_msgs)
+{
+    if (!field || *field != new_field)
+    {
+        field_version++;
+        field = new_field;
+    }
+    // Create the field again if geometry packets are received after this
+    field_geometry_fingerprint = std::nullopt;
+
+    // The robot statuses are exact, so the breakbeam is only tripped if a status says so
+    friendly_robot_id_with_ball_in_dribbler = std::nullopt;
+    updateWorld(robot_status_msgs);
+
+    auto update_team = [this](Team &team, const std::vector<Robot> &robots,
+                              bool is_friendly)
+    {
+        std::vector<Robot> team_robots;
+        for (const Robot &robot : robots)
+        {
+            const Robot robot_in_our_frame =
+                defending_positive_side ? invert(robot) : robot;
+            const bool breakbeam_tripped =
+                is_friendly && friendly_robot_id_with_ball_in_dribbler == robot.id();
+            team_robots.emplace_back(
+                robot.id(), robot_in_our_frame.position(), robot_in_our_frame.velocity(),
+                robot_in_our_frame.orientation(), robot_in_our_frame.angularVelocity(),
+                robot.timestamp(), breakbeam_tripped);
+        }
+
+        // Robots that are no longer in the state expire, the same as robots that are
+        // no longer detected
+        team.updateRobots(team_robots);
+        std::optional<Timestamp> most_recent_team_timestamp = team.timestamp();
+        if (most_recent_team_timestamp)
+        {
+            team.removeExpiredRobots(*most_recent_team_timestamp);
+        }
+    };
+
+    const bool friendly_team_is_yellow = sensor_fusion_config.friendly_color_yellow();
+    update_team(friendly_team, friendly_team_is_yellow ? yellow_robots : blue_robots,
+                true);
+    update_team(enemy_team, friendly_team_is_yellow ? blue_robots : yellow_robots,
+                false);
+
+    updateBall(defending_positive_side ? invert(new_ball) : new_ball);
+
+    assignGoalies();
+
+    possession = possession_tracker->getTeamWithPossession(friendly_team, enemy_team,
+                                                           *ball, *field);
+    updateDribbleDisplacement();
+}
+
+void SensorFusion::assignGoalies()
+{
     friendly_team.assignGoalie(friendly_goalie_id);
     enemy_team.assignGoalie(enemy_goalie_id);
 
@@ -111,13 +177,28 @@ void SensorFusion::updateWorld(const SSLProto::SSL_WrapperPacket &packet)
 
 void SensorFusion::updateWorld(const SSLProto::SSL_GeometryData &geometry_packet)
 {
-    field = createField(geometry_packet);
-    if (!field)
+    // The geometry is sent repeatedly, but the field is only created from the field
+    // size data, so the field only has to be created again when that data changes
+    std::string fingerprint;
+    geometry_packet.field().SerializePartialToString(&fingerprint);
+    if (field_geometry_fingerprint == fingerprint)
+    {
+        return;
+    }
+    field_geometry_fingerprint = std::move(fingerprint);
+
+    std::optional<Field> new_field = createField(geometry_packet);
+    if (!new_field)
     {
         LOG(WARNING)
             << "Invalid field packet has been detected, which means field may be unreliable "
             << "and the createFieldFromPacketGeometry may be parsing using the wrong proto format";
     }
+    else if (!field || *field != *new_field)
+    {
+        field_version++;
+    }
+    field = new_field;
 }
 
 void SensorFusion::updateWorld(const SSLProto::Referee &packet)
@@ -470,6 +551,22 @@ BallDetection SensorFusion::invert(BallDetection ball_detection) const
     return ball_detection;
 }
 
+Robot SensorFusion::invert(const Robot &robot) const
+{
+    RobotState inverted_state(Point(-robot.position().x(), -robot.position().y()),
+                              -robot.velocity(), robot.orientation() + Angle::half(),
+                              robot.angularVelocity(), robot.breakbeamTripped());
+    return Robot(robot.id(), inverted_state, robot.timestamp(),
+                 robot.getUnavailableCapabilities(), robot.robotConstants());
+}
+
+Ball SensorFusion::invert(const Ball &ball) const
+{
+    BallState inverted_state(Point(-ball.position().x(), -ball.position().y()),
+                             -ball.velocity(), ball.currentState().distanceFromGround());
+    return Ball(inverted_state, ball.timestamp(), -ball.acceleration());
+}
+
 bool SensorFusion::teamHasBall(const Team &team, const Ball &ball)
 {
     for (const auto &robot : team.getAllRobots())
@@ -506,17 +603,18 @@ bool SensorFusion::checkForVisionReset(double t_capture)
 
 void SensorFusion::resetWorldComponents()
 {
-    field                = std::nullopt;
-    ball                 = std::nullopt;
-    friendly_team        = Team();
-    enemy_team           = Team();
-    game_state           = GameState();
-    referee_stage        = std::nullopt;
-    ball_filter          = BallFilter();
-    friendly_team_filter = RobotTeamFilter();
-    enemy_team_filter    = RobotTeamFilter();
-    possession           = TeamPossession::FRIENDLY_TEAM;
-    dribble_displacement = std::nullopt;
+    field                      = std::nullopt;
+    field_geometry_fingerprint = std::nullopt;
+    ball                       = std::nullopt;
+    friendly_team              = Team();
+    enemy_team                 = Team();
+    game_state                 = GameState();
+    referee_stage              = std::nullopt;
+    ball_filter                = BallFilter();
+    friendly_team_filter       = RobotTeamFilter();
+    enemy_team_filter          = RobotTeamFilter();
+    possession                 = TeamPossession::FRIENDLY_TEAM;
+    dribble_displacement       = std::nullopt;
 }
 
 void SensorFusion::setVirtualObstacles(TbotsProto::VirtualObstacles virtual_obstacles)
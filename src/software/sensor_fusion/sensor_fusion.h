@@ -39,6 +39,25 @@ class SensorFusion
      */
     void processSensorProto(const SensorProto &sensor_msg);
 
+    /**
+     * Updates the World with the exact state of the field, ball and robots, such as
+     * the ground truth state of a simulation, instead of filtering vision detections.
+     * The state is given in the reference frame of vision, the same as the detections
+     * in a SensorProto
+     *
+     * @param new_field The field
+     * @param new_ball The ball
+     * @param yellow_robots The yellow robots
+     * @param blue_robots The blue robots
+     * @param robot_status_msgs The statuses of the friendly robots, which must include
+     * the breakbeam status of every friendly robot with a tripped breakbeam
+     */
+    void processGroundTruth(
+        const Field &new_field, const Ball &new_ball,
+        const std::vector<Robot> &yellow_robots, const std::vector<Robot> &blue_robots,
+        const google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus>
+            &robot_status_msgs);
+
     /**
      * Returns the most up-to-date world if enough data has been received
      * to create one.
@@ -127,6 +146,14 @@ class SensorFusion
      */
     RobotDetection invert(RobotDetection robot_detection) const;
     BallDetection invert(BallDetection ball_detection) const;
+    Robot invert(const Robot &robot) const;
+    Ball invert(const Ball &ball) const;
+
+    /**
+     * Assigns the goalies of the friendly and enemy teams, from the game controller
+     * or overridden by the sensor fusion config
+     */
+    void assignGoalies();
 
     /**
      * Updates the segment representing the displacement of the ball due to
@@ -168,6 +195,11 @@ class SensorFusion
     bool shouldTrustRobotStatus();
     TbotsProto::SensorFusionConfig sensor_fusion_config;
     std::optional<Field> field;
+    // The serialized field size data of the geometry packet that the field was created
+    // from, to skip creating the field again when the geometry has not changed
+    std::optional<std::string> field_geometry_fingerprint;
+    // Incremented whenever the field changes, starting from 0 before the first field
+    uint64_t field_version;
     std::optional<Ball> ball;
     Team friendly_team;
     Team enemy_team;
@@ -209,6 +209,16 @@ class SensorFusionTest : public ::testing::Test
         return World(field, ball, friendly_team, enemy_team);
     }
 
+    std::vector<Robot> createRobots(const std::vector<RobotStateWithId> &robot_states)
+    {
+        std::vector<Robot> robots;
+        for (const auto &state : robot_states)
+        {
+            robots.emplace_back(state.id, state.robot_state, current_time);
+        }
+        return robots;
+    }
+
     std::unique_ptr<TbotsProto::RobotStatus> initRobotStatusId1()
     {
         auto robot_msg = std::make_unique<TbotsProto::RobotStatus>();
@@ -496,6 +506,44 @@ TEST_F(SensorFusionTest, test_complete_wrapper_packet)
     EXPECT_EQ(initWorld(), result);
 }
 
+TEST_F(SensorFusionTest, field_version_unchanged_by_repeated_geometry)
+{
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        SensorProto sensor_msg;
+        auto ssl_wrapper_packet = createSSLWrapperPacket(
+            std::make_unique<SSLProto::SSL_GeometryData>(*geom_data),
+            initDetectionFrame());
+        *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+        sensor_fusion.processSensorProto(sensor_msg);
+
+        ASSERT_TRUE(sensor_fusion.getWorld());
+        EXPECT_EQ(1, sensor_fusion.getWorld()->getFieldVersion());
+        EXPECT_EQ(Field::createSSLDivisionBField(), sensor_fusion.getWorld()->field());
+    }
+}
+
+TEST_F(SensorFusionTest, field_version_incremented_by_changed_geometry)
+{
+    SensorProto sensor_msg;
+    auto ssl_wrapper_packet =
+        createSSLWrapperPacket(std::move(geom_data), initDetectionFrame());
+    *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+    ASSERT_TRUE(sensor_fusion.getWorld());
+    EXPECT_EQ(1, sensor_fusion.getWorld()->getFieldVersion());
+
+    SensorProto div_a_sensor_msg;
+    auto div_a_ssl_wrapper_packet = createSSLWrapperPacket(
+        createGeometryData(Field::createSSLDivisionAField(), 0.005f),
+        initDetectionFrame());
+    *(div_a_sensor_msg.mutable_ssl_vision_msg()) = *div_a_ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(div_a_sensor_msg);
+    ASSERT_TRUE(sensor_fusion.getWorld());
+    EXPECT_EQ(2, sensor_fusion.getWorld()->getFieldVersion());
+    EXPECT_EQ(Field::createSSLDivisionAField(), sensor_fusion.getWorld()->field());
+}
+
 TEST_F(SensorFusionTest, test_robot_status_msg_packet)
 {
     SensorProto sensor_msg;
@@ -1095,3 +1143,81 @@ TEST_F(SensorFusionTest, breakbeam_not_in_robot_test)
     // is the break_beam correct
     EXPECT_FALSE(breakbeam_tripped);
 }
+
+TEST_F(SensorFusionTest, ground_truth_world)
+{
+    EXPECT_EQ(std::nullopt, sensor_fusion.getWorld());
+
+    sensor_fusion.processGroundTruth(
+        Field::createSSLDivisionBField(), Ball(initBallState(), current_time),
+        createRobots(initYellowRobotStates()), createRobots(initBlueRobotStates()), {});
+    std::optional<World> result = sensor_fusion.getWorld();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(initWorld(), *result);
+    EXPECT_EQ(1, result->getFieldVersion());
+}
+
+TEST_F(SensorFusionTest, inverted_ground_truth_world)
+{
+    SensorProto sensor_msg;
+    SSLProto::Referee ssl_referee_packet;
+    ssl_referee_packet.set_blue_team_on_positive_half(false);
+    *(sensor_msg.mutable_ssl_referee_msg()) = ssl_referee_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    sensor_fusion.processGroundTruth(
+        Field::createSSLDivisionBField(), Ball(initBallState(), current_time),
+        createRobots(initYellowRobotStates()), createRobots(initBlueRobotStates()), {});
+    std::optional<World> result = sensor_fusion.getWorld();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(initInvertedWorld(), *result);
+}
+
+TEST_F(SensorFusionTest, inverted_ground_truth_ball_acceleration)
+{
+    SensorProto sensor_msg;
+    SSLProto::Referee ssl_referee_packet;
+    ssl_referee_packet.set_blue_team_on_positive_half(false);
+    *(sensor_msg.mutable_ssl_referee_msg()) = ssl_referee_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    sensor_fusion.processGroundTruth(
+        Field::createSSLDivisionBField(),
+        Ball(initBallState(), current_time, Vector(1.5, -0.5)),
+        createRobots(initYellowRobotStates()), createRobots(initBlueRobotStates()), {});
+    std::optional<World> result = sensor_fusion.getWorld();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(Vector(-1.5, 0.5), result->ball().acceleration());
+}
+
+TEST_F(SensorFusionTest, ground_truth_breakbeam_only_tripped_while_reported)
+{
+    google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus> robot_status_msgs;
+    TbotsProto::RobotStatus *robot_msg = robot_status_msgs.Add();
+    robot_msg->set_robot_id(2);
+    robot_msg->mutable_power_status()->set_breakbeam_tripped(true);
+
+    sensor_fusion.processGroundTruth(
+        Field::createSSLDivisionBField(), Ball(initBallState(), current_time),
+        createRobots(initYellowRobotStates()), createRobots(initBlueRobotStates()),
+        robot_status_msgs);
+    std::optional<World> current_world = sensor_fusion.getWorld();
+
+    ASSERT_TRUE(current_world);
+    EXPECT_TRUE(current_world->friendlyTeam().getRobotById(2)->breakbeamTripped());
+    EXPECT_FALSE(current_world->friendlyTeam().getRobotById(1)->breakbeamTripped());
+    EXPECT_FALSE(current_world->enemyTeam().getRobotById(2)->breakbeamTripped());
+
+    // The ground truth is exact, so the breakbeam is not kept tripped after the
+    // robot status stops reporting it
+    sensor_fusion.processGroundTruth(
+        Field::createSSLDivisionBField(), Ball(initBallState(), current_time),
+        createRobots(initYellowRobotStates()), createRobots(initBlueRobotStates()), {});
+    current_world = sensor_fusion.getWorld();
+
+    ASSERT_TRUE(current_world);
+    EXPECT_FALSE(current_world->friendlyTeam().getRobotById(2)->breakbeamTripped());
+}
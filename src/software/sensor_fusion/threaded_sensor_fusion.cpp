@@ -2,10 +2,15 @@
 
 #include <google/protobuf/util/message_differencer.h>
 
+#include "software/metrics/latency_trace.h"
+#include "software/metrics/metrics_registry.h"
+#include "software/metrics/scoped_metrics_timer.h"
+
 ThreadedSensorFusion::ThreadedSensorFusion(
-    TbotsProto::SensorFusionConfig sensor_fusion_config)
+    TbotsProto::SensorFusionConfig sensor_fusion_config, bool loopback_latency_tracing)
     : FirstInFirstOutThreadedObserver<SensorProto>(DIFFERENT_GRSIM_FRAMES_RECEIVED),
-      sensor_fusion(sensor_fusion_config)
+      sensor_fusion(sensor_fusion_config),
+      latency_trace_collector(loopback_latency_tracing)
 {
 }
 
@@ -24,8 +29,21 @@ void ThreadedSensorFusion::onValueReceived(TbotsProto::ThunderbotsConfig config)
 
 void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
 {
+    static MetricsHistogram& process_duration =
+        MetricsRegistry::global().getHistogram("sensor_fusion.process_duration_ns");
+
+    const double received_s = getLatencyTraceTimeSeconds();
+
     std::scoped_lock lock(sensor_fusion_mutex);
-    sensor_fusion.processSensorProto(sensor_msg);
+    {
+        ScopedMetricsTimer process_timer(process_duration);
+        sensor_fusion.processSensorProto(sensor_msg);
+    }
+
+    for (const auto& robot_status_msg : sensor_msg.robot_status_msgs())
+    {
+        latency_trace_collector.addRobotStatus(robot_status_msg, received_s);
+    }
 
     // Limit sensor fusion to only send out worlds on ssl wrapper packets
     // to prevent spamming worlds every time a referee msg or robot status
@@ -35,6 +53,15 @@ void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
         std::optional<World> world = sensor_fusion.getWorld();
         if (world)
         {
+            // Start tracing the latency of the vision frame to the robots
+            if (sensor_msg.ssl_vision_msg().has_detection())
+            {
+                TbotsProto::LatencyTrace latency_trace = createLatencyTrace(
+                    sensor_msg.ssl_vision_msg().detection(), received_s);
+                latency_trace.set_sensor_fusion_done_s(getLatencyTraceTimeSeconds());
+                world->setLatencyTrace(latency_trace);
+            }
+
             Subject<World>::sendValueToObservers(world.value());
         }
     }
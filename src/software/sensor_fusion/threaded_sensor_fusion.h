@@ -2,6 +2,7 @@
 
 #include "proto/parameters.pb.h"
 #include "proto/sensor_msg.pb.h"
+#include "software/metrics/latency_trace_collector.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
 #include "software/sensor_fusion/sensor_fusion.h"
@@ -15,7 +16,15 @@ class ThreadedSensorFusion
 
 {
    public:
-    explicit ThreadedSensorFusion(TbotsProto::SensorFusionConfig config);
+    /**
+     * Creates a new ThreadedSensorFusion
+     *
+     * @param config The sensor fusion config
+     * @param loopback_latency_tracing Whether the robots run on this computer, so the
+     * latency traces they echo back are measured with the same clock
+     */
+    explicit ThreadedSensorFusion(TbotsProto::SensorFusionConfig config,
+                                  bool loopback_latency_tracing = false);
     virtual ~ThreadedSensorFusion() = default;
 
    private:
@@ -24,6 +33,7 @@ class ThreadedSensorFusion
     void onValueReceived(TbotsProto::VirtualObstacles virtual_obstacles) override;
 
     SensorFusion sensor_fusion;
+    LatencyTraceCollector latency_trace_collector;
     TbotsProto::SensorFusionConfig sensor_fusion_config;
     static constexpr size_t DIFFERENT_GRSIM_FRAMES_RECEIVED = 4;
     std::mutex sensor_fusion_mutex;
@@ -0,0 +1,78 @@
+#include "software/simulated_tests/scenario_result_cache.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "software/logger/logger.h"
+
+ScenarioResultCache::ScenarioResultCache(const std::filesystem::path& cache_dir)
+    : cache_dir(cache_dir)
+{
+}
+
+/**
+ * Adds the given bytes to a 64-bit FNV-1a hash
+ *
+ * @param hash the hash to add the bytes to
+ * @param bytes the bytes to add
+ * @param num_bytes the number of bytes
+ */
+static void hashBytes(uint64_t& hash, const void* bytes, std::size_t num_bytes)
+{
+    static constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    const auto* data = static_cast<const unsigned char*>(bytes);
+    for (std::size_t i = 0; i < num_bytes; i++)
+    {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+}
+
+/**
+ * Adds the given string to a 64-bit FNV-1a hash, prefixed by its length so that the
+ * boundaries between strings are part of the hash
+ *
+ * @param hash the hash to add the string to
+ * @param str the string to add
+ */
+static void hashString(uint64_t& hash, const std::string& str)
+{
+    const uint64_t size = str.size();
+    hashBytes(hash, &size, sizeof(size));
+    hashBytes(hash, str.data(), str.size());
+}
+
+std::string ScenarioResultCache::createScenarioKey(const std::string& code_version,
+                                                   const std::string& scenario,
+                                                   uint32_t seed)
+{
+    static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hashString(hash, code_version);
+    hashString(hash, scenario);
+    hashBytes(hash, &seed, sizeof(seed));
+
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return key.str();
+}
+
+bool ScenarioResultCache::hasPassed(const std::string& scenario_key) const
+{
+    return std::filesystem::exists(cache_dir / scenario_key);
+}
+
+void ScenarioResultCache::recordPass(const std::string& scenario_key)
+{
+    std::error_code error;
+    std::filesystem::create_directories(cache_dir, error);
+    std::ofstream result_file(cache_dir / scenario_key);
+    if (error || !result_file)
+    {
+        LOG(WARNING) << "Could not record the result of scenario " << scenario_key
+                     << " in " << cache_dir;
+    }
+}
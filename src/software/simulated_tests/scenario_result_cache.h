@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+/**
+ * A cache of the simulated test scenarios that have passed, so that scenarios which
+ * are known to pass do not have to be simulated again.
+ *
+ * Scenarios are identified by a key derived from the version of the code, a
+ * description of the scenario and the seed of the simulation. A scenario is only
+ * reproducible, and therefore only safe to cache, if the simulation is seeded and the
+ * AI is stepped synchronously with the simulation. Each passed scenario is stored as
+ * an empty file named after its key, so the cache can be shared between test
+ * processes and persisted by CI.
+ */
+class ScenarioResultCache
+{
+   public:
+    /**
+     * Creates a cache that stores its results in the given directory
+     *
+     * @param cache_dir the directory to store the results in, which is created when
+     * the first result is recorded
+     */
+    explicit ScenarioResultCache(const std::filesystem::path& cache_dir);
+
+    /**
+     * Creates the key identifying a scenario. The key is a content hash of the
+     * arguments, so it changes whenever any of them change.
+     *
+     * @param code_version the version of the code that runs the scenario, for
+     * example the git commit hash
+     * @param scenario a description of everything that defines the scenario other
+     * than the code, such as the initial world state and configs
+     * @param seed the seed of the simulation
+     *
+     * @return the key of the scenario
+     */
+    static std::string createScenarioKey(const std::string& code_version,
+                                         const std::string& scenario, uint32_t seed);
+
+    /**
+     * Checks whether the scenario with the given key has passed before
+     *
+     * @param scenario_key the key of the scenario
+     *
+     * @return true if the scenario has passed before
+     */
+    bool hasPassed(const std::string& scenario_key) const;
+
+    /**
+     * Records that the scenario with the given key passed
+     *
+     * @param scenario_key the key of the scenario
+     */
+    void recordPass(const std::string& scenario_key);
+
+   private:
+    std::filesystem::path cache_dir;
+};
@@ -0,0 +1,55 @@
+#include "software/simulated_tests/scenario_result_cache.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+class ScenarioResultCacheTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        cache_dir = std::filesystem::temp_directory_path() /
+                    ("scenario_result_cache_test_" + std::to_string(getpid()));
+        std::filesystem::remove_all(cache_dir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(cache_dir);
+    }
+
+    std::filesystem::path cache_dir;
+};
+
+TEST_F(ScenarioResultCacheTest, key_is_stable)
+{
+    EXPECT_EQ(ScenarioResultCache::createScenarioKey("abc123", "scenario", 1),
+              ScenarioResultCache::createScenarioKey("abc123", "scenario", 1));
+    EXPECT_EQ(16, ScenarioResultCache::createScenarioKey("abc123", "scenario", 1).size());
+}
+
+TEST_F(ScenarioResultCacheTest, key_changes_with_every_input)
+{
+    std::string key = ScenarioResultCache::createScenarioKey("abc123", "scenario", 1);
+
+    EXPECT_NE(key, ScenarioResultCache::createScenarioKey("abc124", "scenario", 1));
+    EXPECT_NE(key, ScenarioResultCache::createScenarioKey("abc123", "scenario2", 1));
+    EXPECT_NE(key, ScenarioResultCache::createScenarioKey("abc123", "scenario", 2));
+    // Moving characters between the inputs changes the key
+    EXPECT_NE(key, ScenarioResultCache::createScenarioKey("abc12", "3scenario", 1));
+}
+
+TEST_F(ScenarioResultCacheTest, record_pass)
+{
+    ScenarioResultCache cache(cache_dir);
+    std::string key = ScenarioResultCache::createScenarioKey("abc123", "scenario", 1);
+
+    EXPECT_FALSE(cache.hasPassed(key));
+    cache.recordPass(key);
+    EXPECT_TRUE(cache.hasPassed(key));
+
+    // Results are shared through the directory
+    EXPECT_TRUE(ScenarioResultCache(cache_dir).hasPassed(key));
+    EXPECT_FALSE(cache.hasPassed(
+        ScenarioResultCache::createScenarioKey("abc123", "other_scenario", 1)));
+}
@@ -4,9 +4,12 @@
 
 // TODO (#2419): remove this
 #include <fenv.h>
+#include <google/protobuf/text_format.h>
 
 #include <cstdlib>
 #include <filesystem>
+#include <iomanip>
+#include <sstream>
 
 #include "proto/message_translation/er_force_world.h"
 #include "proto/message_translation/ssl_wrapper.h"
@@ -22,6 +25,7 @@ using namespace TestUtil;
 SimulatedErForceSimTestFixture::SimulatedErForceSimTestFixture()
     : friendly_thunderbots_config(TbotsProto::ThunderbotsConfig()),
       enemy_thunderbots_config(TbotsProto::ThunderbotsConfig()),
+      use_ground_truth_world(false),
       friendly_sensor_fusion(friendly_thunderbots_config.sensor_fusion_config()),
       enemy_sensor_fusion(enemy_thunderbots_config.sensor_fusion_config()),
       run_simulation_in_realtime(false)
@@ -54,6 +58,8 @@ void SimulatedErForceSimTestFixture::SetUp()
         SensorFusion(friendly_thunderbots_config.sensor_fusion_config());
     enemy_sensor_fusion = SensorFusion(enemy_thunderbots_config.sensor_fusion_config());
 
+    use_ground_truth_world = TbotsGtestMain::use_ground_truth_world;
+
     if (TbotsGtestMain::run_sim_in_realtime)
     {
         run_simulation_in_realtime = true;
@@ -86,7 +92,8 @@ void SimulatedErForceSimTestFixture::setCommonConfigs(
 
 bool SimulatedErForceSimTestFixture::validateAndCheckCompletion(
     std::vector<TerminatingFunctionValidator> &terminating_function_validators,
-    std::vector<NonTerminatingFunctionValidator> &non_terminating_function_validators)
+    std::vector<NonTerminatingFunctionValidator> &non_terminating_function_validators,
+    std::optional<ValidationEngine> &validation_engine, const World &world)
 {
     for (auto &function_validator : non_terminating_function_validators)
     {
@@ -100,13 +107,41 @@ bool SimulatedErForceSimTestFixture::validateAndCheckCompletion(
     bool validation_successful = std::all_of(
         terminating_function_validators.begin(), terminating_function_validators.end(),
         [](TerminatingFunctionValidator &fv) { return fv.executeAndCheckForSuccess(); });
+    bool has_terminating_validations = !terminating_function_validators.empty();
+
+    if (validation_engine)
+    {
+        validation_engine->validate(world);
+        for (const std::string &failure_message :
+             validation_engine->getAlwaysValidationFailures())
+        {
+            ADD_FAILURE() << failure_message;
+        }
+        const std::string test_name =
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        LOG(VISUALIZE) << validation_engine->createValidationProtoSet(
+            TbotsProto::ValidationType::EVENTUALLY, test_name);
+        LOG(VISUALIZE) << validation_engine->createValidationProtoSet(
+            TbotsProto::ValidationType::ALWAYS, test_name);
+
+        validation_successful =
+            validation_successful && validation_engine->allEventuallyValidationsPassed();
+        has_terminating_validations =
+            has_terminating_validations || validation_engine->hasEventuallyValidations();
+    }
 
-    return terminating_function_validators.empty() ? false : validation_successful;
+    return has_terminating_validations && validation_successful;
 }
 
 void SimulatedErForceSimTestFixture::updateSensorFusion(
     std::shared_ptr<ErForceSimulator> simulator)
 {
+    if (use_ground_truth_world)
+    {
+        updateSensorFusionWithGroundTruth(simulator);
+        return;
+    }
+
     // TODO (#2419): remove this to re-enable sigfpe checks
     fedisableexcept(FE_INVALID | FE_OVERFLOW);
     auto ssl_wrapper_packets = simulator->getSSLWrapperPackets();
@@ -151,6 +186,48 @@ void SimulatedErForceSimTestFixture::updateSensorFusion(
     }
 }
 
+void SimulatedErForceSimTestFixture::updateSensorFusionWithGroundTruth(
+    std::shared_ptr<ErForceSimulator> simulator)
+{
+    const world::SimulatorState simulator_state = simulator->getSimulatorState();
+    const Timestamp timestamp                   = simulator->getTimestamp();
+    const Field field                           = simulator->getField();
+
+    const Ball ball = createBall(simulator_state.ball(), timestamp);
+    std::vector<Robot> yellow_robots;
+    for (const auto &sim_robot : simulator_state.yellow_robots())
+    {
+        yellow_robots.push_back(createRobot(sim_robot, timestamp));
+    }
+    std::vector<Robot> blue_robots;
+    for (const auto &sim_robot : simulator_state.blue_robots())
+    {
+        blue_robots.push_back(createRobot(sim_robot, timestamp));
+    }
+
+    google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus> yellow_robot_statuses;
+    for (const auto &msg : simulator->getYellowRobotStatuses())
+    {
+        *(yellow_robot_statuses.Add()) = msg;
+    }
+    google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus> blue_robot_statuses;
+    for (const auto &msg : simulator->getBlueRobotStatuses())
+    {
+        *(blue_robot_statuses.Add()) = msg;
+    }
+
+    friendly_sensor_fusion.processGroundTruth(
+        field, ball, yellow_robots, blue_robots,
+        friendly_thunderbots_config.sensor_fusion_config().friendly_color_yellow()
+            ? yellow_robot_statuses
+            : blue_robot_statuses);
+    enemy_sensor_fusion.processGroundTruth(
+        field, ball, yellow_robots, blue_robots,
+        enemy_thunderbots_config.sensor_fusion_config().friendly_color_yellow()
+            ? yellow_robot_statuses
+            : blue_robot_statuses);
+}
+
 void SimulatedErForceSimTestFixture::sleep(
     const std::chrono::steady_clock::time_point &wall_start_time,
     const Duration &desired_wall_tick_time)
@@ -168,6 +245,17 @@ void SimulatedErForceSimTestFixture::sleep(
     }
 }
 
+void SimulatedErForceSimTestFixture::runTest(
+    const TbotsProto::FieldType &field_type, const BallState &ball,
+    const std::vector<RobotStateWithId> &friendly_robots,
+    const std::vector<RobotStateWithId> &enemy_robots,
+    const TbotsProto::ValidationSpecSet &validation_spec_set, const Duration &timeout,
+    const bool ramping)
+{
+    validation_engine.emplace(validation_spec_set);
+    runTest(field_type, ball, friendly_robots, enemy_robots, {}, {}, timeout, ramping);
+}
+
 void SimulatedErForceSimTestFixture::runTest(
     const TbotsProto::FieldType &field_type, const BallState &ball,
     const std::vector<RobotStateWithId> &friendly_robots,
@@ -180,6 +268,18 @@ void SimulatedErForceSimTestFixture::runTest(
         Duration::fromSeconds(1.0 / SIMULATED_CAMERA_FPS);
 
     auto realism_config = ErForceSimulator::createDefaultRealismConfig();
+    realism_config->set_seed(TbotsGtestMain::simulation_seed);
+
+    std::optional<std::string> scenario_key =
+        createScenarioKey(field_type, ball, friendly_robots, enemy_robots, timeout,
+                          ramping, *realism_config);
+    ScenarioResultCache scenario_result_cache(TbotsGtestMain::scenario_result_cache_dir);
+    if (scenario_key && scenario_result_cache.hasPassed(*scenario_key))
+    {
+        GTEST_SKIP() << "Scenario " << *scenario_key << " already passed with code "
+                     << "version " << TbotsGtestMain::code_version;
+    }
+
     std::shared_ptr<ErForceSimulator> simulator(std::make_shared<ErForceSimulator>(
         field_type, create2021RobotConstants(), realism_config, ramping));
 
@@ -398,7 +498,10 @@ void SimulatedErForceSimTestFixture::runTest(
     }
 
 
-    if (!validation_functions_done && !terminating_validation_functions.empty())
+    const bool has_eventually_validations =
+        validation_engine && validation_engine->hasEventuallyValidations();
+    if (!validation_functions_done &&
+        (!terminating_validation_functions.empty() || has_eventually_validations))
     {
         std::string failure_message =
             "Not all validation functions passed within the timeout duration:\n";
@@ -409,8 +512,76 @@ void SimulatedErForceSimTestFixture::runTest(
                 failure_message += fun.currentErrorMessage() + std::string("\n");
             }
         }
+        if (validation_engine)
+        {
+            for (const std::string &pending_validation :
+                 validation_engine->getPendingEventuallyValidations())
+            {
+                failure_message += pending_validation + std::string("\n");
+            }
+        }
         ADD_FAILURE() << failure_message;
     }
+
+    if (scenario_key && !HasFailure())
+    {
+        scenario_result_cache.recordPass(*scenario_key);
+    }
+}
+
+std::optional<std::string> SimulatedErForceSimTestFixture::createScenarioKey(
+    const TbotsProto::FieldType &field_type, const BallState &ball,
+    const std::vector<RobotStateWithId> &friendly_robots,
+    const std::vector<RobotStateWithId> &enemy_robots, const Duration &timeout,
+    bool ramping, const RealismConfigErForce &realism_config) const
+{
+    // Only seeded simulations that are not slowed down or paused by a user are
+    // reproducible
+    if (TbotsGtestMain::scenario_result_cache_dir.empty() ||
+        TbotsGtestMain::code_version.empty() || realism_config.seed() == 0 ||
+        run_simulation_in_realtime || TbotsGtestMain::enable_visualizer)
+    {
+        return std::nullopt;
+    }
+
+    // The validation functions and the AI set up by the test are code, so they are
+    // identified by the name of the test together with the code version
+    const ::testing::TestInfo *test_info =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+
+    std::ostringstream scenario;
+    scenario << std::setprecision(17) << test_info->test_suite_name() << "."
+             << test_info->name() << "\n"
+             << TbotsProto::FieldType_Name(field_type) << "\n"
+             << "ball " << ball.position() << " " << ball.velocity() << " "
+             << ball.distanceFromGround() << "\n";
+    for (const auto &[robots, team] :
+         {std::make_pair(&friendly_robots, "friendly"),
+          std::make_pair(&enemy_robots, "enemy")})
+    {
+        for (const RobotStateWithId &robot : *robots)
+        {
+            scenario << team << " " << robot.id << " " << robot.robot_state.position()
+                     << " " << robot.robot_state.velocity() << " "
+                     << robot.robot_state.orientation().toRadians() << " "
+                     << robot.robot_state.angularVelocity().toRadians() << "\n";
+        }
+    }
+    scenario << "timeout " << timeout.toSeconds() << " ramping " << ramping
+             << " ground truth world " << use_ground_truth_world << "\n";
+
+    // Text format prints map fields in a deterministic order
+    for (const google::protobuf::Message *config :
+         std::initializer_list<const google::protobuf::Message *>{
+             &realism_config, &friendly_thunderbots_config, &enemy_thunderbots_config})
+    {
+        std::string config_text;
+        google::protobuf::TextFormat::PrintToString(*config, &config_text);
+        scenario << config_text;
+    }
+
+    return ScenarioResultCache::createScenarioKey(TbotsGtestMain::code_version,
+                                                  scenario.str(), realism_config.seed());
 }
 
 void SimulatedErForceSimTestFixture::registerFriendlyTickTime(double tick_time_ms)
@@ -536,7 +707,8 @@ bool SimulatedErForceSimTestFixture::tickTest(
         LOG(VISUALIZE) << *createWorld(*friendly_world);
 
         validation_functions_done = validateAndCheckCompletion(
-            terminating_function_validators, non_terminating_function_validators);
+            terminating_function_validators, non_terminating_function_validators,
+            validation_engine, *friendly_world);
         if (validation_functions_done)
         {
             return validation_functions_done;
@@ -4,8 +4,10 @@
 #include "shared/test_util/tbots_gtest_main.h"
 #include "software/ai/hl/stp/play/halt_play/halt_play.h"
 #include "software/sensor_fusion/sensor_fusion.h"
+#include "software/simulated_tests/scenario_result_cache.h"
 #include "software/simulated_tests/validation/non_terminating_function_validator.h"
 #include "software/simulated_tests/validation/terminating_function_validator.h"
+#include "software/simulated_tests/validation/validation_engine.h"
 #include "software/simulation/er_force_simulator.h"
 
 /**
@@ -13,6 +15,15 @@
  * an easy interface to set up robots on the field, and then validate how the world
  * changes over time during simulation. This allows us to easily write tests for
  * the AI's behaviour.
+ *
+ * The AI is ticked synchronously with the simulation, and the simulation is seeded
+ * with TbotsGtestMain::simulation_seed, so a test run with the same seed and the same
+ * code always simulates the same game. If a scenario result cache is configured,
+ * scenarios that already passed with the same code version and seed are skipped.
+ *
+ * Tests can opt in to building the Worlds from the exact state of the simulation
+ * instead of filtering simulated vision by setting use_ground_truth_world, which
+ * is also enabled for every test with TbotsGtestMain::use_ground_truth_world.
  */
 class SimulatedErForceSimTestFixture : public ::testing::Test
 {
@@ -54,6 +65,7 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
      * @param timeout The maximum duration of simulated time to run the test for.
      * If the test has not passed by the time this timeout is exceeded, the test
      * will fail.
+     * @param ramping Whether robots should ramp their velocities in simulation
      */
     void runTest(
         const TbotsProto::FieldType &field_type, const BallState &ball,
@@ -63,6 +75,30 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
         const std::vector<ValidationFunction> &non_terminating_validation_functions,
         const Duration &timeout, const bool ramping = false);
 
+    /**
+     * Starts the simulation using the current state of the simulator, and checks the
+     * given validations with a ValidationEngine on each new state of the World. The
+     * eventually validations are treated like terminating validation functions, and
+     * the always validations like non-terminating validation functions.
+     *
+     * @param field_type The type of field to run the test on
+     * @param ball The ball state to run the test with
+     * @param friendly_robots The friendly robot states with ID to run the test with
+     * @param enemy_robots The enemy robot states with ID to run the test with
+     * @param validation_spec_set The validations to check during the test
+     * @param timeout The maximum duration of simulated time to run the test for.
+     * If the test has not passed by the time this timeout is exceeded, the test
+     * will fail.
+     * @param ramping Whether robots should ramp their velocities in simulation
+     *
+     * @throws std::invalid_argument if a validation does not have a predicate
+     */
+    void runTest(const TbotsProto::FieldType &field_type, const BallState &ball,
+                 const std::vector<RobotStateWithId> &friendly_robots,
+                 const std::vector<RobotStateWithId> &enemy_robots,
+                 const TbotsProto::ValidationSpecSet &validation_spec_set,
+                 const Duration &timeout, const bool ramping = false);
+
     /**
      * Registers a new tick time for calculating friendly tick time statistics
      *
@@ -81,6 +117,11 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
     TbotsProto::ThunderbotsConfig friendly_thunderbots_config;
     TbotsProto::ThunderbotsConfig enemy_thunderbots_config;
 
+    // If true, SensorFusion builds the Worlds from the exact state of the simulation,
+    // skipping simulated vision and the filters. Tests that do not test the filters
+    // can set this to run faster and without vision noise
+    bool use_ground_truth_world;
+
    private:
     /**
      * Runs one tick of the test and checks if the validation function is done
@@ -104,6 +145,22 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
                   double &ball_velocity_diff, std::vector<double> &robots_displacement,
                   std::vector<double> &robots_velocity_diff);
 
+    /**
+     * Creates the key of the scenario run by runTest in the scenario result cache
+     *
+     * @param field_type, ball, friendly_robots, enemy_robots, timeout, ramping The
+     * arguments of runTest
+     * @param realism_config The realism config of the simulator
+     *
+     * @return the key of the scenario, or std::nullopt if the scenario result cache
+     * is not configured or the scenario is not reproducible
+     */
+    std::optional<std::string> createScenarioKey(
+        const TbotsProto::FieldType &field_type, const BallState &ball,
+        const std::vector<RobotStateWithId> &friendly_robots,
+        const std::vector<RobotStateWithId> &enemy_robots, const Duration &timeout,
+        bool ramping, const RealismConfigErForce &realism_config) const;
+
     /**
      * Sets configs that are common to the friendly and enemy teams
      *
@@ -120,6 +177,14 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
      */
     void updateSensorFusion(std::shared_ptr<ErForceSimulator> simulator);
 
+    /**
+     * Updates SensorFusion with the exact state of the ErForceSimulator, instead of
+     * the vision packets it simulates
+     *
+     * @param simulator The simulator to update sensor fusion with
+     */
+    void updateSensorFusionWithGroundTruth(std::shared_ptr<ErForceSimulator> simulator);
+
     /**
      * Updates primitives in the simulator based on the new world
      *
@@ -139,21 +204,23 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
     virtual std::optional<TbotsProto::PlayInfo> getPlayInfo() = 0;
 
     /**
-     * Runs the given function validators and returns whether or not the
-     * FunctionValidators have completed (Note: completed does not necessarily
+     * Runs the given function validators and validation engine and returns whether or
+     * not the validations have completed (Note: completed does not necessarily
      * mean passed).
      *
      * @param terminating_function_validators The TerminatingFunctionValidators to check
      * @param non_terminating_function_validators The NonTerminatingFunctionValidators to
      * check
+     * @param validation_engine The ValidationEngine to check, if any
+     * @param world The World to check the ValidationEngine against
      *
-     * @return true if there is at least one TerminatingFunctionValidator and all
-     * TerminatingFunctionValidators have completed, and false otherwise
+     * @return true if there is at least one TerminatingFunctionValidator or eventually
+     * validation and all of them have completed, and false otherwise
      */
     static bool validateAndCheckCompletion(
         std::vector<TerminatingFunctionValidator> &terminating_function_validators,
-        std::vector<NonTerminatingFunctionValidator>
-            &non_terminating_function_validators);
+        std::vector<NonTerminatingFunctionValidator> &non_terminating_function_validators,
+        std::optional<ValidationEngine> &validation_engine, const World &world);
 
     /**
      * Puts the current thread to sleep such that each simulation step will take
@@ -178,6 +245,8 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
 
     std::vector<NonTerminatingFunctionValidator> non_terminating_function_validators;
     std::vector<TerminatingFunctionValidator> terminating_function_validators;
+    // Checks the validations of the test if it was run with a ValidationSpecSet
+    std::optional<ValidationEngine> validation_engine;
 
     // If false, runs the simulation as fast as possible.
     // If true, introduces artificial delay so that simulation
@@ -6,6 +6,7 @@ import sys
 import os
 
 import pytest
+import software.python_bindings as tbots_cpp
 from proto.import_all_protos import *
 
 from software.simulated_tests import validation
@@ -98,6 +99,7 @@ class SimulatedTestRunner(TbotsTestRunner):
         tick_duration_s=0.0166,  # Default to 60hz
         ci_cmd_with_delay=[],
         run_till_end=True,
+        validation_spec_set=None,
     ):
         """Run a test
 
@@ -116,9 +118,18 @@ class SimulatedTestRunner(TbotsTestRunner):
                                   ]
         :param run_till_end: If true, test runs till the end even if eventually validation passes
                              If false, test stops once eventually validation passes and fails if time out
+        :param validation_spec_set: A ValidationSpecSet of validations that are checked
+                                    by the native validation engine, in addition to the
+                                    validation sequence sets
         """
         time_elapsed_s = 0
 
+        validation_engine = (
+            tbots_cpp.ValidationEngine(validation_spec_set)
+            if validation_spec_set
+            else None
+        )
+
         eventually_validation_failure_msg = "Test Timed Out"
 
         while time_elapsed_s < test_timeout_s:
@@ -185,6 +196,20 @@ class SimulatedTestRunner(TbotsTestRunner):
                 always_validation_sequence_set,
             )
 
+            # Add the results of the validation spec set
+            if validation_engine:
+                validation_engine.validate(tbots_cpp.World(world))
+                eventually_validation_proto_set.validations.extend(
+                    validation_engine.createValidationProtoSet(
+                        ValidationType.EVENTUALLY, self.test_name
+                    ).validations
+                )
+                always_validation_proto_set.validations.extend(
+                    validation_engine.createValidationProtoSet(
+                        ValidationType.ALWAYS, self.test_name
+                    ).validations
+                )
+
             # Set the test name
             eventually_validation_proto_set.test_name = self.test_name
             always_validation_proto_set.test_name = self.test_name
@@ -236,6 +261,7 @@ class SimulatedTestRunner(TbotsTestRunner):
         index=0,
         ci_cmd_with_delay=[],
         run_till_end=True,
+        validation_spec_set=None,
         **kwargs,
     ):
         """Helper function to run a test, with thunderscope if enabled
@@ -254,6 +280,8 @@ class SimulatedTestRunner(TbotsTestRunner):
                                   ]
         :param run_till_end: If true, test runs till the end even if eventually validation passes
                              If false, test stops once eventually validation passes and fails if time out
+        :param validation_spec_set: A ValidationSpecSet of validations that are checked
+                                    by the native validation engine, if any
         """
         test_timeout_duration = (
             test_timeout_s[index] if type(test_timeout_s) == list else test_timeout_s
@@ -281,6 +309,7 @@ class SimulatedTestRunner(TbotsTestRunner):
                     tick_duration_s,
                     ci_cmd_with_delay,
                     run_till_end,
+                    validation_spec_set,
                 ],
             )
             run_sim_thread.start()
@@ -299,6 +328,7 @@ class SimulatedTestRunner(TbotsTestRunner):
                 tick_duration_s,
                 ci_cmd_with_delay=ci_cmd_with_delay,
                 run_till_end=run_till_end,
+                validation_spec_set=validation_spec_set,
             )
 
 
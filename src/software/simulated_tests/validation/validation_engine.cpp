@@ -0,0 +1,325 @@
+#include "software/simulated_tests/validation/validation_engine.h"
+
+#include <set>
+#include <stdexcept>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/util/variant_visitor/variant_visitor.h"
+
+namespace
+{
+std::vector<Polygon> createPolygons(
+    const google::protobuf::RepeatedPtrField<TbotsProto::Polygon>& polygon_protos)
+{
+    std::vector<Polygon> polygons;
+    polygons.reserve(polygon_protos.size());
+    for (const TbotsProto::Polygon& polygon_proto : polygon_protos)
+    {
+        polygons.emplace_back(createPolygon(polygon_proto));
+    }
+    return polygons;
+}
+
+bool containsPoint(const std::vector<Polygon>& regions, const Point& point)
+{
+    return std::any_of(regions.begin(), regions.end(), [&point](const Polygon& region)
+                       { return contains(region, point); });
+}
+}  // namespace
+
+ValidationEngine::ValidationEngine(
+    const TbotsProto::ValidationSpecSet& validation_spec_set)
+    : eventually_sequences(
+          compileSequences(validation_spec_set.eventually_validation_sequences(),
+                           TbotsProto::ValidationType::EVENTUALLY)),
+      always_sequences(compileSequences(validation_spec_set.always_validation_sequences(),
+                                        TbotsProto::ValidationType::ALWAYS))
+{
+}
+
+void ValidationEngine::validate(const World& world)
+{
+    for (auto& sequences : {&eventually_sequences, &always_sequences})
+    {
+        for (ValidationSequence& sequence : *sequences)
+        {
+            for (Validation& validation : sequence.validations)
+            {
+                validation.last_status.reset();
+            }
+        }
+    }
+
+    for (ValidationSequence& sequence : eventually_sequences)
+    {
+        // A passing validation is done, so check the next one on the same World
+        while (sequence.num_passed < sequence.validations.size() &&
+               check(sequence.validations[sequence.num_passed], world) ==
+                   TbotsProto::ValidationStatus::PASSING)
+        {
+            sequence.num_passed++;
+        }
+    }
+
+    for (ValidationSequence& sequence : always_sequences)
+    {
+        for (Validation& validation : sequence.validations)
+        {
+            check(validation, world);
+        }
+    }
+}
+
+bool ValidationEngine::hasEventuallyValidations() const
+{
+    return std::any_of(eventually_sequences.begin(), eventually_sequences.end(),
+                       [](const ValidationSequence& sequence)
+                       { return !sequence.validations.empty(); });
+}
+
+bool ValidationEngine::allEventuallyValidationsPassed() const
+{
+    return std::all_of(eventually_sequences.begin(), eventually_sequences.end(),
+                       [](const ValidationSequence& sequence)
+                       { return sequence.num_passed == sequence.validations.size(); });
+}
+
+std::vector<std::string> ValidationEngine::getAlwaysValidationFailures() const
+{
+    std::vector<std::string> failure_messages;
+    for (const ValidationSequence& sequence : always_sequences)
+    {
+        for (const Validation& validation : sequence.validations)
+        {
+            if (validation.last_status == TbotsProto::ValidationStatus::FAILING)
+            {
+                failure_messages.emplace_back(validation.failure_message);
+            }
+        }
+    }
+    return failure_messages;
+}
+
+std::vector<std::string> ValidationEngine::getPendingEventuallyValidations() const
+{
+    std::vector<std::string> failure_messages;
+    for (const ValidationSequence& sequence : eventually_sequences)
+    {
+        if (sequence.num_passed < sequence.validations.size())
+        {
+            failure_messages.emplace_back(
+                sequence.validations[sequence.num_passed].failure_message);
+        }
+    }
+    return failure_messages;
+}
+
+TbotsProto::ValidationProtoSet ValidationEngine::createValidationProtoSet(
+    TbotsProto::ValidationType validation_type, const std::string& test_name) const
+{
+    TbotsProto::ValidationProtoSet validation_proto_set;
+    validation_proto_set.set_test_name(test_name);
+    validation_proto_set.set_validation_type(validation_type);
+
+    const std::vector<ValidationSequence>& sequences =
+        validation_type == TbotsProto::ValidationType::EVENTUALLY ? eventually_sequences
+                                                                  : always_sequences;
+    for (const ValidationSequence& sequence : sequences)
+    {
+        for (const Validation& validation : sequence.validations)
+        {
+            if (!validation.last_status)
+            {
+                continue;
+            }
+
+            TbotsProto::ValidationProto* validation_proto =
+                validation_proto_set.add_validations();
+            validation_proto->set_failure_msg(validation.failure_message);
+            validation_proto->set_status(*validation.last_status);
+            TbotsProto::ValidationGeometry* geometry =
+                validation_proto->mutable_geometry();
+            for (const Polygon& region : validation.geometry)
+            {
+                *geometry->add_polygons() = *createPolygonProto(region);
+            }
+        }
+    }
+
+    return validation_proto_set;
+}
+
+std::vector<ValidationEngine::ValidationSequence> ValidationEngine::compileSequences(
+    const google::protobuf::RepeatedPtrField<TbotsProto::ValidationSpecSequence>&
+        sequence_specs,
+    TbotsProto::ValidationType validation_type)
+{
+    const std::string type_name =
+        validation_type == TbotsProto::ValidationType::EVENTUALLY ? "Eventually"
+                                                                  : "Always";
+
+    std::vector<ValidationSequence> sequences;
+    sequences.reserve(sequence_specs.size());
+    for (const TbotsProto::ValidationSpecSequence& sequence_spec : sequence_specs)
+    {
+        ValidationSequence sequence{.validations = {}, .num_passed = 0};
+        for (const TbotsProto::ValidationSpec& validation_spec :
+             sequence_spec.validations())
+        {
+            const TbotsProto::ValidationPredicate& predicate_spec =
+                validation_spec.predicate();
+
+            std::vector<Polygon> geometry;
+            if (predicate_spec.has_ball_in_regions())
+            {
+                geometry = createPolygons(predicate_spec.ball_in_regions().regions());
+            }
+            else if (predicate_spec.has_friendly_robots_in_regions())
+            {
+                geometry =
+                    createPolygons(predicate_spec.friendly_robots_in_regions().regions());
+            }
+
+            const std::string failure_message =
+                type_name + (validation_spec.negate() ? " not " : " ") +
+                predicate_spec.ShortDebugString() + " failed";
+
+            sequence.validations.push_back(Validation{
+                .predicate       = compilePredicate(predicate_spec),
+                .negate          = validation_spec.negate(),
+                .failure_message = failure_message,
+                .geometry        = std::move(geometry),
+                .last_status     = std::nullopt,
+            });
+        }
+        sequences.emplace_back(std::move(sequence));
+    }
+    return sequences;
+}
+
+ValidationEngine::Predicate ValidationEngine::compilePredicate(
+    const TbotsProto::ValidationPredicate& predicate_spec)
+{
+    switch (predicate_spec.predicate_case())
+    {
+        case TbotsProto::ValidationPredicate::kBallInRegions:
+            return BallInRegions{
+                .regions = createPolygons(predicate_spec.ball_in_regions().regions())};
+        case TbotsProto::ValidationPredicate::kFriendlyRobotsInRegions:
+        {
+            const auto& robots_in_regions = predicate_spec.friendly_robots_in_regions();
+            std::optional<RobotId> robot_id;
+            if (robots_in_regions.has_robot_id())
+            {
+                robot_id = robots_in_regions.robot_id();
+            }
+            return FriendlyRobotsInRegions{
+                .regions        = createPolygons(robots_in_regions.regions()),
+                .min_num_robots = robots_in_regions.min_num_robots(),
+                .robot_id       = robot_id};
+        }
+        case TbotsProto::ValidationPredicate::kBallSpeedAtOrAbove:
+            return BallSpeedAtOrAbove{
+                .speed_threshold_m_per_s =
+                    predicate_spec.ball_speed_at_or_above().speed_threshold_m_per_s()};
+        case TbotsProto::ValidationPredicate::kFriendlyRobotSpeedAtOrAbove:
+        {
+            const auto& robot_speed = predicate_spec.friendly_robot_speed_at_or_above();
+            std::optional<RobotId> robot_id;
+            if (robot_speed.has_robot_id())
+            {
+                robot_id = robot_speed.robot_id();
+            }
+            return FriendlyRobotSpeedAtOrAbove{
+                .speed_threshold_m_per_s = robot_speed.speed_threshold_m_per_s(),
+                .robot_id                = robot_id};
+        }
+        case TbotsProto::ValidationPredicate::kFriendlyHasBallPossession:
+        {
+            const auto& ball_possession = predicate_spec.friendly_has_ball_possession();
+            return FriendlyHasBallPossession{.tolerance_m =
+                                                 ball_possession.tolerance_m()};
+        }
+        case TbotsProto::ValidationPredicate::kFriendlyTeamScored:
+            return FriendlyTeamScored{};
+        case TbotsProto::ValidationPredicate::kEnemyTeamScored:
+            return EnemyTeamScored{};
+        case TbotsProto::ValidationPredicate::PREDICATE_NOT_SET:
+            break;
+    }
+
+    throw std::invalid_argument("Validation does not have a predicate");
+}
+
+TbotsProto::ValidationStatus ValidationEngine::check(Validation& validation,
+                                                     const World& world)
+{
+    const bool passing = evaluate(validation.predicate, world) != validation.negate;
+    validation.last_status = passing ? TbotsProto::ValidationStatus::PASSING
+                                     : TbotsProto::ValidationStatus::FAILING;
+    return *validation.last_status;
+}
+
+bool ValidationEngine::evaluate(const Predicate& predicate, const World& world)
+{
+    return std::visit(
+        overload{
+            [&world](const BallInRegions& ball_in_regions)
+            { return containsPoint(ball_in_regions.regions, world.ball().position()); },
+            [&world](const FriendlyRobotsInRegions& robots_in_regions)
+            {
+                std::set<RobotId> robots_in_regions_ids;
+                for (const Robot& robot : world.friendlyTeam().getAllRobots())
+                {
+                    if ((!robots_in_regions.robot_id ||
+                         robot.id() == *robots_in_regions.robot_id) &&
+                        containsPoint(robots_in_regions.regions, robot.position()))
+                    {
+                        robots_in_regions_ids.insert(robot.id());
+                    }
+                }
+                return robots_in_regions_ids.size() >= robots_in_regions.min_num_robots;
+            },
+            [&world](const BallSpeedAtOrAbove& ball_speed)
+            {
+                return world.ball().velocity().length() >=
+                       ball_speed.speed_threshold_m_per_s;
+            },
+            [&world](const FriendlyRobotSpeedAtOrAbove& robot_speed)
+            {
+                auto is_at_or_above_speed = [&robot_speed](const Robot& robot)
+                {
+                    return robot.velocity().length() >=
+                           robot_speed.speed_threshold_m_per_s;
+                };
+
+                // A robot that is not on the field is not moving fast enough
+                if (robot_speed.robot_id)
+                {
+                    std::optional<Robot> robot =
+                        world.friendlyTeam().getRobotById(*robot_speed.robot_id);
+                    return robot.has_value() && is_at_or_above_speed(robot.value());
+                }
+                const std::vector<Robot>& robots = world.friendlyTeam().getAllRobots();
+                return !robots.empty() &&
+                       std::all_of(robots.begin(), robots.end(), is_at_or_above_speed);
+            },
+            [&world](const FriendlyHasBallPossession& ball_possession)
+            {
+                const std::vector<Robot>& robots = world.friendlyTeam().getAllRobots();
+                return std::any_of(robots.begin(), robots.end(),
+                                   [&world, &ball_possession](const Robot& robot)
+                                   {
+                                       return robot.isNearDribbler(
+                                           world.ball().position(),
+                                           ball_possession.tolerance_m);
+                                   });
+            },
+            [&world](const FriendlyTeamScored&)
+            { return contains(world.field().enemyGoal(), world.ball().position()); },
+            [&world](const EnemyTeamScored&)
+            { return contains(world.field().friendlyGoal(), world.ball().position()); },
+        },
+        predicate);
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "proto/validation.pb.h"
+#include "software/geom/polygon.h"
+#include "software/world/world.h"
+
+/**
+ * Checks the validations of a TbotsProto::ValidationSpecSet against each new World of a
+ * test.
+ *
+ * The predicates of the validations are compiled into native geometry once, when the
+ * engine is created, and are then evaluated directly against the World on every tick.
+ * Unlike ValidationFunctions, the validations do not run as coroutines, so checking
+ * them does not switch contexts, and they do not have to be evaluated in Python.
+ *
+ * The validations are checked like the Python validations of the simulated tests:
+ * - The validations of an eventually sequence are checked in order. A validation that
+ *   passes is done, and the validations after a failing validation are not checked
+ *   until it passes. Every eventually validation has to pass before the end of the test
+ * - Every always validation is checked on every tick, and has to pass on every tick
+ */
+class ValidationEngine
+{
+   public:
+    ValidationEngine() = delete;
+
+    /**
+     * Creates a ValidationEngine that checks the given validations
+     *
+     * @param validation_spec_set The validations to check
+     *
+     * @throws std::invalid_argument if a validation does not have a predicate
+     */
+    explicit ValidationEngine(const TbotsProto::ValidationSpecSet& validation_spec_set);
+
+    /**
+     * Checks the validations against a new World
+     *
+     * @param world The World to check the validations against
+     */
+    void validate(const World& world);
+
+    /**
+     * Returns whether there are any eventually validations
+     *
+     * @return true if there is at least one eventually validation, false otherwise
+     */
+    bool hasEventuallyValidations() const;
+
+    /**
+     * Returns whether all eventually validations have passed
+     *
+     * @return true if all eventually validations have passed, false otherwise
+     */
+    bool allEventuallyValidationsPassed() const;
+
+    /**
+     * Gets the failure messages of the always validations that failed the last time
+     * the validations were checked
+     *
+     * @return the failure messages of the failing always validations
+     */
+    std::vector<std::string> getAlwaysValidationFailures() const;
+
+    /**
+     * Gets the failure messages of the eventually validations that each sequence is
+     * still waiting to pass
+     *
+     * @return the failure messages of the pending eventually validations
+     */
+    std::vector<std::string> getPendingEventuallyValidations() const;
+
+    /**
+     * Creates a ValidationProtoSet with the result of each validation of the given type
+     * that was checked the last time the validations were checked, to be visualized
+     *
+     * @param validation_type The type of validations to include
+     * @param test_name The name of the test the validations are checked in
+     *
+     * @return the ValidationProtoSet of the validations
+     */
+    TbotsProto::ValidationProtoSet createValidationProtoSet(
+        TbotsProto::ValidationType validation_type, const std::string& test_name) const;
+
+   private:
+    struct BallInRegions
+    {
+        std::vector<Polygon> regions;
+    };
+
+    struct FriendlyRobotsInRegions
+    {
+        std::vector<Polygon> regions;
+        unsigned int min_num_robots;
+        std::optional<RobotId> robot_id;
+    };
+
+    struct BallSpeedAtOrAbove
+    {
+        double speed_threshold_m_per_s;
+    };
+
+    struct FriendlyRobotSpeedAtOrAbove
+    {
+        double speed_threshold_m_per_s;
+        std::optional<RobotId> robot_id;
+    };
+
+    struct FriendlyHasBallPossession
+    {
+        double tolerance_m;
+    };
+
+    struct FriendlyTeamScored
+    {
+    };
+
+    struct EnemyTeamScored
+    {
+    };
+
+    using Predicate =
+        std::variant<BallInRegions, FriendlyRobotsInRegions, BallSpeedAtOrAbove,
+                     FriendlyRobotSpeedAtOrAbove, FriendlyHasBallPossession,
+                     FriendlyTeamScored, EnemyTeamScored>;
+
+    /**
+     * A compiled validation, with its result the last time it was checked
+     */
+    struct Validation
+    {
+        Predicate predicate;
+        bool negate;
+        std::string failure_message;
+        // The regions to visualize for the validation
+        std::vector<Polygon> geometry;
+        std::optional<TbotsProto::ValidationStatus> last_status;
+    };
+
+    /**
+     * A sequence of compiled validations, with the index of the first validation of the
+     * sequence that has not passed yet
+     */
+    struct ValidationSequence
+    {
+        std::vector<Validation> validations;
+        std::size_t num_passed;
+    };
+
+    /**
+     * Compiles the validation sequences of a ValidationSpecSet
+     *
+     * @param sequence_specs The validation sequences to compile
+     * @param validation_type The type of the validations, used in failure messages
+     *
+     * @return the compiled validation sequences
+     */
+    static std::vector<ValidationSequence> compileSequences(
+        const google::protobuf::RepeatedPtrField<TbotsProto::ValidationSpecSequence>&
+            sequence_specs,
+        TbotsProto::ValidationType validation_type);
+
+    /**
+     * Compiles the predicate of a validation
+     *
+     * @param predicate_spec The predicate to compile
+     *
+     * @return the compiled predicate
+     */
+    static Predicate compilePredicate(
+        const TbotsProto::ValidationPredicate& predicate_spec);
+
+    /**
+     * Checks a validation against a World and records its status
+     *
+     * @param validation The validation to check
+     * @param world The World to check the validation against
+     *
+     * @return the status of the validation
+     */
+    static TbotsProto::ValidationStatus check(Validation& validation, const World& world);
+
+    /**
+     * Evaluates a predicate against a World
+     *
+     * @param predicate The predicate to evaluate
+     * @param world The World to evaluate the predicate against
+     *
+     * @return whether the predicate is true for the World
+     */
+    static bool evaluate(const Predicate& predicate, const World& world);
+
+    std::vector<ValidationSequence> eventually_sequences;
+    std::vector<ValidationSequence> always_sequences;
+};
@@ -0,0 +1,207 @@
+#include "software/simulated_tests/validation/validation_engine.h"
+
+#include <gtest/gtest.h>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "software/test_util/test_util.h"
+
+class ValidationEngineTest : public testing::Test
+{
+   protected:
+    /**
+     * Adds a validation that the ball is in the square around the origin to the given
+     * sequence
+     *
+     * @param sequence The sequence to add the validation to
+     * @param negate Whether the validation should be negated
+     */
+    static void addBallInCenterValidation(TbotsProto::ValidationSpecSequence* sequence,
+                                          bool negate = false)
+    {
+        TbotsProto::ValidationSpec* validation = sequence->add_validations();
+        validation->set_negate(negate);
+        *validation->mutable_predicate()->mutable_ball_in_regions()->add_regions() =
+            *createPolygonProto(CENTER_SQUARE);
+    }
+
+    /**
+     * Adds a validation that the ball is moving at least 1 m/s to the given sequence
+     *
+     * @param sequence The sequence to add the validation to
+     */
+    static void addBallMovingValidation(TbotsProto::ValidationSpecSequence* sequence)
+    {
+        sequence->add_validations()
+            ->mutable_predicate()
+            ->mutable_ball_speed_at_or_above()
+            ->set_speed_threshold_m_per_s(1.0);
+    }
+
+    inline static const Polygon CENTER_SQUARE =
+        Polygon({Point(-1, -1), Point(1, -1), Point(1, 1), Point(-1, 1)});
+
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    TbotsProto::ValidationSpecSet validation_spec_set;
+};
+
+TEST_F(ValidationEngineTest, eventually_sequence_passes_validations_in_order)
+{
+    TbotsProto::ValidationSpecSequence* sequence =
+        validation_spec_set.add_eventually_validation_sequences();
+    addBallMovingValidation(sequence);
+    addBallInCenterValidation(sequence);
+    ValidationEngine engine(validation_spec_set);
+
+    ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
+    engine.validate(*world);
+
+    EXPECT_TRUE(engine.hasEventuallyValidations());
+    EXPECT_FALSE(engine.allEventuallyValidationsPassed());
+    ASSERT_EQ(1, engine.getPendingEventuallyValidations().size());
+    EXPECT_NE(std::string::npos,
+              engine.getPendingEventuallyValidations()[0].find("ball_speed_at_or_above"));
+
+    ::TestUtil::setBallPosition(world, Point(3, 0), Timestamp::fromSeconds(1));
+    ::TestUtil::setBallVelocity(world, Vector(2, 0), Timestamp::fromSeconds(1));
+    engine.validate(*world);
+
+    EXPECT_FALSE(engine.allEventuallyValidationsPassed());
+    ASSERT_EQ(1, engine.getPendingEventuallyValidations().size());
+    EXPECT_NE(std::string::npos,
+              engine.getPendingEventuallyValidations()[0].find("ball_in_regions"));
+
+    ::TestUtil::setBallPosition(world, Point(0.5, 0), Timestamp::fromSeconds(2));
+    ::TestUtil::setBallVelocity(world, Vector(0, 0), Timestamp::fromSeconds(2));
+    engine.validate(*world);
+
+    EXPECT_TRUE(engine.allEventuallyValidationsPassed());
+    EXPECT_TRUE(engine.getPendingEventuallyValidations().empty());
+}
+
+TEST_F(ValidationEngineTest, eventually_sequence_passes_all_validations_on_one_world)
+{
+    TbotsProto::ValidationSpecSequence* sequence =
+        validation_spec_set.add_eventually_validation_sequences();
+    addBallMovingValidation(sequence);
+    addBallInCenterValidation(sequence);
+    ValidationEngine engine(validation_spec_set);
+
+    ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
+    ::TestUtil::setBallVelocity(world, Vector(0, 2), Timestamp::fromSeconds(0));
+    engine.validate(*world);
+
+    EXPECT_TRUE(engine.allEventuallyValidationsPassed());
+}
+
+TEST_F(ValidationEngineTest, always_validation_fails_on_every_failing_world)
+{
+    addBallInCenterValidation(validation_spec_set.add_always_validation_sequences(),
+                              true);
+    ValidationEngine engine(validation_spec_set);
+
+    ::TestUtil::setBallPosition(world, Point(3, 0), Timestamp::fromSeconds(0));
+    engine.validate(*world);
+
+    EXPECT_FALSE(engine.hasEventuallyValidations());
+    EXPECT_TRUE(engine.getAlwaysValidationFailures().empty());
+
+    ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(1));
+    engine.validate(*world);
+
+    ASSERT_EQ(1, engine.getAlwaysValidationFailures().size());
+    EXPECT_EQ(0, engine.getAlwaysValidationFailures()[0].find("Always not"));
+
+    ::TestUtil::setBallPosition(world, Point(3, 0), Timestamp::fromSeconds(2));
+    engine.validate(*world);
+
+    EXPECT_TRUE(engine.getAlwaysValidationFailures().empty());
+}
+
+TEST_F(ValidationEngineTest, friendly_robots_in_regions_counts_robots_in_regions)
+{
+    TbotsProto::ValidationSpec* validation =
+        validation_spec_set.add_always_validation_sequences()->add_validations();
+    TbotsProto::FriendlyRobotsInRegionsPredicate* robots_in_regions =
+        validation->mutable_predicate()->mutable_friendly_robots_in_regions();
+    *robots_in_regions->add_regions() = *createPolygonProto(CENTER_SQUARE);
+    robots_in_regions->set_min_num_robots(2);
+    ValidationEngine engine(validation_spec_set);
+
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0), Point(3, 0)},
+                                          Timestamp::fromSeconds(0));
+    engine.validate(*world);
+
+    EXPECT_EQ(1, engine.getAlwaysValidationFailures().size());
+
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0), Point(0.5, 0.5)},
+                                          Timestamp::fromSeconds(1));
+    engine.validate(*world);
+
+    EXPECT_TRUE(engine.getAlwaysValidationFailures().empty());
+}
+
+TEST_F(ValidationEngineTest, robot_speed_fails_without_robot_to_check)
+{
+    TbotsProto::ValidationSpecSequence* sequence =
+        validation_spec_set.add_always_validation_sequences();
+    sequence->add_validations()
+        ->mutable_predicate()
+        ->mutable_friendly_robot_speed_at_or_above()
+        ->set_speed_threshold_m_per_s(0.0);
+    TbotsProto::FriendlyRobotSpeedAtOrAbovePredicate* robot_speed =
+        validation_spec_set.add_always_validation_sequences()
+            ->add_validations()
+            ->mutable_predicate()
+            ->mutable_friendly_robot_speed_at_or_above();
+    robot_speed->set_speed_threshold_m_per_s(0.0);
+    robot_speed->set_robot_id(1);
+    ValidationEngine engine(validation_spec_set);
+
+    engine.validate(*world);
+
+    EXPECT_EQ(2, engine.getAlwaysValidationFailures().size());
+
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0)},
+                                          Timestamp::fromSeconds(0));
+    engine.validate(*world);
+
+    ASSERT_EQ(1, engine.getAlwaysValidationFailures().size());
+    EXPECT_NE(std::string::npos,
+              engine.getAlwaysValidationFailures()[0].find("robot_id: 1"));
+
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0), Point(1, 0)},
+                                          Timestamp::fromSeconds(1));
+    engine.validate(*world);
+
+    EXPECT_TRUE(engine.getAlwaysValidationFailures().empty());
+}
+
+TEST_F(ValidationEngineTest, validation_proto_set_has_status_and_geometry)
+{
+    addBallInCenterValidation(validation_spec_set.add_eventually_validation_sequences());
+    addBallInCenterValidation(validation_spec_set.add_always_validation_sequences());
+    ValidationEngine engine(validation_spec_set);
+
+    ::TestUtil::setBallPosition(world, Point(3, 0), Timestamp::fromSeconds(0));
+    engine.validate(*world);
+
+    TbotsProto::ValidationProtoSet eventually_proto_set = engine.createValidationProtoSet(
+        TbotsProto::ValidationType::EVENTUALLY, "test");
+    EXPECT_TRUE(eventually_proto_set.IsInitialized());
+    EXPECT_EQ("test", eventually_proto_set.test_name());
+    ASSERT_EQ(1, eventually_proto_set.validations_size());
+    EXPECT_EQ(TbotsProto::ValidationType::EVENTUALLY,
+              eventually_proto_set.validation_type());
+    EXPECT_EQ(TbotsProto::ValidationStatus::FAILING,
+              eventually_proto_set.validations(0).status());
+    ASSERT_EQ(1, eventually_proto_set.validations(0).geometry().polygons_size());
+    EXPECT_EQ(CENTER_SQUARE,
+              createPolygon(eventually_proto_set.validations(0).geometry().polygons(0)));
+}
+
+TEST_F(ValidationEngineTest, validation_without_predicate_throws)
+{
+    validation_spec_set.add_always_validation_sequences()->add_validations();
+
+    EXPECT_THROW(ValidationEngine engine(validation_spec_set), std::invalid_argument);
+}
@@ -3,6 +3,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include "extlibs/er_force_sim/src/protobuf/robot.h"
@@ -13,6 +14,7 @@
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/robot_status_msg.pb.h"
 #include "software/logger/logger.h"
+#include "software/metrics/latency_trace.h"
 #include "software/physics/velocity_conversion_util.h"
 #include "software/world/robot_state.h"
 
@@ -20,7 +22,8 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
                                    const RobotConstants_t& robot_constants,
                                    std::unique_ptr<RealismConfigErForce>& realism_config,
                                    const bool ramping,
-                                   double primitive_executor_time_step)
+                                   double primitive_executor_time_step,
+                                   bool multithreaded_physics)
     : yellow_team_world_msg(std::make_unique<TbotsProto::World>()),
       blue_team_world_msg(std::make_unique<TbotsProto::World>()),
       primitive_executor_time_step_s(primitive_executor_time_step),
@@ -30,7 +33,10 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
       field(Field::createField(field_type)),
       blue_robot_with_ball(std::nullopt),
       yellow_robot_with_ball(std::nullopt),
-      ramping(ramping)
+      ramping(ramping),
+      latency_tracing_enabled(false),
+      camera_frame_period(Duration::fromSeconds(0)),
+      geometry_packet_period(Duration::fromSeconds(0))
 {
     std::string full_filename = CONFIG_DIRECTORY;
 
@@ -57,7 +63,8 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
 
     google::protobuf::TextFormat::Parser parser;
     parser.ParseFromString(config_str, &er_force_sim_setup);
-    er_force_sim = std::make_unique<camun::simulator::Simulator>(er_force_sim_setup);
+    er_force_sim = std::make_unique<camun::simulator::Simulator>(er_force_sim_setup,
+                                                                 multithreaded_physics);
     auto simulator_setup_command = std::make_unique<amun::Command>();
     simulator_setup_command->mutable_simulator()->set_enable(true);
 
@@ -77,6 +84,7 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
     er_force_sim->handleSimulatorSetupCommand(simulator_setup_command);
 
     this->resetCurrentTime();
+    updateSimulatorStateSnapshot();
 }
 
 std::unique_ptr<RealismConfigErForce> ErForceSimulator::createDefaultRealismConfig()
@@ -162,6 +170,7 @@ void ErForceSimulator::setBallState(const BallState& ball_state)
     *(simulator_setup_command->mutable_simulator()) = *command_simulator;
 
     er_force_sim->handleSimulatorSetupCommand(simulator_setup_command);
+    updateSimulatorStateSnapshot();
 }
 
 void ErForceSimulator::setYellowRobots(const std::vector<RobotStateWithId>& robots)
@@ -266,6 +275,7 @@ void ErForceSimulator::setRobots(
     *(command_simulator->mutable_ssl_control())     = *simulator_control;
     *(simulator_setup_command->mutable_simulator()) = *command_simulator;
     er_force_sim->handleSimulatorSetupCommand(simulator_setup_command);
+    updateSimulatorStateSnapshot();
 
     if (side == gameController::Team::BLUE)
     {
@@ -299,9 +309,7 @@ void ErForceSimulator::setYellowRobotPrimitiveSet(
     const TbotsProto::PrimitiveSet& primitive_set_msg,
     std::unique_ptr<TbotsProto::World> world_msg)
 {
-    auto sim_state                   = getSimulatorState();
-    const auto& sim_robots           = sim_state.yellow_robots();
-    const auto robot_to_vel_pair_map = getRobotIdToLocalVelocityMap(sim_robots);
+    const auto& robot_to_vel_pair_map = yellow_robot_local_velocities;
 
     yellow_team_world_msg               = std::move(world_msg);
     const TbotsProto::World world_proto = *yellow_team_world_msg;
@@ -320,9 +328,7 @@ void ErForceSimulator::setBlueRobotPrimitiveSet(
     const TbotsProto::PrimitiveSet& primitive_set_msg,
     std::unique_ptr<TbotsProto::World> world_msg)
 {
-    auto sim_state                   = getSimulatorState();
-    const auto& sim_robots           = sim_state.blue_robots();
-    const auto robot_to_vel_pair_map = getRobotIdToLocalVelocityMap(sim_robots);
+    const auto& robot_to_vel_pair_map = blue_robot_local_velocities;
 
     blue_team_world_msg                 = std::move(world_msg);
     const TbotsProto::World world_proto = *blue_team_world_msg;
@@ -352,7 +358,13 @@ void ErForceSimulator::setRobotPrimitive(
     if (robot_primitive_executor_iter != robot_primitive_executor_map.end())
     {
         auto primitive_executor = robot_primitive_executor_iter->second;
-        primitive_executor->updatePrimitive(primitive_set_msg.robot_primitives().at(id));
+        TbotsProto::Primitive primitive = primitive_set_msg.robot_primitives().at(id);
+        if (primitive.has_latency_trace())
+        {
+            primitive.mutable_latency_trace()->set_robot_primitive_received_s(
+                getLatencyTraceTimeSeconds());
+        }
+        primitive_executor->updatePrimitive(primitive);
         primitive_executor->updateVelocity(local_velocity, angular_velocity);
     }
     else
@@ -369,18 +381,9 @@ SSLSimulationProto::RobotControl ErForceSimulator::updateSimulatorRobots(
 {
     SSLSimulationProto::RobotControl robot_control;
 
-    auto sim_state = getSimulatorState();
-    std::map<RobotId, std::pair<Vector, Angle>> current_velocity_map;
-    if (side == gameController::Team::BLUE)
-    {
-        const auto& sim_robots = sim_state.blue_robots();
-        current_velocity_map   = getRobotIdToLocalVelocityMap(sim_robots);
-    }
-    else
-    {
-        const auto& sim_robots = sim_state.yellow_robots();
-        current_velocity_map   = getRobotIdToLocalVelocityMap(sim_robots);
-    }
+    const std::map<RobotId, std::pair<Vector, AngularVelocity>>& current_velocity_map =
+        (side == gameController::Team::BLUE) ? blue_robot_local_velocities
+                                             : yellow_robot_local_velocities;
 
     for (auto& primitive_executor_with_id : robot_primitive_executor_map)
     {
@@ -453,10 +456,115 @@ ErForceSimulator::getRampedVelocityPrimitive(
         target_velocity_primitive);
 }
 
-void ErForceSimulator::stepSimulation(const Duration& time_step)
+void ErForceSimulator::setVisionPacketRates(
+    double camera_frame_rate_hz, double geometry_packet_rate_hz,
+    const std::vector<Duration>& camera_phase_offsets)
+{
+    camera_frame_period = Duration::fromSeconds(
+        camera_frame_rate_hz > 0 ? 1.0 / camera_frame_rate_hz : 0.0);
+    geometry_packet_period = Duration::fromSeconds(
+        geometry_packet_rate_hz > 0 ? 1.0 / geometry_packet_rate_hz : 0.0);
+    this->camera_phase_offsets = camera_phase_offsets;
+    resetVisionPacketSchedule();
+}
+
+void ErForceSimulator::setLatencyTracingEnabled(bool enabled)
+{
+    latency_tracing_enabled = enabled;
+}
+
+void ErForceSimulator::resetVisionPacketSchedule()
+{
+    const size_t num_cameras = er_force_sim->getNumCameras();
+    next_camera_frame_times.clear();
+    for (size_t camera_id = 0; camera_id < num_cameras; camera_id++)
+    {
+        Duration phase_offset = Duration::fromSeconds(
+            camera_frame_period.toSeconds() * static_cast<double>(camera_id) /
+            static_cast<double>(num_cameras));
+        if (camera_id < camera_phase_offsets.size())
+        {
+            phase_offset = camera_phase_offsets[camera_id];
+        }
+        next_camera_frame_times.push_back(current_time + phase_offset);
+    }
+    next_geometry_packet_time = current_time;
+    ssl_wrapper_packets.clear();
+}
+
+void ErForceSimulator::stepSimulationWithVisionPacketSchedule(const Duration& time_step)
 {
-    current_time = current_time + time_step;
+    ssl_wrapper_packets.clear();
+    const Timestamp end_time = current_time + time_step;
 
+    while (true)
+    {
+        Timestamp next_packet_time = end_time + Duration::fromSeconds(1);
+        for (const Timestamp& next_camera_frame_time : next_camera_frame_times)
+        {
+            next_packet_time = std::min(next_packet_time, next_camera_frame_time);
+        }
+        if (geometry_packet_period > Duration::fromSeconds(0))
+        {
+            next_packet_time = std::min(next_packet_time, next_geometry_packet_time);
+        }
+        if (next_packet_time > end_time)
+        {
+            break;
+        }
+
+        // Step the physics up to the time of the next packet, so that the packet
+        // captures the state of the simulation at that time
+        if (next_packet_time > current_time)
+        {
+            er_force_sim->stepSimulation((next_packet_time - current_time).toSeconds());
+            current_time = next_packet_time;
+        }
+
+        std::vector<bool> cameras(next_camera_frame_times.size(), false);
+        bool has_camera_frame = false;
+        for (size_t camera_id = 0; camera_id < next_camera_frame_times.size();
+             camera_id++)
+        {
+            if (next_camera_frame_times[camera_id] <= current_time)
+            {
+                cameras[camera_id] = true;
+                has_camera_frame   = true;
+                next_camera_frame_times[camera_id] =
+                    next_camera_frame_times[camera_id] + camera_frame_period;
+            }
+        }
+
+        bool include_geometry = false;
+        if (geometry_packet_period > Duration::fromSeconds(0))
+        {
+            if (next_geometry_packet_time <= current_time)
+            {
+                include_geometry = true;
+                next_geometry_packet_time =
+                    next_geometry_packet_time + geometry_packet_period;
+            }
+        }
+        else
+        {
+            include_geometry = has_camera_frame;
+        }
+
+        std::vector<SSLProto::SSL_WrapperPacket> packets =
+            er_force_sim->getWrapperPackets(cameras, include_geometry);
+        ssl_wrapper_packets.insert(ssl_wrapper_packets.end(), packets.begin(),
+                                   packets.end());
+    }
+
+    if (end_time > current_time)
+    {
+        er_force_sim->stepSimulation((end_time - current_time).toSeconds());
+        current_time = end_time;
+    }
+}
+
+void ErForceSimulator::stepSimulation(const Duration& time_step)
+{
     SSLSimulationProto::RobotControl yellow_robot_control =
         updateSimulatorRobots(yellow_primitive_executor_map, *yellow_team_world_msg,
                               gameController::Team::YELLOW);
@@ -488,11 +596,43 @@ void ErForceSimulator::stepSimulation(const Duration& time_step)
         }
     }
 
-    er_force_sim->stepSimulation(time_step.toSeconds());
+    if (camera_frame_period > Duration::fromSeconds(0))
+    {
+        stepSimulationWithVisionPacketSchedule(time_step);
+    }
+    else
+    {
+        er_force_sim->stepSimulation(time_step.toSeconds());
+        current_time = current_time + time_step;
+    }
 
+    updateSimulatorStateSnapshot();
     frame_number++;
 }
 
+void ErForceSimulator::addLatencyTraceRobotStatuses(
+    const std::unordered_map<unsigned int, std::shared_ptr<PrimitiveExecutor>>&
+        robot_primitive_executor_map,
+    std::vector<TbotsProto::RobotStatus>& robot_statuses)
+{
+    for (const auto& [robot_id, primitive_executor] : robot_primitive_executor_map)
+    {
+        const std::optional<TbotsProto::LatencyTrace>& latency_trace =
+            primitive_executor->getLatencyTrace();
+        if (!latency_trace || latency_trace->robot_primitive_stepped_s() == 0.0)
+        {
+            continue;
+        }
+
+        TbotsProto::RobotStatus robot_status;
+        robot_status.set_robot_id(robot_id);
+        *(robot_status.mutable_latency_trace()) = latency_trace.value();
+        robot_status.mutable_latency_trace()->set_robot_status_sent_s(
+            getLatencyTraceTimeSeconds());
+        robot_statuses.push_back(robot_status);
+    }
+}
+
 std::vector<TbotsProto::RobotStatus> ErForceSimulator::getBlueRobotStatuses() const
 {
     std::vector<TbotsProto::RobotStatus> robot_statuses;
@@ -512,6 +652,10 @@ std::vector<TbotsProto::RobotStatus> ErForceSimulator::getBlueRobotStatuses() co
 
     *(robot_status.mutable_power_status()) = power_status;
     robot_statuses.push_back(robot_status);
+    if (latency_tracing_enabled)
+    {
+        addLatencyTraceRobotStatuses(blue_primitive_executor_map, robot_statuses);
+    }
 
     return robot_statuses;
 }
@@ -535,18 +679,30 @@ std::vector<TbotsProto::RobotStatus> ErForceSimulator::getYellowRobotStatuses()
 
     *(robot_status.mutable_power_status()) = power_status;
     robot_statuses.push_back(robot_status);
+    if (latency_tracing_enabled)
+    {
+        addLatencyTraceRobotStatuses(yellow_primitive_executor_map, robot_statuses);
+    }
 
     return robot_statuses;
 }
 
 std::vector<SSLProto::SSL_WrapperPacket> ErForceSimulator::getSSLWrapperPackets() const
 {
+    if (camera_frame_period > Duration::fromSeconds(0))
+    {
+        return ssl_wrapper_packets;
+    }
     return er_force_sim->getWrapperPackets();
 }
 
 world::SimulatorState ErForceSimulator::getSimulatorState() const
 {
-    return er_force_sim->getSimulatorState();
+    if (!simulator_state.has_value())
+    {
+        simulator_state = er_force_sim->getSimulatorState();
+    }
+    return simulator_state.value();
 }
 
 Field ErForceSimulator::getField() const
@@ -562,20 +718,30 @@ Timestamp ErForceSimulator::getTimestamp() const
 void ErForceSimulator::resetCurrentTime()
 {
     current_time = Timestamp::fromSeconds(0);
+    resetVisionPacketSchedule();
 }
 
 std::map<RobotId, std::pair<Vector, AngularVelocity>>
 ErForceSimulator::getRobotIdToLocalVelocityMap(
-    const google::protobuf::RepeatedPtrField<world::SimRobot>& sim_robots)
+    const std::vector<camun::simulator::SimRobotKinematics>& robot_kinematics)
 {
     std::map<RobotId, std::pair<Vector, AngularVelocity>> robot_to_local_velocity;
-    for (const auto& sim_robot : sim_robots)
+    for (const auto& kinematics : robot_kinematics)
     {
         const Vector local_vel =
-            globalToLocalVelocity(Vector(sim_robot.v_x(), sim_robot.v_y()),
-                                  Angle::fromRadians(sim_robot.angle()));
-        const AngularVelocity angular_vel       = Angle::fromRadians(sim_robot.r_z());
-        robot_to_local_velocity[sim_robot.id()] = {local_vel, angular_vel};
+            globalToLocalVelocity(Vector(kinematics.v_x, kinematics.v_y),
+                                  Angle::fromRadians(kinematics.angle));
+        const AngularVelocity angular_vel      = Angle::fromRadians(kinematics.r_z);
+        robot_to_local_velocity[kinematics.id] = {local_vel, angular_vel};
     }
     return robot_to_local_velocity;
 }
+
+void ErForceSimulator::updateSimulatorStateSnapshot()
+{
+    blue_robot_local_velocities =
+        getRobotIdToLocalVelocityMap(er_force_sim->getRobotKinematics(true));
+    yellow_robot_local_velocities =
+        getRobotIdToLocalVelocityMap(er_force_sim->getRobotKinematics(false));
+    simulator_state.reset();
+}
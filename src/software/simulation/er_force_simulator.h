@@ -26,13 +26,16 @@ class ErForceSimulator
      * @param field_type The field type
      * @param robot_constants The robot constants
      * @param realism_config realism configuration
+     * @param multithreaded_physics whether to step the physics on multiple threads,
+     * which makes the simulation nondeterministic. See camun::simulator::Simulator
      */
     explicit ErForceSimulator(const TbotsProto::FieldType& field_type,
                               const RobotConstants_t& robot_constants,
                               std::unique_ptr<RealismConfigErForce>& realism_config,
                               const bool ramping = false,
                               double primitive_executor_time_step_s =
-                                  DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK);
+                                  DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK,
+                              bool multithreaded_physics = false);
     ErForceSimulator()  = delete;
     ~ErForceSimulator() = default;
 
@@ -83,6 +86,35 @@ class ErForceSimulator
     void setBlueRobotPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set_msg,
                                   std::unique_ptr<TbotsProto::World> world_msg);
 
+    /**
+     * Sets the rates at which vision packets are generated. Each camera captures
+     * detection frames at the camera frame rate, offset from the other cameras by its
+     * phase offset, independent of the time steps the simulation is advanced by. The
+     * field geometry is sent separately at the geometry packet rate, like SSL-Vision.
+     *
+     * By default, a detection frame from every camera and the field geometry are
+     * generated after every step of the simulation.
+     *
+     * @param camera_frame_rate_hz The rate at which each camera captures frames. If
+     * not positive, every camera captures a frame and the field geometry is sent after
+     * every step of the simulation
+     * @param geometry_packet_rate_hz The rate at which the field geometry is sent. If
+     * not positive, the field geometry is sent with every camera frame
+     * @param camera_phase_offsets The time after the start of each frame period that
+     * each camera captures its frame, indexed by camera id. Cameras without a phase
+     * offset are spread evenly across the frame period
+     */
+    void setVisionPacketRates(double camera_frame_rate_hz, double geometry_packet_rate_hz,
+                              const std::vector<Duration>& camera_phase_offsets = {});
+
+    /**
+     * Sets whether the simulated robots echo the latency traces of their primitives
+     * back in extra robot statuses, like the real robots do. Disabled by default
+     *
+     * @param enabled Whether to echo the latency traces
+     */
+    void setLatencyTracingEnabled(bool enabled);
+
     /**
      * Advances the simulation by the given time step.
      *
@@ -102,12 +134,14 @@ class ErForceSimulator
      * Returns the most recent SSL Wrapper Packets
      *
      * @return vector of `SSLProto::SSL_WrapperPacket`s representing the most recent state
-     * of the simulation
+     * of the simulation. If vision packet rates are set, these are the packets generated
+     * during the last step of the simulation
      */
     std::vector<SSLProto::SSL_WrapperPacket> getSSLWrapperPackets() const;
 
     /**
-     * Returns the current Simulator State
+     * Returns the current Simulator State. The state is only built the first time
+     * it is requested after the simulation changes
      */
     world::SimulatorState getSimulatorState() const;
 
@@ -143,6 +177,20 @@ class ErForceSimulator
     static std::unique_ptr<RealismConfigErForce> createRealisticRealismConfig();
 
    private:
+    /**
+     * Schedules the next camera frames and geometry packet from the current time,
+     * using the set vision packet rates
+     */
+    void resetVisionPacketSchedule();
+
+    /**
+     * Advances the physics simulation by the given time step, generating the camera
+     * frames and geometry packets scheduled during the time step
+     *
+     * @param time_step how much to advance the simulation by
+     */
+    void stepSimulationWithVisionPacketSchedule(const Duration& time_step);
+
     /**
      * Sets the primitive being simulated by the robot in simulation
      *
@@ -162,15 +210,35 @@ class ErForceSimulator
         const AngularVelocity angular_velocity);
 
     /**
-     * Gets a map from robot id to local and angular velocity from repeated sim robots
+     * Adds a robot status for each simulated robot that has stepped a primitive with a
+     * latency trace, echoing the trace back like a real robot would
+     *
+     * @param robot_primitive_executor_map The robot primitive executors of the team
+     * @param robot_statuses The robot statuses to add to
+     */
+    static void addLatencyTraceRobotStatuses(
+        const std::unordered_map<unsigned int, std::shared_ptr<PrimitiveExecutor>>&
+            robot_primitive_executor_map,
+        std::vector<TbotsProto::RobotStatus>& robot_statuses);
+
+    /**
+     * Gets a map from robot id to local and angular velocity from the kinematics of
+     * the sim robots
      *
-     * @param sim_robots Repeated er force sim robot protos
+     * @param robot_kinematics The kinematics of the er force sim robots
      *
      * @return a map from robot id to local velocity and angular velocity
      */
     static std::map<RobotId, std::pair<Vector, AngularVelocity>>
     getRobotIdToLocalVelocityMap(
-        const google::protobuf::RepeatedPtrField<world::SimRobot>& sim_robots);
+        const std::vector<camun::simulator::SimRobotKinematics>& robot_kinematics);
+
+    /**
+     * Updates the snapshot of the robot velocities from the er force simulator and
+     * clears the cached simulator state. Must be called after every change to the
+     * er force simulator
+     */
+    void updateSimulatorStateSnapshot();
 
     /**
      * Update Simulator Robot and get the latest robot control
@@ -230,6 +298,28 @@ class ErForceSimulator
 
     bool ramping;
 
+    // Whether the robot statuses echo the latency traces of the primitives
+    bool latency_tracing_enabled;
+
+    // The periods at which camera frames and geometry packets are generated. Vision
+    // packets are generated after every step if the camera frame period is not positive
+    Duration camera_frame_period;
+    Duration geometry_packet_period;
+    std::vector<Duration> camera_phase_offsets;
+    // The times at which each camera captures its next frame, indexed by camera id
+    std::vector<Timestamp> next_camera_frame_times;
+    Timestamp next_geometry_packet_time;
+    // The vision packets generated during the last step of the simulation
+    std::vector<SSLProto::SSL_WrapperPacket> ssl_wrapper_packets;
+
+    // Snapshot of the local velocities of the robots in the er force simulator, taken
+    // once after each change to the simulation instead of every time they are needed
+    std::map<RobotId, std::pair<Vector, AngularVelocity>> blue_robot_local_velocities;
+    std::map<RobotId, std::pair<Vector, AngularVelocity>> yellow_robot_local_velocities;
+    // The simulator state proto, built lazily the first time it is requested after
+    // the simulation changes
+    mutable std::optional<world::SimulatorState> simulator_state;
+
     const std::string CONFIG_FILE      = "simulator/2020";
     const std::string CONFIG_DIRECTORY = "extlibs/er_force_sim/config/";
 };
@@ -4,6 +4,8 @@
 // TODO (#2419): remove this
 #include <fenv.h>
 
+#include <chrono>
+
 #include "proto/message_translation/er_force_world.h"
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/primitive/primitive_msg_factory.h"
@@ -306,6 +308,131 @@ TEST_F(ErForceSimulatorTest, yellow_robot_add_robots_and_change_position)
     EXPECT_EQ(new_states.size(), yellow_robots.size());
 }
 
+TEST_F(ErForceSimulatorTest, simulator_state_updated_after_each_change)
+{
+    RobotState robot_state(Point(0, 0), Vector(2, 0), Angle::zero(),
+                           AngularVelocity::zero());
+    simulator->setYellowRobots({RobotStateWithId{.id = 0, .robot_state = robot_state}});
+
+    auto sim_state = simulator->getSimulatorState();
+    ASSERT_EQ(1, sim_state.yellow_robots_size());
+    const world::SimBall initial_ball = sim_state.ball();
+
+    simulator->setBallState(BallState(Point(1, 2), Vector()));
+    sim_state = simulator->getSimulatorState();
+    EXPECT_FALSE(initial_ball.p_x() == sim_state.ball().p_x() &&
+                 initial_ball.p_y() == sim_state.ball().p_y());
+
+    double initial_x = sim_state.yellow_robots(0).p_x();
+    simulator->stepSimulation(Duration::fromMilliseconds(100));
+    sim_state = simulator->getSimulatorState();
+    EXPECT_GT(sim_state.yellow_robots(0).p_x(), initial_x + 0.05);
+}
+
+TEST_F(ErForceSimulatorTest, vision_packets_generated_at_set_rates)
+{
+    simulator->setVisionPacketRates(60, 2);
+
+    int num_detection_frames = 0;
+    int num_geometry_packets = 0;
+    for (int i = 0; i < 200; i++)
+    {
+        simulator->stepSimulation(Duration::fromMilliseconds(5));
+        for (const auto& ssl_wrapper_packet : simulator->getSSLWrapperPackets())
+        {
+            num_detection_frames += ssl_wrapper_packet.has_detection() ? 1 : 0;
+            num_geometry_packets += ssl_wrapper_packet.has_geometry() ? 1 : 0;
+        }
+    }
+
+    // Frames and packets are generated at the start and end of the second
+    EXPECT_NEAR(61, num_detection_frames, 1);
+    EXPECT_NEAR(3, num_geometry_packets, 1);
+}
+
+TEST(ErForceSimulatorVisionTest, cameras_capture_frames_at_their_phase_offsets)
+{
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    RobotConstants_t robot_constants = create2021RobotConstants();
+    auto realism_config              = ErForceSimulator::createDefaultRealismConfig();
+    ErForceSimulator simulator(TbotsProto::FieldType::DIV_A, robot_constants,
+                               realism_config);
+    simulator.resetCurrentTime();
+    simulator.setVisionPacketRates(50, 1);
+
+    // A single step captures every frame scheduled during the step
+    simulator.stepSimulation(Duration::fromMilliseconds(95));
+
+    std::map<unsigned int, std::vector<double>> capture_times;
+    for (const auto& ssl_wrapper_packet : simulator.getSSLWrapperPackets())
+    {
+        if (ssl_wrapper_packet.has_detection())
+        {
+            capture_times[ssl_wrapper_packet.detection().camera_id()].push_back(
+                ssl_wrapper_packet.detection().t_capture());
+        }
+    }
+
+    // The two cameras are spread evenly across the 20ms frame period
+    ASSERT_EQ(2, capture_times.size());
+    ASSERT_EQ(5, capture_times[0].size());
+    ASSERT_EQ(5, capture_times[1].size());
+    for (unsigned int i = 0; i < 5; i++)
+    {
+        EXPECT_NEAR(i * 0.02, capture_times[0][i], 1e-6);
+        EXPECT_NEAR(i * 0.02 + 0.01, capture_times[1][i], 1e-6);
+    }
+    EXPECT_EQ(simulator.getTimestamp(), Timestamp::fromMilliseconds(95));
+}
+
+/**
+ * Runs a simulation with realistic noise and packet loss, and gets all vision packets
+ * sent during it
+ *
+ * @param seed the seed of the simulator
+ *
+ * @return the serialized vision packets, in the order they were sent
+ */
+static std::vector<std::string> runSeededSimulation(uint32_t seed)
+{
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    auto realism_config = ErForceSimulator::createRealisticRealismConfig();
+    realism_config->set_seed(seed);
+    ErForceSimulator simulator(TbotsProto::FieldType::DIV_B, create2021RobotConstants(),
+                               realism_config);
+    simulator.resetCurrentTime();
+    simulator.setBallState(BallState(Point(0, 0), Vector(1, 0.5)));
+    simulator.setYellowRobots(TestUtil::createStationaryRobotStatesWithId(
+        {Point(-1, 0), Point(-2, 1), Point(-2, -1)}));
+    simulator.setBlueRobots(TestUtil::createStationaryRobotStatesWithId(
+        {Point(1, 0), Point(2, 1), Point(2, -1)}));
+
+    std::vector<std::string> packets;
+    for (int i = 0; i < 60; i++)
+    {
+        simulator.stepSimulation(Duration::fromSeconds(1.0 / 60));
+        for (const auto& ssl_wrapper_packet : simulator.getSSLWrapperPackets())
+        {
+            packets.push_back(ssl_wrapper_packet.SerializeAsString());
+        }
+    }
+    return packets;
+}
+
+TEST(ErForceSimulatorSeedTest, same_seed_produces_same_vision_packets)
+{
+    std::vector<std::string> packets = runSeededSimulation(42);
+
+    ASSERT_FALSE(packets.empty());
+    EXPECT_EQ(packets, runSeededSimulation(42));
+}
+
+TEST(ErForceSimulatorSeedTest, different_seeds_produce_different_noise)
+{
+    EXPECT_NE(runSeededSimulation(42), runSeededSimulation(43));
+}
 
 TEST(ErForceSimulatorFieldTest, check_field_A_configuration)
 {
@@ -330,3 +457,133 @@ TEST(ErForceSimulatorFieldTest, check_field_B_configuration)
 
     EXPECT_EQ(simulator->getField(), Field::createSSLDivisionBField());
 }
+
+class ErForceSimulatorMultithreadingTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // TODO (#2419): remove this to re-enable sigfpe checks
+        fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    }
+
+    // Creates a division A simulator with full teams of robots moving across the field.
+    // The robots and ball never touch each other, so the rounding errors of stepping on
+    // multiple threads never turn into different collisions
+    static std::shared_ptr<ErForceSimulator> createSimulator(bool multithreaded_physics)
+    {
+        auto realism_config = ErForceSimulator::createDefaultRealismConfig();
+        auto simulator      = std::make_shared<ErForceSimulator>(
+            TbotsProto::FieldType::DIV_A, create2021RobotConstants(), realism_config,
+            false, DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK, multithreaded_physics);
+        simulator->resetCurrentTime();
+
+        std::vector<RobotStateWithId> blue_robots;
+        std::vector<RobotStateWithId> yellow_robots;
+        for (RobotId id = 0; id < 11; id++)
+        {
+            double y = -3.5 + 0.7 * id;
+            blue_robots.push_back(RobotStateWithId{
+                .id          = id,
+                .robot_state = RobotState(Point(-2, y), Vector(1, 0), Angle::zero(),
+                                          AngularVelocity::quarter())});
+            yellow_robots.push_back(RobotStateWithId{
+                .id          = id,
+                .robot_state = RobotState(Point(2, y + 0.35), Vector(-1, 0),
+                                          Angle::half(), AngularVelocity::zero())});
+        }
+        simulator->setBlueRobots(blue_robots);
+        simulator->setYellowRobots(yellow_robots);
+        simulator->setBallState(BallState(Point(-5, 0), Vector(0, 1)));
+        return simulator;
+    }
+
+    static void expectSameRobots(
+        const google::protobuf::RepeatedPtrField<world::SimRobot>& expected_robots,
+        const google::protobuf::RepeatedPtrField<world::SimRobot>& robots,
+        float tolerance)
+    {
+        ASSERT_EQ(expected_robots.size(), robots.size());
+        for (int i = 0; i < robots.size(); i++)
+        {
+            EXPECT_EQ(expected_robots[i].id(), robots[i].id());
+            EXPECT_NEAR(expected_robots[i].p_x(), robots[i].p_x(), tolerance);
+            EXPECT_NEAR(expected_robots[i].p_y(), robots[i].p_y(), tolerance);
+            EXPECT_NEAR(expected_robots[i].angle(), robots[i].angle(), tolerance);
+            EXPECT_NEAR(expected_robots[i].v_x(), robots[i].v_x(), tolerance);
+            EXPECT_NEAR(expected_robots[i].v_y(), robots[i].v_y(), tolerance);
+        }
+    }
+
+    static void expectSameState(const world::SimulatorState& expected_state,
+                                const world::SimulatorState& state, float tolerance)
+    {
+        expectSameRobots(expected_state.blue_robots(), state.blue_robots(), tolerance);
+        expectSameRobots(expected_state.yellow_robots(), state.yellow_robots(),
+                         tolerance);
+        EXPECT_NEAR(expected_state.ball().p_x(), state.ball().p_x(), tolerance);
+        EXPECT_NEAR(expected_state.ball().p_y(), state.ball().p_y(), tolerance);
+        EXPECT_NEAR(expected_state.ball().v_x(), state.ball().v_x(), tolerance);
+        EXPECT_NEAR(expected_state.ball().v_y(), state.ball().v_y(), tolerance);
+    }
+
+    static constexpr unsigned int NUM_STEPS = 400;
+    // Multithreaded stepping is not deterministic, so the simulated states are only
+    // expected to agree up to the rounding errors of solving the contacts in a different
+    // order
+    static constexpr float MULTITHREADED_TOLERANCE = 0.001f;
+};
+
+TEST_F(ErForceSimulatorMultithreadingTest,
+       multithreaded_simulations_agree_within_tolerance)
+{
+    auto first_simulator  = createSimulator(true);
+    auto second_simulator = createSimulator(true);
+
+    for (unsigned int i = 0; i < NUM_STEPS; i++)
+    {
+        first_simulator->stepSimulation(Duration::fromMilliseconds(5));
+        second_simulator->stepSimulation(Duration::fromMilliseconds(5));
+    }
+
+    expectSameState(first_simulator->getSimulatorState(),
+                    second_simulator->getSimulatorState(), MULTITHREADED_TOLERANCE);
+}
+
+TEST_F(ErForceSimulatorMultithreadingTest,
+       multithreaded_simulation_agrees_with_single_threaded_simulation_within_tolerance)
+{
+    auto single_threaded_simulator = createSimulator(false);
+    auto multithreaded_simulator   = createSimulator(true);
+
+    for (unsigned int i = 0; i < NUM_STEPS; i++)
+    {
+        single_threaded_simulator->stepSimulation(Duration::fromMilliseconds(5));
+        multithreaded_simulator->stepSimulation(Duration::fromMilliseconds(5));
+    }
+
+    expectSameState(single_threaded_simulator->getSimulatorState(),
+                    multithreaded_simulator->getSimulatorState(),
+                    MULTITHREADED_TOLERANCE);
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name to compare how long it takes to step the simulator on one or multiple
+// threads
+TEST_F(ErForceSimulatorMultithreadingTest, DISABLED_step_performance)
+{
+    for (bool multithreaded_physics : {false, true})
+    {
+        auto simulator  = createSimulator(multithreaded_physics);
+        auto start_time = std::chrono::system_clock::now();
+        for (unsigned int i = 0; i < NUM_STEPS; i++)
+        {
+            simulator->stepSimulation(Duration::fromMilliseconds(5));
+        }
+        double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+        std::cout << (multithreaded_physics ? "Multithreaded" : "Single threaded")
+                  << " simulator took " << duration_ms / NUM_STEPS
+                  << "ms per step on average" << std::endl;
+    }
+}
@@ -23,8 +23,8 @@ namespace TestUtil
 ::testing::AssertionResult equalWithinTolerance(const Polygon &poly1,
                                                 const Polygon &poly2, double tolerance)
 {
-    auto ppts1 = poly1.getPoints();
-    auto ppts2 = poly2.getPoints();
+    const auto& ppts1 = poly1.getPoints();
+    const auto& ppts2 = poly2.getPoints();
     if (std::equal(ppts1.begin(), ppts1.end(), ppts2.begin(),
                    [tolerance](const Point &p1, const Point &p2)
                    { return equalWithinTolerance(p1, p2, tolerance); }))
@@ -204,6 +204,9 @@ gdb --args bazel-bin/{self.full_system}
         proto_unix_io.attach_unix_receiver(
             self.full_system_runtime_dir, PRIMITIVE_PATH, PrimitiveSet
         )
+        proto_unix_io.attach_unix_receiver(
+            self.full_system_runtime_dir, METRICS_PATH, MetricsSnapshot
+        )
 
         # Inputs to full_system
         for arg in [
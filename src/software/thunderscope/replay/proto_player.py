@@ -4,7 +4,6 @@ import threading
 import base64
 import os
 import gzip
-import glob
 from proto.import_all_protos import *
 from extlibs.er_force_sim.src.protobuf.world_pb2 import *
 from software.py_constants import *
@@ -13,8 +12,7 @@ from software.thunderscope.constants import ProtoPlayerFlags
 from software.thunderscope.proto_unix_io import ProtoUnixIO
 import software.python_bindings as tbots_cpp
 from google.protobuf.message import Message
-from typing import Callable, Type, List
-import pickle
+from typing import Type
 
 
 class ProtoPlayer:
@@ -41,13 +39,13 @@ class ProtoPlayer:
     speed. If the seek function is called with a specific time, the player will
     update the 3 variables (shown above) to point to the chunk and entry (in the
     chunk) that contains the data at that time and continue playing from there.
+
+    The chunks are read and indexed by the C++ ReplayReader, which saves a time index
+    of every entry in the log folder so that seeking doesn't decompress any chunks,
+    and returns the protos already decoded from base64.
     """
 
     PLAY_PAUSE_POLL_INTERVAL_SECONDS = 0.1
-    CHUNK_INDEX_FILENAME = "chunks.index"
-    BOOKMARK_INDEX_FILENAME = "bookmarks.index"
-    CHUNK_INDEX_FILE_VERSION = 1
-    BOOKMARK_INDEX_FILE_VERSION = 1
 
     def __init__(
         self, log_folder_path: os.PathLike, proto_unix_io: ProtoUnixIO
@@ -77,13 +75,11 @@ class ProtoPlayer:
         self.current_chunk_index = 0
         self.current_entry_index = 0
 
-        self.sorted_chunks = self.sort_and_get_replay_files(self.log_folder_path)
-
-        self.version = ProtoPlayer.get_replay_chunk_format_version(
-            self.sorted_chunks[0]
-        )
+        # Opening the log loads the time index, indexing any chunks missing from it
+        self.replay_reader = tbots_cpp.ReplayReader(str(self.log_folder_path))
+        self.sorted_chunks = self.replay_reader.getChunkPaths()
 
-        # build or load index for chunks
+        # load the start time of each chunk and the bookmarks from the time index
         self.bookmark_indices = list()
         self.chunks_indices = dict()
         self.load_or_build_index()
@@ -104,206 +100,17 @@ class ProtoPlayer:
 
         self.error_bit_flag = ProtoPlayerFlags.NO_ERROR_FLAG
 
-    @staticmethod
-    def sort_and_get_replay_files(log_folder_path: os.PathLike):
-        """Sorting the replay files
-
-        :param log_folder_path: the path to the folder that we are going to be sorting!
-        :return: the sorted replay files
-        """
-        # Load up all replay files in the log folder
-        replay_files = glob.glob(f"{log_folder_path}/*.{REPLAY_FILE_EXTENSION}")
-
-        if len(replay_files) == 0:
-            raise ValueError(
-                f'No replay files found in "{log_folder_path}", make sure that an absolute path '
-                f"to the folder containing the replay files is provided."
-            )
-
-        # Sort the files by their chunk index
-        def __sort_replay_chunks(file_path: os.PathLike):
-            head, tail = os.path.split(file_path)
-            replay_index, _ = tail.split(".")
-            return int(replay_index)
-
-        return sorted(replay_files, key=__sort_replay_chunks)
-
-    @staticmethod
-    def is_log_entry_corrupt(log_entry: bytes, version: int) -> bool:
-        """Check to see if we have can unpack the log entry
-
-        :param log_entry: the log entry we are checking
-        :param version: the version of the replay file
-        :return: False if we could unpack the log entry, True otherwise
-        """
-        try:
-            _ = ProtoPlayer.unpack_log_entry(log_entry, version)
-            return False
-        except Exception:
-            return True
-
-    def handle_log_line_for_chunk(self, **kwargs) -> None:
-        """Find the time stamp of the first proto event in the replay file.
-        :param kwargs: a dictionary contains all the information about a line in the replay log.
-            e.g. {
-                "protobuf_type": type of proto
-                "timestamp": timestamp when the proto is logged
-                "data": data of the proto message
-                "line_no": line number
-                "chunk_name": file name of the chunk
-            }
-        """
-        if kwargs["line_no"] == 0:
-            self.chunks_indices[os.path.basename(kwargs["chunk_name"])] = kwargs[
-                "timestamp"
-            ]
-
-    def handle_log_line_for_bookmark(self, **kwargs) -> None:
-        """Filter out bookmark protos in the replay log
-        :param kwargs: a dictionary contains all the information about a line in the replay log.
-            e.g. {
-                "protobuf_type": type of proto
-                "timestamp": timestamp when the proto is logged
-                "data": data of the proto message
-                "line_no": line number
-                "chunk_name": file name of the chunk
-            }
-        """
-        if kwargs["protobuf_type"] == ReplayBookmark:
-            self.bookmark_indices.append(kwargs["timestamp"])
-
-    def finish_preprocess_replay_file(self) -> None:
-        """Finish off pre-processing and save all the pre-processing result to disk"""
-        # save chunk indices
-        if self.chunks_indices:
-            try:
-                with open(
-                    os.path.join(
-                        self.log_folder_path, ProtoPlayer.CHUNK_INDEX_FILENAME
-                    ),
-                    "w",
-                ) as index_file:
-                    index_file.write(
-                        f"Version: {ProtoPlayer.CHUNK_INDEX_FILE_VERSION}, "
-                        f"Generated on {time.time():.0f}\n"
-                    )
-                    for filename, start_timestamp in self.chunks_indices.items():
-                        index_file.write(f"{start_timestamp}, {filename}\n")
-                logging.info("Created chunk index file successfully.")
-            except Exception as e:
-                logging.warning(
-                    f"Failed to build chunk index for {self.log_folder_path}: {e}"
-                )
-        else:
-            logging.warning(
-                f"Failed to build chunk index for {self.log_folder_path} : No chunk data."
-            )
-
-        # save bookmark indices
-        if self.bookmark_indices:
-            with open(
-                os.path.join(self.log_folder_path, ProtoPlayer.BOOKMARK_INDEX_FILENAME),
-                "wb",
-            ) as bookmark_file:
-                pickle.dump(self.bookmark_indices, bookmark_file)
-                logging.info("Created bookmark index file successfully.")
-        else:
-            logging.warning(
-                f"Failed to build bookmark index for {self.log_folder_path} : No bookmark data found."
-            )
-
-    def preprocess_replay_file(self, handlers: List[Callable[[...], None]]) -> None:
-        """Start preprocessing replay files and build index according to the provided handlers
-
-        :param handlers: handler functions that will be applied to each line of the replay log.
-                This function will be provided following parameters
-                 (self: ProtoPlayer, line_no: int, chunk_name:str, timestamp: float,
-                    protobuf_type: Type[Message], data: Message).
+    def load_or_build_index(self) -> None:
+        """Load the chunk index and bookmark index from the time index of the replay
+        reader, which is built when the log is opened if it doesn't exist yet.
         """
-        for chunk_name in self.sorted_chunks:
-            chunk_data = ProtoPlayer.load_replay_chunk(chunk_name, self.version)
-            if chunk_data:
-                start_timestamp, _, _ = ProtoPlayer.unpack_log_entry(
-                    chunk_data[0], self.version
-                )
-                for line_no, data in enumerate(chunk_data):
-                    timestamp, protobuf_type, data = ProtoPlayer.unpack_log_entry(
-                        data, self.version
-                    )
-                    for handler in handlers:
-                        handler(
-                            line_no=line_no,
-                            chunk_name=chunk_name,
-                            timestamp=timestamp,
-                            protobuf_type=protobuf_type,
-                            data=data,
-                        )
-        self.finish_preprocess_replay_file()
-
-    def is_chunk_indexed(self) -> bool:
-        """Returns true if the chunk index is already built.
-
-        :return: if the chunk index file exists
-        """
-        return os.path.exists(
-            os.path.join(self.log_folder_path, ProtoPlayer.CHUNK_INDEX_FILENAME)
-        )
-
-    def is_bookmark_indexed(self) -> bool:
-        """Returns true if the bookmark index is already built.
-        :return: if the bookmark index exists
-        """
-        return os.path.exists(
-            os.path.join(self.log_folder_path, ProtoPlayer.BOOKMARK_INDEX_FILENAME)
-        )
-
-    def load_chunk_index(self) -> None:
-        """Loads the chunk index file."""
-        try:
-            with open(
-                os.path.join(self.log_folder_path, ProtoPlayer.CHUNK_INDEX_FILENAME),
-                "r",
-            ) as index_file:
-                # skip the first timestamp line
-                index_file.readline()
-
-                for line in index_file:
-                    start_timestamp, chunk_name = line.split(",")
-                    start_timestamp = float(start_timestamp)
-                    chunk_name = chunk_name.strip()
-                    self.chunks_indices[chunk_name] = start_timestamp
-            logging.info("Pre-existing chunk index file found and loaded.")
-        except Exception as e:
-            logging.warning(f"An Exception occurred when loading chunk index file {e}")
-
-    def load_bookmark_index(self) -> None:
-        """Loads the bookmark file"""
-        try:
-            with open(
-                os.path.join(self.log_folder_path, ProtoPlayer.BOOKMARK_INDEX_FILENAME),
-                "rb",
-            ) as bookmark_file:
-                self.bookmark_indices = pickle.load(bookmark_file)
-                logging.info("Pre-existing chunk bookmark file found and loaded.")
-        except Exception as e:
-            logging.warning(f"An Exception occurred when loading bookmark file {e}")
-
-    def load_or_build_index(self):
-        """Load bookmark index and chunk index. If none is found, build first then load."""
-        # handler_list contains all the tasks to do when pre-processing the log data
-        handler_list = list()
-        if not self.is_chunk_indexed():
-            handler_list.append(self.handle_log_line_for_chunk)
-        else:
-            self.load_chunk_index()
-
-        if not self.is_bookmark_indexed():
-            handler_list.append(self.handle_log_line_for_bookmark)
-        else:
-            self.load_bookmark_index()
+        self.chunks_indices = dict()
+        for chunk_index, chunk_name in enumerate(self.sorted_chunks):
+            start_timestamp = self.replay_reader.getChunkStartTime(chunk_index)
+            if start_timestamp is not None:
+                self.chunks_indices[os.path.basename(chunk_name)] = start_timestamp
 
-        if handler_list:
-            self.preprocess_replay_file(handler_list)
+        self.bookmark_indices = self.replay_reader.getBookmarkTimes()
 
     def is_proto_player_playing(self) -> bool:
         """Return whether or not the proto player is being played.
@@ -315,66 +122,38 @@ class ProtoPlayer:
     def find_actual_endtime(self) -> float:
         """Finding the last end time.
         Note that the end time may not necessarily be the last message in the last chunks since there may be
-        file corruptions. We also assume a chronological order in the chunks data!
+        file corruptions, which are skipped when indexing. We also assume a chronological order in the chunks data!
 
         :return: the last end time, if no end time are found, return 0.0s
         """
-        # reverse iterating over the chunks (file)
-        for i in reversed(range(len(self.sorted_chunks))):
-            last_chunk_data = ProtoPlayer.load_replay_chunk(
-                self.sorted_chunks[i], self.version
-            )
+        return self.replay_reader.getEndTime()
 
-            # reverse iterating the protobufs message in each and every file
-            for j in reversed(range(len(last_chunk_data))):
-                try:
-                    end_time, _, _ = ProtoPlayer.unpack_log_entry(
-                        last_chunk_data[j], self.version
-                    )
-                    return end_time
-                except Exception:
-                    pass
+    def load_chunk(self, chunk_index: int) -> list:
+        """Reads a replay chunk of the log being played.
 
-        return 0.0
+        :param chunk_index: The index of the chunk in the sorted chunks.
+        :return: The entries of the chunk, as (timestamp, protobuf type full name,
+            serialized proto) tuples
+        """
+        return self.replay_reader.readChunk(chunk_index)
 
     @staticmethod
-    def load_replay_chunk(replay_chunk_path: os.PathLike, version: int) -> list:
-        """Reads a replay chunk.
+    def unpack_replay_entry(entry: tuple) -> (float, Type[Message], Message):
+        """Unpacks an entry read by the replay reader into the timestamp and proto.
 
-        :param replay_chunk_path: The path to the replay chunk.
-        :param version: The format version of the replay file
-        :return: The replay chunk. List of log entries
+        :param entry: The (timestamp, protobuf type full name, serialized proto) entry.
+        :return: The timestamp, proto_class, deserialized protobuf
         """
-        cached_data = []
+        timestamp, protobuf_type, serialized_proto = entry
 
-        # Load chunk into memory
-        with gzip.open(replay_chunk_path, "rb") as log_file:
-            # Starting version 2, the first line of the chunk contains
-            # the replay file version
-            if version >= 2:
-                log_file.readline()
-
-            while True:
-                try:
-                    line = log_file.readline()
-                    if not line:
-                        break
-
-                    if not ProtoPlayer.is_log_entry_corrupt(line, version):
-                        cached_data.append(line)
-                    else:
-                        logging.warning(
-                            "There are log entries that are corrupted. Entries ignored!"
-                        )
-                except EOFError:
-                    break
-
-                except Exception as e:
-                    logging.warning(
-                        f"An unknown exception has occurred while reading {replay_chunk_path}: {e}"
-                    )
+        # The format of the protobuf type is:
+        # package.proto_class (e.g. TbotsProto.Primitive)
+        try:
+            proto_class = eval(protobuf_type.split(".")[-1])
+        except NameError:
+            raise TypeError(f"Unknown proto type in replay: '{protobuf_type}'")
 
-        return cached_data
+        return timestamp, proto_class, proto_class.FromString(serialized_proto)
 
     @staticmethod
     def get_replay_chunk_format_version(replay_chunk_path: os.PathLike) -> int:
@@ -470,7 +249,8 @@ class ProtoPlayer:
 
         self.seek(start_time)
 
-        while True:
+        clip_saved = False
+        while not clip_saved:
             with gzip.open(
                 f"{directory}/{replay_index}.{REPLAY_FILE_EXTENSION}", "wb"
             ) as log_file:
@@ -489,32 +269,35 @@ class ProtoPlayer:
                 while self.current_entry_index < len(self.current_chunk):
                     (
                         self.current_packet_time,
-                        _,
-                        proto,
-                    ) = ProtoPlayer.unpack_log_entry(
-                        self.current_chunk[self.current_entry_index], self.version
-                    )
+                        protobuf_type,
+                        serialized_proto,
+                    ) = self.current_chunk[self.current_entry_index]
 
                     log_entry = tbots_cpp.ProtoLogger.createLogEntry(
-                        proto.DESCRIPTOR.full_name,
-                        proto.SerializeToString(),
+                        protobuf_type,
+                        serialized_proto,
                         self.current_packet_time - start_time,
                     )
                     log_file.write(bytes(log_entry, encoding="utf-8"))
                     self.current_entry_index += 1
                     if self.current_packet_time >= end_time:
-                        logging.info("Clip saved!")
-                        self.build_chunk_index(directory)
-                        return
-                # Load the next chunk
+                        clip_saved = True
+                        break
+
+            if not clip_saved:
+                # Load the next chunk, the clip ends at the end of the log
                 self.current_chunk_index += 1
                 replay_index += 1
 
                 if self.current_chunk_index < len(self.sorted_chunks):
-                    self.current_chunk = ProtoPlayer.load_replay_chunk(
-                        self.sorted_chunks[self.current_chunk_index], self.version
-                    )
+                    self.current_chunk = self.load_chunk(self.current_chunk_index)
                     self.current_entry_index = 0
+                else:
+                    clip_saved = True
+
+        # Build the time index of the clip now that all of its chunks are written
+        tbots_cpp.ReplayReader(directory)
+        logging.info("Clip saved!")
 
     def play(self) -> None:
         """Plays back the log file."""
@@ -565,9 +348,7 @@ class ProtoPlayer:
             else:
                 # adjust log entry index and fetch the right chunk
                 self.current_entry_index -= len(self.current_chunk)
-                self.current_chunk = ProtoPlayer.load_replay_chunk(
-                    self.sorted_chunks[self.current_chunk_index], self.version
-                )
+                self.current_chunk = self.load_chunk(self.current_chunk_index)
 
         logging.info(
             "Stepped to chunk {} at index {} with timestamp {:.2f}".format(
@@ -578,65 +359,32 @@ class ProtoPlayer:
         )
 
     def seek(self, seek_time: float) -> None:
-        """Seeks to a specific time. We binary search through the chunks
-        to find the chunk that would contain the data at the given time.
-
-        We then binary search the entries in the chunk to find the entry
-        cloest to the given time.
+        """Seeks to a specific time. The replay reader binary searches the
+        time index of the log to find the first entry at or after the given
+        time, without reading any chunks.
 
         We then set the current_chunk_index and current_entry_index to
-        the correct values. We also update the seek_offset_time to help
-        with realtime playback timing calculations in the worker thread.
+        the correct values and load the chunk. We also update the
+        seek_offset_time to help with realtime playback timing calculations
+        in the worker thread.
 
         :param seek_time: The time to seek to.
         """
-
-        # Let's binary search through the chunks to find the chunk that starts
-        # with a timestamp less than (but closest to) the seek_time we want
-        # to seek to.
-        def __get_timestamp_for_chunk(chunk: str) -> float:
-            if self.chunks_indices and os.path.basename(chunk) in self.chunks_indices:
-                return self.chunks_indices[os.path.basename(chunk)]
-            else:
-                logging.warning(
-                    "Use old algorithm to jump, which might result in lagging "
-                    + f"Please try deleting {ProtoPlayer.CHUNK_INDEX_FILENAME} in the replay file folder"
-                    + " and re-run Thunderscope to enable the indexing for faster speed!"
-                )
-                chunk = ProtoPlayer.load_replay_chunk(chunk, self.version)
-                start_timestamp, _, _ = ProtoPlayer.unpack_log_entry(
-                    chunk[0], self.version
-                )
-                return start_timestamp
-
-        with self.replay_controls_mutex:
-            self.current_chunk_index = ProtoPlayer.binary_search(
-                self.sorted_chunks, seek_time, key=__get_timestamp_for_chunk
-            )
-
-        # Let's binary search through the entries in the chunk to find the closest
-        # timestamp to seek to
-        def __bisect_entries_by_timestamp(entry: str) -> float:
-            timestamp, _, _ = ProtoPlayer.unpack_log_entry(entry, self.version)
-            return timestamp
-
         with self.replay_controls_mutex:
-            # Load the chunk that would have the entry
-            self.current_chunk = ProtoPlayer.load_replay_chunk(
-                self.sorted_chunks[self.current_chunk_index], self.version
-            )
-
-            # Search through the chunk to find the entry that is closest to
-            # the seek_time
-            self.current_entry_index = ProtoPlayer.binary_search(
-                self.current_chunk, seek_time, key=__bisect_entries_by_timestamp
-            )
+            (
+                self.current_chunk_index,
+                self.current_entry_index,
+            ) = self.replay_reader.seek(seek_time)
+            self.current_chunk = self.load_chunk(self.current_chunk_index)
 
             # Update the seek_offset_time and current_packet_time
             # to the one we just found.
-            self.seek_offset_time = __bisect_entries_by_timestamp(
-                self.current_chunk[self.current_entry_index]
-            )
+            if self.current_entry_index < len(self.current_chunk):
+                self.seek_offset_time, _, _ = self.current_chunk[
+                    self.current_entry_index
+                ]
+            else:
+                self.seek_offset_time = seek_time
             self.current_packet_time = self.seek_offset_time
 
             logging.info(
@@ -647,37 +395,6 @@ class ProtoPlayer:
                 )
             )
 
-    @staticmethod
-    def binary_search(arr: list, x, key: Callable = lambda x: x) -> int:
-        """Binary search for an element in an array.
-
-        Stolen from: https://www.geeksforgeeks.org/python-program-for-binary-search/
-
-        :param arr: The array to search.
-        :param x: The element to search for.
-        :param key: The key to use for sorting.
-        """
-        low = 0
-        high = len(arr) - 1
-        mid = 0
-
-        while low <= high:
-            mid = (high + low) // 2
-
-            # If x is greater, ignore left half
-            if key(arr[mid]) < x:
-                low = mid + 1
-
-            # If x is smaller, ignore right half
-            elif key(arr[mid]) > x:
-                high = mid - 1
-
-            # x is present at mid
-            else:
-                return mid
-
-        return min(abs(low), abs(high))
-
     def __play_protobufs_wrapper(self) -> None:
         """This function essentially executes __play_protobufs. However, the intention of this function
         is for testing purposes. __play_protobufs is launched in a different thread, it would be useful to know
@@ -740,8 +457,8 @@ class ProtoPlayer:
                             self.current_packet_time,
                             proto_class,
                             proto,
-                        ) = ProtoPlayer.unpack_log_entry(
-                            self.current_chunk[self.current_entry_index], self.version
+                        ) = ProtoPlayer.unpack_replay_entry(
+                            self.current_chunk[self.current_entry_index]
                         )
                     except Exception:
                         self.current_entry_index += 1
@@ -767,7 +484,7 @@ class ProtoPlayer:
                     self.current_chunk_index += 1
 
                     if self.current_chunk_index < len(self.sorted_chunks):
-                        self.current_chunk = ProtoPlayer.load_replay_chunk(
-                            self.sorted_chunks[self.current_chunk_index], self.version
+                        self.current_chunk = self.load_chunk(
+                            self.current_chunk_index
                         )
                         self.current_entry_index = 0
@@ -76,7 +76,7 @@ def test_for_building_index_on_valid_chunks():
 
     Test steps:
     1. generate correctly formatted replay files (chunks)
-    2. Build index files
+    2. Build the time index
     3. Load index into memory and validate
     3. Test ProtoPlayer.seek() to check if the player can jump correctly to the correct chunk
     """
@@ -94,13 +94,12 @@ def test_for_building_index_on_valid_chunks():
             create_valid_log_entry,
         )
 
-    player = create_test_player()
+    # the time index is built when the log is opened
+    create_test_player()
 
-    # generate chunk index file
+    # validate index with a player that loads the saved time index
+    player = create_test_player()
     player.load_or_build_index()
-
-    # validate index with load index function
-    player.load_chunk_index()
     assert len(player.chunks_indices) == CHUNK_FILES_NUM
     assert player.chunks_indices
     for filename, start_timestamp in player.chunks_indices.items():
@@ -50,10 +50,11 @@ int main(int argc, char** argv)
     // Setup dynamic parameters
     struct CommandLineArgs
     {
-        bool help                   = false;
-        std::string runtime_dir     = "/tmp/tbots";
-        bool friendly_colour_yellow = false;
-        bool ci                     = false;
+        bool help                     = false;
+        std::string runtime_dir       = "/tmp/tbots";
+        bool friendly_colour_yellow   = false;
+        bool ci                       = false;
+        bool loopback_latency_tracing = false;
     };
 
     CommandLineArgs args;
@@ -70,6 +71,10 @@ int main(int argc, char** argv)
     desc.add_options()(
         "ci", boost::program_options::bool_switch(&args.ci),
         "If true, then the World timestamp will be used to as the time provider for ProtoLogger");
+    desc.add_options()("loopback_latency_tracing",
+                       boost::program_options::bool_switch(&args.loopback_latency_tracing),
+                       "If true, the robots are simulated on this computer, so latency "
+                       "traces are measured with a single clock");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -126,8 +131,8 @@ int main(int argc, char** argv)
                                              { return backend->getLastWorldTimeSec(); });
         }
 
-        auto sensor_fusion =
-            std::make_shared<ThreadedSensorFusion>(tbots_proto.sensor_fusion_config());
+        auto sensor_fusion = std::make_shared<ThreadedSensorFusion>(
+            tbots_proto.sensor_fusion_config(), args.loopback_latency_tracing);
         auto ai = std::make_shared<ThreadedAi>(tbots_proto.ai_config());
 
         // Overrides
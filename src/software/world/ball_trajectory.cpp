@@ -0,0 +1,305 @@
+#include "software/world/ball_trajectory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+
+BallTrajectory::BallTrajectory(const BallState &initial_state,
+                               double initial_vertical_velocity_m_per_s, bool sliding,
+                               const std::optional<Rectangle> &walls,
+                               const std::vector<Circle> &robot_obstacles)
+{
+    Point position  = initial_state.position();
+    Vector velocity = initial_state.velocity();
+
+    // The ball flies until it stops bouncing on the ground
+    double height_m                  = initial_state.distanceFromGround();
+    double vertical_velocity_m_per_s = initial_vertical_velocity_m_per_s;
+    if (height_m > 0 || vertical_velocity_m_per_s > 0)
+    {
+        for (unsigned int bounces = 0; bounces < MAX_GROUND_BOUNCES; bounces++)
+        {
+            // Solve h + v*t - g*t^2/2 = 0 for the time at which the ball lands
+            const double g = ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED;
+            const double flight_duration_s =
+                (vertical_velocity_m_per_s +
+                 std::sqrt(std::pow(vertical_velocity_m_per_s, 2) + 2 * g * height_m)) /
+                g;
+            addPhase(position, velocity, 0, flight_duration_s, height_m,
+                     vertical_velocity_m_per_s, true);
+
+            position = position + velocity * flight_duration_s;
+            vertical_velocity_m_per_s =
+                (g * flight_duration_s - vertical_velocity_m_per_s) * GROUND_RESTITUTION;
+            height_m = 0;
+            if (vertical_velocity_m_per_s < MIN_BOUNCE_VERTICAL_SPEED_M_PER_S)
+            {
+                break;
+            }
+        }
+
+        // The ball lands without spin, so it slides
+        sliding = true;
+    }
+
+    // The ball hits a wall when its centre is a ball radius from the wall, and walls
+    // only keep the ball in if it starts inside of them
+    std::optional<Rectangle> ball_walls;
+    if (walls)
+    {
+        Rectangle shrunk_walls(
+            Point(walls->xMin() + BALL_MAX_RADIUS_METERS,
+                  walls->yMin() + BALL_MAX_RADIUS_METERS),
+            Point(walls->xMax() - BALL_MAX_RADIUS_METERS,
+                  walls->yMax() - BALL_MAX_RADIUS_METERS));
+        if (contains(shrunk_walls, position))
+        {
+            ball_walls = shrunk_walls;
+        }
+    }
+    // The ball hits a robot when its centre is a ball radius from the robot, and does
+    // not bounce off of robots it is already touching
+    std::vector<Circle> ball_robot_obstacles;
+    for (const Circle &robot_obstacle : robot_obstacles)
+    {
+        Circle obstacle(robot_obstacle.origin(),
+                        robot_obstacle.radius() + BALL_MAX_RADIUS_METERS);
+        if (distance(position, obstacle.origin()) > obstacle.radius())
+        {
+            ball_robot_obstacles.push_back(obstacle);
+        }
+    }
+
+    unsigned int num_collisions = 0;
+    while (velocity.length() > STATIONARY_BALL_SPEED_METERS_PER_SECOND)
+    {
+        const double speed = velocity.length();
+        const double deceleration =
+            sliding ? -BALL_SLIDING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED
+                    : -BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+        const double end_speed = sliding ? speed * FRICTION_TRANSITION_FACTOR : 0;
+        const double phase_distance_m =
+            (std::pow(speed, 2) - std::pow(end_speed, 2)) / (2 * deceleration);
+
+        std::optional<std::pair<double, Vector>> collision;
+        if (num_collisions < MAX_COLLISIONS)
+        {
+            collision = findFirstCollision(position, velocity.normalize(),
+                                           phase_distance_m, ball_walls,
+                                           ball_robot_obstacles);
+        }
+
+        if (collision)
+        {
+            const auto &[collision_distance_m, normal] = *collision;
+            addPhase(position, velocity, deceleration, 0);
+            Phase &phase     = phases.back();
+            phase.duration_s = getTimeToTravelDistance(phase, collision_distance_m);
+
+            position = position + velocity.normalize(collision_distance_m);
+            velocity = velocity.normalize(speed - deceleration * phase.duration_s);
+
+            // Reflect the velocity off of the surface, losing speed towards it
+            const Vector normal_velocity = normal * velocity.dot(normal);
+            velocity =
+                velocity - normal_velocity - normal_velocity * COLLISION_RESTITUTION;
+
+            // The collision disturbs the spin of the ball, so it slides again
+            sliding = true;
+            num_collisions++;
+            continue;
+        }
+
+        addPhase(position, velocity, deceleration, (speed - end_speed) / deceleration);
+        position = position + velocity.normalize(phase_distance_m);
+        velocity = sliding ? velocity.normalize(end_speed) : Vector();
+        sliding  = false;
+    }
+
+    addPhase(position, Vector(), 0, std::numeric_limits<double>::infinity());
+}
+
+void BallTrajectory::addPhase(const Point &position, const Vector &velocity,
+                              double deceleration_m_per_s2, double duration_s,
+                              double height_m, double vertical_velocity_m_per_s,
+                              bool in_flight)
+{
+    double start_time_s     = 0;
+    double start_distance_m = 0;
+    if (!phases.empty())
+    {
+        const Phase &previous_phase = phases.back();
+        start_time_s = previous_phase.start_time_s + previous_phase.duration_s;
+        const double previous_speed = previous_phase.start_velocity.length();
+        start_distance_m =
+            previous_phase.start_distance_m +
+            previous_speed * previous_phase.duration_s -
+            0.5 * previous_phase.deceleration_m_per_s2 *
+                std::pow(previous_phase.duration_s, 2);
+    }
+
+    phases.push_back({
+        .start_time_s                    = start_time_s,
+        .start_distance_m                = start_distance_m,
+        .start_position                  = position,
+        .start_velocity                  = velocity,
+        .deceleration_m_per_s2           = deceleration_m_per_s2,
+        .duration_s                      = duration_s,
+        .in_flight                       = in_flight,
+        .start_height_m                  = height_m,
+        .start_vertical_velocity_m_per_s = vertical_velocity_m_per_s,
+    });
+}
+
+std::optional<std::pair<double, Vector>> BallTrajectory::findFirstCollision(
+    const Point &position, const Vector &direction, double max_distance_m,
+    const std::optional<Rectangle> &walls, const std::vector<Circle> &robot_obstacles)
+{
+    std::optional<std::pair<double, Vector>> first_collision;
+    auto add_collision = [&](double distance_m, const Vector &normal)
+    {
+        if (distance_m <= max_distance_m &&
+            (!first_collision || distance_m < first_collision->first))
+        {
+            first_collision = std::make_pair(distance_m, normal);
+        }
+    };
+
+    // The ball can only hit the walls it is moving towards
+    if (walls)
+    {
+        if (direction.x() > 0)
+        {
+            add_collision((walls->xMax() - position.x()) / direction.x(), Vector(-1, 0));
+        }
+        else if (direction.x() < 0)
+        {
+            add_collision((walls->xMin() - position.x()) / direction.x(), Vector(1, 0));
+        }
+        if (direction.y() > 0)
+        {
+            add_collision((walls->yMax() - position.y()) / direction.y(), Vector(0, -1));
+        }
+        else if (direction.y() < 0)
+        {
+            add_collision((walls->yMin() - position.y()) / direction.y(), Vector(0, 1));
+        }
+    }
+
+    for (const Circle &robot_obstacle : robot_obstacles)
+    {
+        // Find where the ray enters the circle, if it does
+        const Vector to_centre        = robot_obstacle.origin() - position;
+        const double distance_closest = to_centre.dot(direction);
+        if (distance_closest <= 0)
+        {
+            continue;
+        }
+        const double discriminant = std::pow(distance_closest, 2) -
+                                    to_centre.lengthSquared() +
+                                    std::pow(robot_obstacle.radius(), 2);
+        if (discriminant < 0)
+        {
+            continue;
+        }
+        const double distance_m = distance_closest - std::sqrt(discriminant);
+        if (distance_m <= 0)
+        {
+            continue;
+        }
+        const Point collision_point = position + direction * distance_m;
+        add_collision(distance_m,
+                      (collision_point - robot_obstacle.origin()).normalize());
+    }
+
+    return first_collision;
+}
+
+double BallTrajectory::getTimeToTravelDistance(const Phase &phase, double distance_m)
+{
+    const double speed = phase.start_velocity.length();
+    if (speed == 0)
+    {
+        return 0;
+    }
+    if (phase.deceleration_m_per_s2 == 0)
+    {
+        return distance_m / speed;
+    }
+
+    // Solve v*t - a*t^2/2 = d for the first time the ball travels the distance
+    const double discriminant =
+        std::pow(speed, 2) - 2 * phase.deceleration_m_per_s2 * distance_m;
+    return (speed - std::sqrt(std::max(0.0, discriminant))) / phase.deceleration_m_per_s2;
+}
+
+BallState BallTrajectory::estimateFutureState(const Duration &duration_in_future) const
+{
+    const double time_s = std::max(0.0, duration_in_future.toSeconds());
+
+    // Find the last phase that starts before the time
+    auto phase_iter = std::upper_bound(phases.begin(), phases.end(), time_s,
+                                       [](double time_s, const Phase &phase)
+                                       { return time_s < phase.start_time_s; });
+    const Phase &phase = *std::prev(phase_iter);
+
+    const double phase_time_s = std::min(time_s - phase.start_time_s, phase.duration_s);
+    const double speed        = phase.start_velocity.length();
+    if (speed == 0)
+    {
+        return BallState(phase.start_position, Vector());
+    }
+
+    const double distance_m = speed * phase_time_s - 0.5 * phase.deceleration_m_per_s2 *
+                                                         std::pow(phase_time_s, 2);
+    const double end_speed  = speed - phase.deceleration_m_per_s2 * phase_time_s;
+
+    const Vector direction = phase.start_velocity.normalize();
+    const Point position   = phase.start_position + direction * distance_m;
+    const Vector velocity  = direction * end_speed;
+
+    double height_m = 0;
+    if (phase.in_flight)
+    {
+        height_m = phase.start_height_m +
+                   phase.start_vertical_velocity_m_per_s * phase_time_s -
+                   0.5 * ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED *
+                       std::pow(phase_time_s, 2);
+        height_m = std::max(0.0, height_m);
+    }
+
+    return BallState(position, velocity, height_m);
+}
+
+std::optional<Duration> BallTrajectory::estimateTimeToTravelDistance(
+    double distance_m) const
+{
+    if (distance_m > getTotalDistance())
+    {
+        return std::nullopt;
+    }
+
+    // Find the last phase that starts before the distance
+    auto phase_iter = std::upper_bound(phases.begin(), phases.end(), distance_m,
+                                       [](double distance_m, const Phase &phase)
+                                       { return distance_m < phase.start_distance_m; });
+    const Phase &phase = *std::prev(phase_iter);
+
+    return Duration::fromSeconds(
+        phase.start_time_s +
+        getTimeToTravelDistance(phase, distance_m - phase.start_distance_m));
+}
+
+Duration BallTrajectory::getDurationUntilStopped() const
+{
+    return Duration::fromSeconds(phases.back().start_time_s);
+}
+
+double BallTrajectory::getTotalDistance() const
+{
+    return phases.back().start_distance_m;
+}
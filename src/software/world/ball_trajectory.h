@@ -0,0 +1,166 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+#include "software/geom/vector.h"
+#include "software/time/duration.h"
+#include "software/world/ball_state.h"
+
+/**
+ * The predicted trajectory of a ball, computed once so it can be queried at any time
+ * in the future.
+ *
+ * The trajectory is split into phases during which the ball moves in a straight line
+ * with a constant deceleration, so each query only needs a binary search for the phase
+ * and a closed form evaluation of it:
+ *  - A ball above the ground (e.g. a chip) flies without friction and bounces on the
+ *    ground until it stops bouncing
+ *  - A ball that was just kicked, landed or collided with something slides, with
+ *    sliding friction, until its speed drops to FRICTION_TRANSITION_FACTOR of its
+ *    speed when it started sliding
+ *  - A rolling ball decelerates with rolling friction until it stops
+ *
+ * Optionally, the ball bounces off the walls of the field and off robots, which are
+ * assumed to stay where they are. The ball only bounces while it is on the ground.
+ */
+class BallTrajectory
+{
+   public:
+    BallTrajectory() = delete;
+
+    /**
+     * Predicts the trajectory of a ball
+     *
+     * @param initial_state The current state of the ball
+     * @param initial_vertical_velocity_m_per_s The current upwards velocity of the ball.
+     * A ball above the ground without an upwards velocity falls to the ground
+     * @param sliding Whether the ball is sliding, e.g. because it was just kicked,
+     * instead of rolling
+     * @param walls The walls the ball bounces off from the inside, if any. The ball
+     * does not bounce off the walls if it starts outside of them
+     * @param robot_obstacles The robots the ball bounces off
+     */
+    explicit BallTrajectory(const BallState &initial_state,
+                            double initial_vertical_velocity_m_per_s = 0.0,
+                            bool sliding = false,
+                            const std::optional<Rectangle> &walls = std::nullopt,
+                            const std::vector<Circle> &robot_obstacles = {});
+
+    /**
+     * Estimates the state of the ball at the given amount of time in the future
+     *
+     * @param duration_in_future The Duration into the future at which to estimate the
+     * ball's state. Negative durations are treated as 0
+     *
+     * @return The estimated state of the ball
+     */
+    BallState estimateFutureState(const Duration &duration_in_future) const;
+
+    /**
+     * Estimates how long it will take the ball to travel the given distance along its
+     * trajectory
+     *
+     * @param distance_m The distance along the trajectory, in metres
+     *
+     * @return the duration it will take the ball to travel the distance, or
+     * std::nullopt if the ball stops before it travels the distance
+     */
+    std::optional<Duration> estimateTimeToTravelDistance(double distance_m) const;
+
+    /**
+     * Gets how long it will take the ball to stop
+     *
+     * @return the duration until the ball stops
+     */
+    Duration getDurationUntilStopped() const;
+
+    /**
+     * Gets the total distance the ball travels along its trajectory before it stops
+     *
+     * @return the distance the ball travels, in metres
+     */
+    double getTotalDistance() const;
+
+   private:
+    /**
+     * A part of the trajectory in which the ball moves in a straight line with a
+     * constant deceleration
+     */
+    struct Phase
+    {
+        // The time since the start of the trajectory at which the phase starts
+        double start_time_s;
+        // The distance the ball travelled along the trajectory before the phase
+        double start_distance_m;
+        Point start_position;
+        Vector start_velocity;
+        // The deceleration along the direction of the velocity, which is 0 in flight
+        double deceleration_m_per_s2;
+        double duration_s;
+        bool in_flight;
+        double start_height_m;
+        double start_vertical_velocity_m_per_s;
+    };
+
+    /**
+     * Adds a phase to the end of the trajectory
+     *
+     * @param position The position of the ball at the start of the phase
+     * @param velocity The velocity of the ball at the start of the phase
+     * @param deceleration_m_per_s2 The deceleration of the ball during the phase
+     * @param duration_s The duration of the phase
+     * @param height_m The height of the ball at the start of the phase
+     * @param vertical_velocity_m_per_s The upwards velocity of the ball at the start of
+     * the phase, if it is in flight
+     * @param in_flight Whether the ball is in flight during the phase
+     */
+    void addPhase(const Point &position, const Vector &velocity,
+                  double deceleration_m_per_s2, double duration_s, double height_m = 0.0,
+                  double vertical_velocity_m_per_s = 0.0, bool in_flight = false);
+
+    /**
+     * Finds the first obstacle the ball hits when it moves along a ray
+     *
+     * @param position The start of the ray
+     * @param direction The unit direction of the ray
+     * @param max_distance_m The maximum distance to look along the ray
+     * @param walls The walls the ball bounces off from the inside, if any
+     * @param robot_obstacles The robots the ball bounces off
+     *
+     * @return the distance along the ray to the collision and the normal of the
+     * surface at the collision, or std::nullopt if the ball hits nothing
+     */
+    static std::optional<std::pair<double, Vector>> findFirstCollision(
+        const Point &position, const Vector &direction, double max_distance_m,
+        const std::optional<Rectangle> &walls,
+        const std::vector<Circle> &robot_obstacles);
+
+    /**
+     * Finds the time into a phase at which the ball has travelled the given distance
+     *
+     * @param phase The phase
+     * @param distance_m The distance from the start of the phase, in metres
+     *
+     * @return the time since the start of the phase, in seconds
+     */
+    static double getTimeToTravelDistance(const Phase &phase, double distance_m);
+
+    // The phases of the trajectory, in order. The last phase is the ball at rest and
+    // lasts forever
+    std::vector<Phase> phases;
+
+    // The fraction of the vertical speed a chipped ball keeps when it bounces on the
+    // ground, and the vertical speed below which it stops bouncing
+    static constexpr double GROUND_RESTITUTION                = 0.56;
+    static constexpr double MIN_BOUNCE_VERTICAL_SPEED_M_PER_S = 0.5;
+    static constexpr unsigned int MAX_GROUND_BOUNCES          = 5;
+    // The fraction of the speed towards a robot or wall that the ball keeps when it
+    // bounces off of it
+    static constexpr double COLLISION_RESTITUTION = 0.6;
+    static constexpr unsigned int MAX_COLLISIONS  = 10;
+};
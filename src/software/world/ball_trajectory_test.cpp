@@ -0,0 +1,178 @@
+#include "software/world/ball_trajectory.h"
+
+#include <gtest/gtest.h>
+
+#include "shared/constants.h"
+#include "software/test_util/test_util.h"
+
+TEST(BallTrajectoryTest, stationary_ball_stays_where_it_is)
+{
+    BallTrajectory trajectory(BallState(Point(1, 2), Vector()));
+
+    EXPECT_EQ(Duration::fromSeconds(0), trajectory.getDurationUntilStopped());
+    EXPECT_DOUBLE_EQ(0.0, trajectory.getTotalDistance());
+    BallState future_state = trajectory.estimateFutureState(Duration::fromSeconds(3));
+    EXPECT_EQ(Point(1, 2), future_state.position());
+    EXPECT_EQ(Vector(), future_state.velocity());
+    EXPECT_EQ(std::nullopt, trajectory.estimateTimeToTravelDistance(0.1));
+}
+
+TEST(BallTrajectoryTest, rolling_ball_stops_with_rolling_friction)
+{
+    BallTrajectory trajectory(BallState(Point(0, 0), Vector(2, 0)));
+
+    // v^2 / (2 * a) and v / a
+    EXPECT_NEAR(4.0, trajectory.getTotalDistance(), 1e-9);
+    EXPECT_NEAR(4.0, trajectory.getDurationUntilStopped().toSeconds(), 1e-9);
+
+    BallState future_state = trajectory.estimateFutureState(Duration::fromSeconds(1));
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(future_state.position(), Point(1.75, 0), 1e-9));
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(future_state.velocity(), Vector(1.5, 0), 1e-9));
+
+    future_state = trajectory.estimateFutureState(Duration::fromSeconds(10));
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(future_state.position(), Point(4, 0), 1e-9));
+    EXPECT_EQ(Vector(), future_state.velocity());
+}
+
+TEST(BallTrajectoryTest, negative_duration_returns_initial_state)
+{
+    BallTrajectory trajectory(BallState(Point(1, 1), Vector(0, 1)));
+
+    BallState future_state = trajectory.estimateFutureState(Duration::fromSeconds(-1));
+    EXPECT_EQ(Point(1, 1), future_state.position());
+    EXPECT_EQ(Vector(0, 1), future_state.velocity());
+}
+
+TEST(BallTrajectoryTest, sliding_ball_starts_rolling_at_transition_speed)
+{
+    const double initial_speed = 5.0;
+    BallTrajectory trajectory(BallState(Point(0, 0), Vector(initial_speed, 0)), 0.0,
+                              true);
+
+    const double sliding_deceleration =
+        -BALL_SLIDING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+    const double transition_speed = initial_speed * FRICTION_TRANSITION_FACTOR;
+    const double sliding_duration_s =
+        (initial_speed - transition_speed) / sliding_deceleration;
+    const double sliding_distance_m =
+        (std::pow(initial_speed, 2) - std::pow(transition_speed, 2)) /
+        (2 * sliding_deceleration);
+
+    BallState transition_state =
+        trajectory.estimateFutureState(Duration::fromSeconds(sliding_duration_s));
+    EXPECT_NEAR(transition_speed, transition_state.velocity().length(), 1e-9);
+    EXPECT_NEAR(sliding_distance_m, transition_state.position().x(), 1e-9);
+
+    const double rolling_deceleration =
+        -BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+    EXPECT_NEAR(sliding_distance_m +
+                    std::pow(transition_speed, 2) / (2 * rolling_deceleration),
+                trajectory.getTotalDistance(), 1e-9);
+    EXPECT_NEAR(sliding_duration_s + transition_speed / rolling_deceleration,
+                trajectory.getDurationUntilStopped().toSeconds(), 1e-9);
+}
+
+TEST(BallTrajectoryTest, time_to_travel_distance_matches_future_state)
+{
+    BallTrajectory trajectory(BallState(Point(0, 0), Vector(3, 4)), 0.0, true);
+
+    for (double distance_m : {0.0, 0.5, 2.0, 5.0, 10.0})
+    {
+        std::optional<Duration> time_to_travel =
+            trajectory.estimateTimeToTravelDistance(distance_m);
+        ASSERT_TRUE(time_to_travel.has_value()) << "for distance " << distance_m;
+
+        BallState future_state = trajectory.estimateFutureState(*time_to_travel);
+        EXPECT_NEAR(distance_m, future_state.position().toVector().length(), 1e-6)
+            << "for distance " << distance_m;
+    }
+
+    EXPECT_EQ(std::nullopt, trajectory.estimateTimeToTravelDistance(
+                                trajectory.getTotalDistance() + 0.1));
+}
+
+TEST(BallTrajectoryTest, chipped_ball_lands_and_bounces)
+{
+    const double vertical_velocity_m_per_s = 3.0;
+    BallTrajectory trajectory(BallState(Point(0, 0), Vector(2, 0)),
+                              vertical_velocity_m_per_s);
+
+    const double first_flight_duration_s =
+        2 * vertical_velocity_m_per_s /
+        ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED;
+
+    // The ball flies without friction
+    BallState apex_state = trajectory.estimateFutureState(
+        Duration::fromSeconds(first_flight_duration_s / 2));
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(apex_state.velocity(), Vector(2, 0), 1e-9));
+    EXPECT_NEAR(std::pow(vertical_velocity_m_per_s, 2) /
+                    (2 * ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED),
+                apex_state.distanceFromGround(), 1e-9);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        apex_state.position(), Point(first_flight_duration_s, 0), 1e-9));
+
+    // The ball bounces back into the air after it lands
+    BallState bounce_state = trajectory.estimateFutureState(
+        Duration::fromSeconds(first_flight_duration_s * 1.1));
+    EXPECT_GT(bounce_state.distanceFromGround(), 0.0);
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(bounce_state.velocity(), Vector(2, 0), 1e-9));
+
+    BallState final_state = trajectory.estimateFutureState(Duration::fromSeconds(100));
+    EXPECT_EQ(0.0, final_state.distanceFromGround());
+    EXPECT_EQ(Vector(), final_state.velocity());
+    EXPECT_GT(final_state.position().x(), 2 * first_flight_duration_s);
+}
+
+TEST(BallTrajectoryTest, ball_bounces_off_wall)
+{
+    Rectangle walls(Point(-1, -1), Point(1, 1));
+    BallTrajectory trajectory(BallState(Point(0, 0), Vector(4, 0)), 0.0, false, walls);
+
+    // The ball reflects off the wall at x = 1, keeping some of its speed
+    BallState final_state = trajectory.estimateFutureState(Duration::fromSeconds(100));
+    EXPECT_LT(final_state.position().x(), 1.0 - BALL_MAX_RADIUS_METERS);
+    EXPECT_GE(final_state.position().x(), -1.0 + BALL_MAX_RADIUS_METERS);
+    EXPECT_NEAR(0.0, final_state.position().y(), 1e-9);
+
+    std::optional<Duration> time_to_wall =
+        trajectory.estimateTimeToTravelDistance(1.0 - BALL_MAX_RADIUS_METERS);
+    ASSERT_TRUE(time_to_wall.has_value());
+    BallState after_bounce_state =
+        trajectory.estimateFutureState(*time_to_wall + Duration::fromMilliseconds(10));
+    EXPECT_LT(after_bounce_state.velocity().x(), 0.0);
+}
+
+TEST(BallTrajectoryTest, ball_outside_walls_does_not_bounce_off_them)
+{
+    Rectangle walls(Point(-1, -1), Point(1, 1));
+    BallTrajectory trajectory(BallState(Point(2, 0), Vector(-1, 0)), 0.0, false, walls);
+
+    EXPECT_NEAR(1.0, trajectory.getTotalDistance(), 1e-9);
+}
+
+TEST(BallTrajectoryTest, ball_bounces_off_robot)
+{
+    Circle robot(Point(2, 0), ROBOT_MAX_RADIUS_METERS);
+    BallTrajectory trajectory(BallState(Point(0, 0.05), Vector(3, 0)), 0.0, false,
+                              std::nullopt, {robot});
+
+    BallState final_state = trajectory.estimateFutureState(Duration::fromSeconds(100));
+    EXPECT_LT(final_state.position().x(),
+              2.0 - ROBOT_MAX_RADIUS_METERS - BALL_MAX_RADIUS_METERS);
+    // The ball glances off the robot away from its centre
+    EXPECT_GT(final_state.position().y(), 0.05);
+}
+
+TEST(BallTrajectoryTest, ball_does_not_bounce_off_robot_it_misses)
+{
+    Circle robot(Point(2, 1), ROBOT_MAX_RADIUS_METERS);
+    BallTrajectory trajectory(BallState(Point(0, 0), Vector(3, 0)), 0.0, false,
+                              std::nullopt, {robot});
+
+    EXPECT_NEAR(9.0, trajectory.getTotalDistance(), 1e-9);
+}
@@ -65,6 +65,22 @@ Field::Field(double field_x_length, double field_y_length, double defense_x_leng
         throw std::invalid_argument(
             "At least one field dimension is non-positive - Field is invalid");
     }
+
+    const Point field_boundary_neg_corner(-totalXLength() / 2, -totalYLength() / 2);
+    const Point field_boundary_pos_corner(totalXLength() / 2, totalYLength() / 2);
+    derived_regions_ = std::make_shared<const DerivedRegions>(DerivedRegions{
+        .friendly_half =
+            Rectangle(friendlyCornerNeg(), Point(0, friendlyCornerPos().y())),
+        .friendly_positive_y_quadrant =
+            Rectangle(friendlyGoalCenter(), Point(0, friendlyCornerPos().y())),
+        .friendly_negative_y_quadrant =
+            Rectangle(friendlyGoalCenter(), Point(0, friendlyCornerNeg().y())),
+        .enemy_half = Rectangle(Point(0, enemyCornerNeg().y()), enemyCornerPos()),
+        .enemy_positive_y_quadrant = Rectangle(centerPoint(), enemyCornerPos()),
+        .enemy_negative_y_quadrant = Rectangle(centerPoint(), enemyCornerNeg()),
+        .field_boundary =
+            Rectangle(field_boundary_neg_corner, field_boundary_pos_corner),
+    });
 }
 
 Field::Field(const TbotsProto::Field &field_proto)
@@ -125,34 +141,34 @@ const Rectangle &Field::enemyDefenseArea() const
     return enemy_defense_area_;
 }
 
-Rectangle Field::friendlyHalf() const
+const Rectangle &Field::friendlyHalf() const
 {
-    return Rectangle(friendlyCornerNeg(), Point(0, friendlyCornerPos().y()));
+    return derived_regions_->friendly_half;
 }
 
-Rectangle Field::friendlyPositiveYQuadrant() const
+const Rectangle &Field::friendlyPositiveYQuadrant() const
 {
-    return Rectangle(friendlyGoalCenter(), Point(0, friendlyCornerPos().y()));
+    return derived_regions_->friendly_positive_y_quadrant;
 }
 
-Rectangle Field::friendlyNegativeYQuadrant() const
+const Rectangle &Field::friendlyNegativeYQuadrant() const
 {
-    return Rectangle(friendlyGoalCenter(), Point(0, friendlyCornerNeg().y()));
+    return derived_regions_->friendly_negative_y_quadrant;
 }
 
-Rectangle Field::enemyHalf() const
+const Rectangle &Field::enemyHalf() const
 {
-    return Rectangle(Point(0, enemyCornerNeg().y()), enemyCornerPos());
+    return derived_regions_->enemy_half;
 }
 
-Rectangle Field::enemyPositiveYQuadrant() const
+const Rectangle &Field::enemyPositiveYQuadrant() const
 {
-    return Rectangle(centerPoint(), enemyCornerPos());
+    return derived_regions_->enemy_positive_y_quadrant;
 }
 
-Rectangle Field::enemyNegativeYQuadrant() const
+const Rectangle &Field::enemyNegativeYQuadrant() const
 {
-    return Rectangle(centerPoint(), enemyCornerNeg());
+    return derived_regions_->enemy_negative_y_quadrant;
 }
 
 const Rectangle &Field::fieldLines() const
@@ -160,11 +176,9 @@ const Rectangle &Field::fieldLines() const
     return field_lines_;
 }
 
-Rectangle Field::fieldBoundary() const
+const Rectangle &Field::fieldBoundary() const
 {
-    Point neg_x_neg_y_corner(-totalXLength() / 2, -totalYLength() / 2);
-    Point pos_x_pos_y_corner(totalXLength() / 2, totalYLength() / 2);
-    return Rectangle(neg_x_neg_y_corner, pos_x_pos_y_corner);
+    return derived_regions_->field_boundary;
 }
 
 double Field::centerCircleRadius() const
@@ -284,6 +298,30 @@ bool Field::pointInEnemyHalf(const Point &p) const
     return p.x() >= centerPoint().x();
 }
 
+bool Field::pointInFriendlyPositiveYQuadrant(const Point &p) const
+{
+    return p.x() >= friendlyCornerNeg().x() && p.x() <= centerPoint().x() &&
+           p.y() >= centerPoint().y() && p.y() <= friendlyCornerPos().y();
+}
+
+bool Field::pointInFriendlyNegativeYQuadrant(const Point &p) const
+{
+    return p.x() >= friendlyCornerNeg().x() && p.x() <= centerPoint().x() &&
+           p.y() >= friendlyCornerNeg().y() && p.y() <= centerPoint().y();
+}
+
+bool Field::pointInEnemyPositiveYQuadrant(const Point &p) const
+{
+    return p.x() >= centerPoint().x() && p.x() <= enemyCornerPos().x() &&
+           p.y() >= centerPoint().y() && p.y() <= enemyCornerPos().y();
+}
+
+bool Field::pointInEnemyNegativeYQuadrant(const Point &p) const
+{
+    return p.x() >= centerPoint().x() && p.x() <= enemyCornerPos().x() &&
+           p.y() >= enemyCornerNeg().y() && p.y() <= centerPoint().y();
+}
+
 bool Field::pointInFriendlyCorner(const Point &p, double radius) const
 {
     return ((distance(p, friendlyCornerPos()) < radius) ||
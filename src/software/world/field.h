@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "proto/world.pb.h"
 #include "software/geom/circle.h"
 #include "software/geom/point.h"
@@ -203,42 +205,42 @@ class Field
      *
      * @return the friendly half of the field
      */
-    Rectangle friendlyHalf() const;
+    const Rectangle &friendlyHalf() const;
 
     /**
      * Gets the friendly positive Y quadrant of the field
      *
      * @return the friendly positive Y quadrant of the field
      */
-    Rectangle friendlyPositiveYQuadrant() const;
+    const Rectangle &friendlyPositiveYQuadrant() const;
 
     /**
      * Gets the friendly negative Y quadrant of the field
      *
      * @return the friendly negative Y quadrant of the field
      */
-    Rectangle friendlyNegativeYQuadrant() const;
+    const Rectangle &friendlyNegativeYQuadrant() const;
 
     /**
      * Gets the enemy half of the field within field lines
      *
      * @return the enemy half of the field
      */
-    Rectangle enemyHalf() const;
+    const Rectangle &enemyHalf() const;
 
     /**
      * Gets the enemy positive Y quadrant of the field
      *
      * @return the enemy positive Y quadrant of the field
      */
-    Rectangle enemyPositiveYQuadrant() const;
+    const Rectangle &enemyPositiveYQuadrant() const;
 
     /**
      * Gets the enemy negative Y quadrant of the field
      *
      * @return the enemy negative Y quadrant of the field
      */
-    Rectangle enemyNegativeYQuadrant() const;
+    const Rectangle &enemyNegativeYQuadrant() const;
 
     /**
      * Gets the area within the field lines as a rectangle. This is the set of locations
@@ -255,7 +257,7 @@ class Field
      *
      * @return The area within the field boundary as a rectangle
      */
-    Rectangle fieldBoundary() const;
+    const Rectangle &fieldBoundary() const;
 
     /**
      * Gets the position of the centre of the friendly goal.
@@ -393,6 +395,50 @@ class Field
      */
     bool pointInEnemyHalf(const Point &p) const;
 
+    /**
+     * Returns true if the point is in the friendly positive Y quadrant of the field, and
+     * false otherwise. Equivalent to checking if friendlyPositiveYQuadrant() contains
+     * the point, without testing the Rectangle
+     *
+     * @param point
+     * @return true if the point is in the friendly positive Y quadrant of the field, and
+     * false otherwise
+     */
+    bool pointInFriendlyPositiveYQuadrant(const Point &p) const;
+
+    /**
+     * Returns true if the point is in the friendly negative Y quadrant of the field, and
+     * false otherwise. Equivalent to checking if friendlyNegativeYQuadrant() contains
+     * the point, without testing the Rectangle
+     *
+     * @param point
+     * @return true if the point is in the friendly negative Y quadrant of the field, and
+     * false otherwise
+     */
+    bool pointInFriendlyNegativeYQuadrant(const Point &p) const;
+
+    /**
+     * Returns true if the point is in the enemy positive Y quadrant of the field, and
+     * false otherwise. Equivalent to checking if enemyPositiveYQuadrant() contains the
+     * point, without testing the Rectangle
+     *
+     * @param point
+     * @return true if the point is in the enemy positive Y quadrant of the field, and
+     * false otherwise
+     */
+    bool pointInEnemyPositiveYQuadrant(const Point &p) const;
+
+    /**
+     * Returns true if the point is in the enemy negative Y quadrant of the field, and
+     * false otherwise. Equivalent to checking if enemyNegativeYQuadrant() contains the
+     * point, without testing the Rectangle
+     *
+     * @param point
+     * @return true if the point is in the enemy negative Y quadrant of the field, and
+     * false otherwise
+     */
+    bool pointInEnemyNegativeYQuadrant(const Point &p) const;
+
     /**
      * Returns true if the point is in within the provided radius in one of the friendly
      * corner.
@@ -459,6 +505,21 @@ class Field
     Rectangle field_lines_;
     Rectangle enemy_goal_;
     Rectangle friendly_goal_;
+
+    // The regions that are derived from the field dimensions and are not cached above.
+    // They are built once when the Field is created and shared between its copies, so
+    // copying a Field does not copy their geometry
+    struct DerivedRegions
+    {
+        Rectangle friendly_half;
+        Rectangle friendly_positive_y_quadrant;
+        Rectangle friendly_negative_y_quadrant;
+        Rectangle enemy_half;
+        Rectangle enemy_positive_y_quadrant;
+        Rectangle enemy_negative_y_quadrant;
+        Rectangle field_boundary;
+    };
+    std::shared_ptr<const DerivedRegions> derived_regions_;
 };
 
 namespace std
@@ -4,6 +4,7 @@
 
 #include "proto/message_translation/tbots_protobuf.h"
 #include "shared/constants.h"
+#include "software/geom/algorithms/contains.h"
 
 class FieldTest : public ::testing::Test
 {
@@ -367,6 +368,42 @@ TEST_F(FieldTest, degenerate_field_neg_lengths)
     EXPECT_THROW(Field(2, 2, 3, -2, 0, 2, 3, 4), std::invalid_argument);
 }
 
+TEST_F(FieldTest, copies_share_derived_regions)
+{
+    Field field =
+        Field(x_length, y_length, defense_x_length, defense_y_length, goal_x_length,
+              goal_y_length, boundary_buffer_size, center_circle_radius);
+    Field field_copy = field;
+
+    EXPECT_EQ(&field.friendlyHalf(), &field_copy.friendlyHalf());
+    EXPECT_EQ(&field.fieldBoundary(), &field_copy.fieldBoundary());
+}
+
+TEST_F(FieldTest, quadrant_point_classification_matches_quadrant_regions)
+{
+    // Step over the field boundary so that the field lines and the center lines are
+    // sampled exactly
+    for (double x = -x_length / 2 - 0.5; x <= x_length / 2 + 0.5; x += 0.25)
+    {
+        for (double y = -y_length / 2 - 0.5; y <= y_length / 2 + 0.5; y += 0.25)
+        {
+            Point p(x, y);
+            EXPECT_EQ(contains(field.friendlyPositiveYQuadrant(), p),
+                      field.pointInFriendlyPositiveYQuadrant(p))
+                << p;
+            EXPECT_EQ(contains(field.friendlyNegativeYQuadrant(), p),
+                      field.pointInFriendlyNegativeYQuadrant(p))
+                << p;
+            EXPECT_EQ(contains(field.enemyPositiveYQuadrant(), p),
+                      field.pointInEnemyPositiveYQuadrant(p))
+                << p;
+            EXPECT_EQ(contains(field.enemyNegativeYQuadrant(), p),
+                      field.pointInEnemyNegativeYQuadrant(p))
+                << p;
+        }
+    }
+}
+
 TEST(BallInFriendlyHalfTest, ball_barely_in_friendly_half)
 {
     Field field = Field::createSSLDivisionBField();
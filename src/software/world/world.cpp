@@ -16,7 +16,8 @@ World::World(const Field &field, const Ball &ball, const Team &friendly_team,
       referee_command_history_(REFEREE_COMMAND_BUFFER_SIZE),
       referee_stage_history_(REFEREE_COMMAND_BUFFER_SIZE),
       team_with_possession_(TeamPossession::FRIENDLY_TEAM),
-      virtual_obstacles_()
+      virtual_obstacles_(),
+      field_version_(0)
 {
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
@@ -25,11 +26,13 @@ World::World(const TbotsProto::World &world_proto)
     : World(Field(world_proto.field()), Ball(world_proto.ball()),
             Team(world_proto.friendly_team()), Team(world_proto.enemy_team()))
 {
+    field_version_ = world_proto.field_version();
 }
 
 void World::updateBall(const Ball &new_ball)
 {
     ball_ = new_ball;
+    evaluation_cache_.clear();
     updateTimestamp(getMostRecentTimestampFromMembers());
     current_game_state_.updateBall(ball_);
 }
@@ -37,12 +40,14 @@ void World::updateBall(const Ball &new_ball)
 void World::updateFriendlyTeamState(const Team &new_friendly_team_data)
 {
     friendly_team_.updateState(new_friendly_team_data);
+    evaluation_cache_.clear();
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
 
 void World::updateEnemyTeamState(const Team &new_enemy_team_data)
 {
     enemy_team_.updateState(new_enemy_team_data);
+    evaluation_cache_.clear();
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
 
@@ -82,6 +87,7 @@ const Team &World::enemyTeam() const
 void World::updateRefereeCommand(const RefereeCommand &command)
 {
     referee_command_history_.push_back(command);
+    evaluation_cache_.clear();
     // Take the consensus of the previous referee messages
     if (!referee_command_history_.empty() &&
         std::all_of(referee_command_history_.begin(), referee_command_history_.end(),
@@ -97,11 +103,13 @@ void World::updateRefereeCommand(const RefereeCommand &command,
 {
     updateRefereeCommand(command);
     current_game_state_.setBallPlacementPoint(ball_placement_point);
+    evaluation_cache_.clear();
 }
 
 void World::updateRefereeStage(const RefereeStage &stage)
 {
     referee_stage_history_.push_back(stage);
+    evaluation_cache_.clear();
     // Take the consensus of the previous referee messages
     if (!referee_stage_history_.empty() &&
         std::all_of(referee_stage_history_.begin(), referee_stage_history_.end(),
@@ -153,11 +161,13 @@ bool World::operator!=(const World &other) const
 void World::updateGameStateBall(const Ball &ball)
 {
     current_game_state_.updateBall(ball);
+    evaluation_cache_.clear();
 }
 
 void World::updateGameState(const GameState &game_state)
 {
     current_game_state_ = game_state;
+    evaluation_cache_.clear();
 }
 
 const RefereeStage &World::getRefereeStage() const
@@ -168,6 +178,7 @@ const RefereeStage &World::getRefereeStage() const
 void World::setTeamWithPossession(TeamPossession team_with_possesion)
 {
     team_with_possession_ = team_with_possesion;
+    evaluation_cache_.clear();
 }
 
 TeamPossession World::getTeamWithPossession() const
@@ -178,6 +189,7 @@ TeamPossession World::getTeamWithPossession() const
 void World::setVirtualObstacles(const TbotsProto::VirtualObstacles &virtual_obstacles)
 {
     virtual_obstacles_ = virtual_obstacles;
+    evaluation_cache_.clear();
 }
 
 TbotsProto::VirtualObstacles World::getVirtualObstacles() const
@@ -188,9 +200,46 @@ TbotsProto::VirtualObstacles World::getVirtualObstacles() const
 void World::setDribbleDisplacement(const std::optional<Segment> &displacement)
 {
     dribble_displacement_ = displacement;
+    evaluation_cache_.clear();
 }
 
 const std::optional<Segment> &World::getDribbleDisplacement() const
 {
     return dribble_displacement_;
 }
+
+void World::setFieldVersion(uint64_t field_version)
+{
+    field_version_ = field_version;
+}
+
+uint64_t World::getFieldVersion() const
+{
+    return field_version_;
+}
+
+void World::setLatencyTrace(const TbotsProto::LatencyTrace &latency_trace)
+{
+    latency_trace_ = latency_trace;
+}
+
+const std::optional<TbotsProto::LatencyTrace> &World::getLatencyTrace() const
+{
+    return latency_trace_;
+}
+
+WorldEvaluationCache &World::evaluationCache() const
+{
+    return evaluation_cache_;
+}
+
+std::shared_ptr<const BallTrajectory> World::ballTrajectory() const
+{
+    return evaluation_cache_.getOrCompute(
+        "ballTrajectory", "",
+        [this]()
+        {
+            return std::make_shared<const BallTrajectory>(
+                ball_.currentState(), 0.0, false, field_.fieldBoundary());
+        });
+}
@@ -3,11 +3,14 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include "proto/latency_trace.pb.h"
 #include "proto/visualization.pb.h"
 #include "software/world/ball.h"
+#include "software/world/ball_trajectory.h"
 #include "software/world/field.h"
 #include "software/world/game_state.h"
 #include "software/world/team.h"
+#include "software/world/world_evaluation_cache.h"
 
 /**
  * The world object describes the entire state of the world, which for us is all the
@@ -226,6 +229,24 @@ class World final
      */
     const std::optional<Segment>& getDribbleDisplacement() const;
 
+    /**
+     * Sets the version of the field
+     *
+     * @see getFieldVersion for details
+     *
+     * @param field_version the version of the field
+     */
+    void setFieldVersion(uint64_t field_version);
+
+    /**
+     * Gets the version of the field. The version only changes when the field geometry
+     * changes, so caches of results computed from the field can be keyed on it
+     * instead of comparing fields.
+     *
+     * @return the version of the field, or 0 if the field is not versioned
+     */
+    uint64_t getFieldVersion() const;
+
     /**
      * Set the list of virtual obstacles
      *
@@ -240,6 +261,39 @@ class World final
      */
     TbotsProto::VirtualObstacles getVirtualObstacles() const;
 
+    /**
+     * Sets the latency trace of the vision frame this World was created from
+     *
+     * @param latency_trace The latency trace
+     */
+    void setLatencyTrace(const TbotsProto::LatencyTrace& latency_trace);
+
+    /**
+     * Gets the latency trace of the vision frame this World was created from, which
+     * is carried through to the primitives computed from this World
+     *
+     * @return the latency trace, or std::nullopt if this World was not created from a
+     * vision frame
+     */
+    const std::optional<TbotsProto::LatencyTrace>& getLatencyTrace() const;
+
+    /**
+     * Gets the cache of evaluation results computed from this World. The cache is
+     * cleared whenever this World is modified
+     *
+     * @return the evaluation cache of this World
+     */
+    WorldEvaluationCache& evaluationCache() const;
+
+    /**
+     * Gets the predicted trajectory of the ball, which bounces off the field boundary.
+     * The trajectory is computed once and shared by every caller until this World is
+     * modified
+     *
+     * @return the predicted trajectory of the ball
+     */
+    std::shared_ptr<const BallTrajectory> ballTrajectory() const;
+
    private:
     /**
      * Searches all member objects of world for the most recent Timestamp value
@@ -267,6 +321,12 @@ class World final
 
     // Virtual Obstacles for the Trajectory Planner
     TbotsProto::VirtualObstacles virtual_obstacles_;
+    uint64_t field_version_;
+    std::optional<TbotsProto::LatencyTrace> latency_trace_;
+
+    // Results of evaluation functions computed from this World. This is mutable since
+    // it does not change the state of the World
+    mutable WorldEvaluationCache evaluation_cache_;
 };
 
 using WorldPtr = std::shared_ptr<const World>;
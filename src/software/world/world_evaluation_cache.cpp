@@ -0,0 +1,36 @@
+#include "software/world/world_evaluation_cache.h"
+
+WorldEvaluationCache::WorldEvaluationCache(const WorldEvaluationCache &) {}
+
+WorldEvaluationCache &WorldEvaluationCache::operator=(const WorldEvaluationCache &other)
+{
+    if (this != &other)
+    {
+        clear();
+    }
+    return *this;
+}
+
+void WorldEvaluationCache::clear()
+{
+    std::scoped_lock lock(mutex_);
+    results_.clear();
+}
+
+std::map<std::string, WorldEvaluationCache::Stats> WorldEvaluationCache::getStats() const
+{
+    std::scoped_lock lock(mutex_);
+    return stats_;
+}
+
+WorldEvaluationCache::Stats WorldEvaluationCache::getTotalStats() const
+{
+    std::scoped_lock lock(mutex_);
+    Stats total;
+    for (const auto &[function_name, stats] : stats_)
+    {
+        total.hits += stats.hits;
+        total.misses += stats.misses;
+    }
+    return total;
+}
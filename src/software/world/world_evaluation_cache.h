@@ -0,0 +1,134 @@
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+/**
+ * Caches the results of evaluation functions computed from a World.
+ *
+ * Several tactics and plays evaluate the same pure functions of the same World in one
+ * AI tick (e.g. getAllEnemyThreats or calcBestShotOnGoal). A WorldEvaluationCache is
+ * attached to each World so those results are only computed once per World snapshot.
+ * Results are keyed by the name of the function and a string built from the arguments
+ * of the function that don't come from the World, and the World clears the cache
+ * whenever it is modified.
+ *
+ * The cache is thread-safe. The result is computed without holding the lock, so
+ * cached functions may call other cached functions. If two threads miss the same entry
+ * at the same time, both compute the result and the first one to finish is kept.
+ *
+ * Copying a cache produces an empty cache, so copies of a World never share results.
+ */
+class WorldEvaluationCache
+{
+   public:
+    // The number of times cached results were used or had to be computed
+    struct Stats
+    {
+        uint64_t hits   = 0;
+        uint64_t misses = 0;
+    };
+
+    WorldEvaluationCache() = default;
+    WorldEvaluationCache(const WorldEvaluationCache &);
+    WorldEvaluationCache &operator=(const WorldEvaluationCache &);
+
+    /**
+     * Gets the cached result of the given function called with the given arguments,
+     * computing and caching it if it isn't cached yet
+     *
+     * @param function_name The name of the cached function
+     * @param key A key uniquely identifying the arguments of the function
+     * @param compute A callable taking no arguments that computes the result if it
+     * isn't cached. The result must be copy constructible
+     *
+     * @return the result of the function
+     */
+    template <typename Compute>
+    std::invoke_result_t<Compute> getOrCompute(const std::string &function_name,
+                                               const std::string &key,
+                                               const Compute &compute);
+
+    /**
+     * Builds a cache key from the given arguments. Each argument must be printable to
+     * an std::ostream. Floating point values are printed with enough precision to
+     * tell any two different values apart
+     *
+     * @param args The arguments to build the key from
+     *
+     * @return the key
+     */
+    template <typename... Args>
+    static std::string makeKey(const Args &...args);
+
+    /**
+     * Removes all cached results. The hit and miss counts are not reset
+     */
+    void clear();
+
+    /**
+     * Gets the hit and miss counts for every function that has been looked up
+     *
+     * @return the hit and miss counts, keyed by function name
+     */
+    std::map<std::string, Stats> getStats() const;
+
+    /**
+     * Gets the hit and miss counts summed over every function
+     *
+     * @return the total hit and miss counts
+     */
+    Stats getTotalStats() const;
+
+   private:
+    mutable std::mutex mutex_;
+
+    // Results keyed by function name and then by the argument key
+    std::unordered_map<std::string, std::unordered_map<std::string, std::any>> results_;
+    std::map<std::string, Stats> stats_;
+};
+
+template <typename Compute>
+std::invoke_result_t<Compute> WorldEvaluationCache::getOrCompute(
+    const std::string &function_name, const std::string &key, const Compute &compute)
+{
+    using Result = std::invoke_result_t<Compute>;
+
+    {
+        std::scoped_lock lock(mutex_);
+        auto function_results = results_.find(function_name);
+        if (function_results != results_.end())
+        {
+            auto result = function_results->second.find(key);
+            if (result != function_results->second.end())
+            {
+                stats_[function_name].hits++;
+                return std::any_cast<const Result &>(result->second);
+            }
+        }
+        stats_[function_name].misses++;
+    }
+
+    Result result = compute();
+
+    std::scoped_lock lock(mutex_);
+    results_[function_name].emplace(key, result);
+    return result;
+}
+
+template <typename... Args>
+std::string WorldEvaluationCache::makeKey(const Args &...args)
+{
+    std::ostringstream key;
+    key << std::setprecision(std::numeric_limits<double>::max_digits10);
+    ((key << args << ';'), ...);
+    return key.str();
+}
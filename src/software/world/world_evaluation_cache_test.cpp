@@ -0,0 +1,124 @@
+#include "software/world/world_evaluation_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "software/test_util/test_util.h"
+#include "software/world/world.h"
+
+TEST(WorldEvaluationCacheTest, result_is_only_computed_once)
+{
+    WorldEvaluationCache cache;
+    int num_computations = 0;
+    auto compute         = [&]()
+    {
+        num_computations++;
+        return 42;
+    };
+
+    EXPECT_EQ(42, cache.getOrCompute("function", "key", compute));
+    EXPECT_EQ(42, cache.getOrCompute("function", "key", compute));
+    EXPECT_EQ(1, num_computations);
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(1, stats.at("function").hits);
+    EXPECT_EQ(1, stats.at("function").misses);
+}
+
+TEST(WorldEvaluationCacheTest, different_functions_and_keys_are_cached_separately)
+{
+    WorldEvaluationCache cache;
+
+    EXPECT_EQ(1, cache.getOrCompute("function_a", "key", []() { return 1; }));
+    EXPECT_EQ(2, cache.getOrCompute("function_b", "key", []() { return 2; }));
+    EXPECT_EQ(3, cache.getOrCompute("function_a", "other_key", []() { return 3; }));
+    EXPECT_EQ(1, cache.getOrCompute("function_a", "key", []() { return 4; }));
+    EXPECT_EQ(std::string("b"),
+              cache.getOrCompute("function_c", "key", []() { return std::string("b"); }));
+
+    WorldEvaluationCache::Stats total_stats = cache.getTotalStats();
+    EXPECT_EQ(1, total_stats.hits);
+    EXPECT_EQ(4, total_stats.misses);
+}
+
+TEST(WorldEvaluationCacheTest, clear_removes_results_but_keeps_stats)
+{
+    WorldEvaluationCache cache;
+    cache.getOrCompute("function", "key", []() { return 1; });
+    cache.clear();
+
+    EXPECT_EQ(2, cache.getOrCompute("function", "key", []() { return 2; }));
+    EXPECT_EQ(2, cache.getStats().at("function").misses);
+}
+
+TEST(WorldEvaluationCacheTest, copy_is_empty)
+{
+    WorldEvaluationCache cache;
+    cache.getOrCompute("function", "key", []() { return 1; });
+
+    WorldEvaluationCache copy(cache);
+    EXPECT_EQ(2, copy.getOrCompute("function", "key", []() { return 2; }));
+    EXPECT_EQ(1, cache.getOrCompute("function", "key", []() { return 3; }));
+}
+
+TEST(WorldEvaluationCacheTest, make_key_distinguishes_close_values)
+{
+    EXPECT_NE(WorldEvaluationCache::makeKey(Point(1, 2), 0.1),
+              WorldEvaluationCache::makeKey(Point(1, 2), 0.1 + 1e-12));
+    EXPECT_NE(WorldEvaluationCache::makeKey(1, 23), WorldEvaluationCache::makeKey(12, 3));
+    EXPECT_EQ(WorldEvaluationCache::makeKey(Point(1, 2), true),
+              WorldEvaluationCache::makeKey(Point(1, 2), true));
+}
+
+TEST(WorldEvaluationCacheTest, concurrent_lookups_return_the_same_result)
+{
+    WorldEvaluationCache cache;
+    std::vector<std::thread> threads;
+    std::vector<int> results(8, 0);
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        threads.emplace_back(
+            [&cache, &results, i]()
+            {
+                for (int j = 0; j < 100; j++)
+                {
+                    results[i] += cache.getOrCompute("function", std::to_string(j),
+                                                     [j]() { return j; });
+                }
+            });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int result : results)
+    {
+        EXPECT_EQ(99 * 100 / 2, result);
+    }
+    WorldEvaluationCache::Stats total_stats = cache.getTotalStats();
+    EXPECT_EQ(results.size() * 100, total_stats.hits + total_stats.misses);
+}
+
+TEST(WorldEvaluationCacheTest, world_clears_cache_when_updated)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    world->evaluationCache().getOrCompute("function", "key", []() { return 1; });
+    EXPECT_EQ(1, world->evaluationCache().getOrCompute("function", "key",
+                                                       []() { return 2; }));
+
+    world->updateBall(Ball(Point(1, 0), Vector(), Timestamp::fromSeconds(1)));
+    EXPECT_EQ(3, world->evaluationCache().getOrCompute("function", "key",
+                                                       []() { return 3; }));
+}
+
+TEST(WorldEvaluationCacheTest, copied_world_does_not_share_cache)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    world->evaluationCache().getOrCompute("function", "key", []() { return 1; });
+
+    World world_copy = *world;
+    EXPECT_EQ(2, world_copy.evaluationCache().getOrCompute("function", "key",
+                                                           []() { return 2; }));
+}
@@ -65,6 +65,7 @@ TEST_F(WorldTest, construction_with_parameters)
 
 TEST_F(WorldTest, construct_with_protobuf)
 {
+    world.setFieldVersion(3);
     auto world_proto = createWorld(world);
     World proto_converted_world(*world_proto);
 
@@ -73,6 +74,7 @@ TEST_F(WorldTest, construct_with_protobuf)
     EXPECT_EQ(world.field(), proto_converted_world.field());
     EXPECT_EQ(world.ball(), proto_converted_world.ball());
     EXPECT_EQ(world.gameState(), proto_converted_world.gameState());
+    EXPECT_EQ(3, proto_converted_world.getFieldVersion());
     EXPECT_EQ(world.enemyTeam().getGoalieId(),
               proto_converted_world.enemyTeam().getGoalieId());
     EXPECT_THAT(
@@ -214,3 +216,28 @@ TEST_F(WorldTest, set_team_with_possession)
     world.setTeamWithPossession(TeamPossession::ENEMY_TEAM);
     EXPECT_EQ(world.getTeamWithPossession(), TeamPossession::ENEMY_TEAM);
 }
+
+TEST_F(WorldTest, ball_trajectory_is_shared_until_world_is_modified)
+{
+    std::shared_ptr<const BallTrajectory> trajectory = world.ballTrajectory();
+    EXPECT_EQ(trajectory, world.ballTrajectory());
+    EXPECT_NEAR(0.09, trajectory->getTotalDistance(), 1e-9);
+
+    world.updateBall(Ball(Point(1, 2), Vector(1, 0), current_time));
+
+    std::shared_ptr<const BallTrajectory> new_trajectory = world.ballTrajectory();
+    EXPECT_NE(trajectory, new_trajectory);
+    EXPECT_NEAR(1.0, new_trajectory->getTotalDistance(), 1e-9);
+}
+
+TEST_F(WorldTest, latency_trace_is_carried_by_world)
+{
+    EXPECT_EQ(std::nullopt, world.getLatencyTrace());
+
+    TbotsProto::LatencyTrace latency_trace;
+    latency_trace.set_frame_id(12);
+    world.setLatencyTrace(latency_trace);
+
+    ASSERT_TRUE(world.getLatencyTrace().has_value());
+    EXPECT_EQ(12, world.getLatencyTrace()->frame_id());
+}